@@ -3,13 +3,88 @@
 #include <iostream>
 #include <stdio.h>
 #include "BsEditorApplication.h"
+#include "Testing/BsEditorBenchmarks.h"
 #include "Error/BsCrashHandler.h"
 
+namespace bs
+{
+	/** Returns the value following the provided option in the argument list, or an empty string if not present. */
+	String findOption(const Vector<String>& args, const String& name)
+	{
+		auto iterFind = std::find(args.begin(), args.end(), name);
+		if (iterFind == args.end() || (iterFind + 1) == args.end())
+			return StringUtil::BLANK;
+
+		return *(iterFind + 1);
+	}
+
+	/**
+	 * Runs the editor benchmarks and outputs the results, if requested through the command line. Benchmarks are ran
+	 * before the main loop is started so no frames are ever rendered.
+	 *
+	 * Supported options:
+	 *  --benchmark <path>						Runs the benchmarks and outputs JSON results at the provided path.
+	 *  --benchmark-scene-sizes <n0,n1,...>		Number of scene objects in each generated scene.
+	 *  --benchmark-library-entries <n>			Number of files in the generated project, zero to skip.
+	 *  --benchmark-iterations <n>				Number of times to run each benchmark.
+	 *
+	 * @return	True if benchmarks were ran, false otherwise.
+	 */
+	bool runBenchmarks(const Vector<String>& args)
+	{
+		String outputPath = findOption(args, "--benchmark");
+		if (outputPath.empty())
+			return false;
+
+		EDITOR_BENCHMARK_DESC desc;
+
+		String sceneSizes = findOption(args, "--benchmark-scene-sizes");
+		if (!sceneSizes.empty())
+		{
+			desc.sceneSizes.clear();
+			for (auto& entry : StringUtil::split(sceneSizes, ","))
+				desc.sceneSizes.push_back(parseUINT32(entry));
+		}
+
+		String numLibraryEntries = findOption(args, "--benchmark-library-entries");
+		if (!numLibraryEntries.empty())
+			desc.numLibraryEntries = parseUINT32(numLibraryEntries);
+
+		String numIterations = findOption(args, "--benchmark-iterations");
+		if (!numIterations.empty())
+			desc.numIterations = parseUINT32(numIterations);
+
+		EditorBenchmarks benchmarks(desc);
+		benchmarks.run();
+		benchmarks.saveJson(outputPath);
+
+		return true;
+	}
+}
+
 #if BS_PLATFORM == BS_PLATFORM_WIN32
 #include <windows.h>
+#include <shellapi.h>
+#include "String/BsUnicode.h"
 
 using namespace bs;
 
+bool runBenchmarks()
+{
+	// Let Windows parse the command line, so quoted arguments (e.g. paths with spaces) are kept whole
+	int numArgs = 0;
+	LPWSTR* argv = CommandLineToArgvW(GetCommandLineW(), &numArgs);
+	if (argv == nullptr)
+		return false;
+
+	Vector<String> args;
+	for (int i = 1; i < numArgs; i++)
+		args.push_back(UTF8::fromWide(WString(argv[i])));
+
+	LocalFree(argv);
+	return bs::runBenchmarks(args);
+}
+
 int CALLBACK WinMain(
 	_In_  HINSTANCE hInstance,
 	_In_  HINSTANCE hPrevInstance,
@@ -22,7 +97,10 @@ int CALLBACK WinMain(
 	__try
 	{
 		EditorApplication::startUp();
-		EditorApplication::instance().runMainLoop();
+
+		if (!runBenchmarks())
+			EditorApplication::instance().runMainLoop();
+
 		EditorApplication::shutDown();
 	}
 	__except (gCrashHandler().reportCrash(GetExceptionInformation()))
@@ -37,10 +115,15 @@ int CALLBACK WinMain(
 #else
 using namespace bs;
 
-int main()
+int main(int argc, char* argv[])
 {
+	Vector<String> args(argv + 1, argv + argc);
+
 	EditorApplication::startUp();
-	EditorApplication::instance().runMainLoop();
+
+	if (!runBenchmarks(args))
+		EditorApplication::instance().runMainLoop();
+
 	EditorApplication::shutDown();
 }
 #endif // End BS_PLATFORM
\ No newline at end of file
@@ -13,6 +13,7 @@
 #include "Scene/BsScenePicking.h"
 #include "Scene/BsSelection.h"
 #include "Scene/BsGizmoManager.h"
+#include "Scene/BsPrefabInstanceRegistry.h"
 #include "CodeEditor/BsCodeEditor.h"
 #include "Build/BsBuildManager.h"
 #include "Resources/BsScriptCodeImporter.h"
@@ -131,6 +132,7 @@ namespace bs
 		ScenePicking::startUp();
 		Selection::startUp();
 		GizmoManager::startUp();
+		PrefabInstanceRegistry::startUp();
 		BuildManager::startUp();
 		CodeEditorManager::startUp();
 
@@ -144,6 +146,7 @@ namespace bs
 
 		CodeEditorManager::shutDown();
 		BuildManager::shutDown();
+		PrefabInstanceRegistry::shutDown();
 		GizmoManager::shutDown();
 		Selection::shutDown();
 		ScenePicking::shutDown();
@@ -197,6 +200,7 @@ namespace bs
 
 		EditorWidgetManager::instance().update();
 		DropDownWindowManager::instance().update();
+		PrefabInstanceRegistry::instance()._update();
 	}
 
 	void EditorApplication::postUpdate()
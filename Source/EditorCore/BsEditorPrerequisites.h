@@ -174,6 +174,8 @@ namespace bs
 	class EditorCommand;
 	class ProjectFileMeta;
 	class ProjectResourceMeta;
+	class ChunkedScene;
+	class EditorBenchmarks;
 	class SceneGrid;
 	class HandleSlider;
 	class HandleSliderLine;
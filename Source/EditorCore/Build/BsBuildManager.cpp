@@ -26,6 +26,7 @@ namespace bs
 	}
 
 	const char* BuildManager::BUILD_FOLDER_NAME = "Builds/";
+	const char* BuildManager::PRELOAD_LIST_NAME = "Preload.txt";
 
 	BuildManager::BuildManager()
 	{
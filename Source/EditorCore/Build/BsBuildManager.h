@@ -90,6 +90,12 @@ namespace bs
 		/**	Clears currently active build settings. */
 		void clear();
 
+		/**
+		 * Name of the file listing UUIDs of the main scene and all of its dependencies, one per line, placed in the
+		 * packaged resources folder. Read by the game executable on start-up so it can load them in parallel.
+		 */
+		static const char* PRELOAD_LIST_NAME;
+
 	private:
 		static const char* BUILD_FOLDER_NAME;
 
@@ -9,6 +9,8 @@ set(BS_BANSHEEEDITOR_SRC_LIBRARY
 	"Library/BsProjectLibraryEntries.cpp"
 	"Library/BsProjectResourceMeta.cpp"
 	"Library/BsEditorShaderIncludeHandler.cpp"
+	"Library/BsChunkedScene.cpp"
+	"Library/BsFileChangeBatcher.cpp"
 )
 
 set(BS_BANSHEEEDITOR_INC_EDITORWINDOW
@@ -33,6 +35,7 @@ set(BS_BANSHEEEDITOR_INC_SCENE
 	"Scene/BsScenePicking.h"
 	"Scene/BsSelection.h"
 	"Scene/BsSelectionRenderer.h"
+	"Scene/BsPrefabInstanceRegistry.h"
 )
 
 set(BS_BANSHEEEDITOR_SRC_GUI
@@ -68,6 +71,8 @@ set(BS_BANSHEEEDITOR_INC_LIBRARY
 	"Library/BsProjectLibraryEntries.h"
 	"Library/BsProjectResourceMeta.h"
 	"Library/BsEditorShaderIncludeHandler.h"
+	"Library/BsChunkedScene.h"
+	"Library/BsFileChangeBatcher.h"
 )
 
 set(BS_BANSHEEEDITOR_INC_GUI
@@ -134,6 +139,7 @@ set(BS_BANSHEEEDITOR_SRC_SCENEVIEW
 	"SceneView/BsSelection.cpp"
 	"SceneView/BsScenePicking.cpp"
 	"SceneView/BsSceneGrid.cpp"
+	"SceneView/BsPrefabInstanceRegistry.cpp"
 )
 
 set(BS_BANSHEEEDITOR_INC_NOFILTER
@@ -156,6 +162,7 @@ set(BS_BANSHEEEDITOR_INC_HANDLES
 set(BS_BANSHEEEDITOR_SRC_UTILITY
 	"Utility/BsEditorUtility.cpp"
 	"Utility/BsSplashScreen.cpp"
+	"Utility/BsShapeMeshCache.cpp"
 )
 
 set(BS_BANSHEEEDITOR_SRC_EDITORWINDOW
@@ -178,10 +185,12 @@ set(BS_BANSHEEEDITOR_INC_UTILITY
 	"Utility/BsEditorUtility.h"
 	"Utility/BsBuiltinEditorResources.h"
 	"Utility/BsSplashScreen.h"
+	"Utility/BsShapeMeshCache.h"
 )
 
 set(BS_BANSHEEEDITOR_SRC_TESTING
 	"Testing/BsEditorTestSuite.cpp"
+	"Testing/BsEditorBenchmarks.cpp"
 )
 
 set(BS_BANSHEEEDITOR_SRC_SETTINGS
@@ -227,6 +236,7 @@ set(BS_BANSHEEEDITOR_SRC_HANDLES
 
 set(BS_BANSHEEEDITOR_INC_TESTING
 	"Testing/BsEditorTestSuite.h"
+	"Testing/BsEditorBenchmarks.h"
 )
 
 set(BS_BANSHEEEDITOR_INC_CODEEDITOR
@@ -104,7 +104,7 @@ namespace bs
 		}
 	}
 
-	void CodeEditorManager::syncSolution() const
+	void CodeEditorManager::syncSolution(const Vector<CodeAssemblyDefinition>& definitions) const
 	{
 		if (mActiveEditor == nullptr)
 			return;
@@ -122,8 +122,8 @@ namespace bs
 		PlatformType activePlatform = BuildManager::instance().getActivePlatform();
 		Vector<String> frameworkAssemblies = BuildManager::instance().getFrameworkAssemblies(activePlatform);
 
-		slnData.projects.push_back(CodeProjectData());
-		slnData.projects.push_back(CodeProjectData());
+		// Game and editor projects, followed by a project per assembly definition
+		slnData.projects.resize(2 + definitions.size());
 
 		// Game project
 		CodeProjectData& gameProject = slnData.projects[0];
@@ -145,10 +145,50 @@ namespace bs
 		editorProject.assemblyReferences.push_back(CodeProjectReference{ String(ENGINE_ASSEMBLY), gApplication().getEngineAssemblyPath() });
 		editorProject.assemblyReferences.push_back(CodeProjectReference{ String(EDITOR_ASSEMBLY), gEditorApplication().getEditorAssemblyPath() });
 		for (auto& assemblyName : frameworkAssemblies)
-			gameProject.assemblyReferences.push_back(CodeProjectReference{ assemblyName, Path::BLANK });
+			editorProject.assemblyReferences.push_back(CodeProjectReference{ assemblyName, Path::BLANK });
 
 		editorProject.projectReferences.push_back(CodeProjectReference{ gameProject.name, Path::BLANK });
 
+		// Assembly definition projects
+		for (UINT32 i = 0; i < (UINT32)definitions.size(); i++)
+		{
+			const CodeAssemblyDefinition& definition = definitions[i];
+
+			CodeProjectData& definitionProject = slnData.projects[2 + i];
+			definitionProject.name = definition.name;
+			definitionProject.defines = gameProject.defines;
+			definitionProject.assemblyReferences = gameProject.assemblyReferences;
+
+			for (auto& reference : definition.references)
+				definitionProject.projectReferences.push_back(CodeProjectReference{ reference, Path::BLANK });
+
+			// Game and editor assemblies can reference any of the definitions
+			gameProject.projectReferences.push_back(CodeProjectReference{ definition.name, Path::BLANK });
+			editorProject.projectReferences.push_back(CodeProjectReference{ definition.name, Path::BLANK });
+		}
+
+		// Finds the project owning a non-editor script, which is the one whose definition is in the nearest parent folder
+		auto findOwnerProject = [&](const Path& path) -> CodeProjectData&
+		{
+			UINT32 ownerIdx = 0;
+			UINT32 ownerDepth = 0;
+			for (UINT32 i = 0; i < (UINT32)definitions.size(); i++)
+			{
+				const Path& folder = definitions[i].folder;
+				if (!folder.includes(path))
+					continue;
+
+				UINT32 depth = folder.getNumDirectories() + 1;
+				if (depth > ownerDepth)
+				{
+					ownerIdx = 2 + i;
+					ownerDepth = depth;
+				}
+			}
+
+			return slnData.projects[ownerIdx];
+		};
+
 		//// Add files for both projects
 		for (auto& entry : libraryEntries)
 		{
@@ -167,7 +207,7 @@ namespace bs
 				if (isEditorScript)
 					editorProject.codeFiles.push_back(resEntry->path);
 				else
-					gameProject.codeFiles.push_back(resEntry->path);
+					findOwnerProject(resEntry->path).codeFiles.push_back(resEntry->path);
 			}
 			else
 				gameProject.nonCodeFiles.push_back(resEntry->path);
@@ -32,6 +32,17 @@ namespace bs
 		Vector<CodeProjectReference> projectReferences;
 	};
 
+	/**
+	 * Contains data about a script assembly definition (.asmdef) file. All non-editor scripts in the folder containing
+	 * the definition (and its subfolders, unless overridden by another definition) are compiled into a separate assembly.
+	 */
+	struct BS_ED_EXPORT CodeAssemblyDefinition
+	{
+		String name;
+		Path folder;
+		Vector<String> references;
+	};
+
 	/**	Contains data about an external editor solution, including all projects contained. */
 	struct BS_ED_EXPORT CodeSolutionData
 	{
@@ -81,8 +92,11 @@ namespace bs
 		/**
 		 * Synchronizes all code files and assemblies in the active project and updates the project solution for the active
 		 * editor. Each project can only have one solution per editor.
+		 *
+		 * @param[in]	definitions		Script assembly definitions in the project, as parsed and validated by the
+		 *								script compiler. A separate project is generated for each.
 		 */
-		void syncSolution() const;
+		void syncSolution(const Vector<CodeAssemblyDefinition>& definitions) const;
 
 	private:
 		/**	Returns the absolute path at which the external editor solution file should be stored. */
@@ -160,7 +174,7 @@ namespace bs
 		MonoDevelop
 	};
 
-	/** 
+	/**
 	 * Contains helper functionality for the generation of .csproj files, as well as the .sln file. Those are used by C# IDE's like Visual Studio
 	 * and MonoDevelop, and build systems like msbuild or xbuild.
 	 */
@@ -35,6 +35,15 @@ namespace bs
 			return nullptr;
 	}
 
+	bool EditorWidgetBase::isVisible() const
+	{
+		if (!mIsActive || mParent == nullptr)
+			return false;
+
+		EditorWindowBase* parentWindow = getParentWindow();
+		return parentWindow == nullptr || !parentWindow->isMinimized();
+	}
+
 	void EditorWidgetBase::setHasFocus(bool focus)
 	{
 		EditorWidgetContainer* parentContainer = _getParent();
@@ -190,13 +199,13 @@ namespace bs
 
 	void EditorWidgetBase::_disable()
 	{
-		mContent->setVisible(false);
+		mContent->setActive(false);
 		mIsActive = false;
 	}
 
 	void EditorWidgetBase::_enable()
 	{
-		mContent->setVisible(true);
+		mContent->setActive(true);
 		mIsActive = true;
 	}
 
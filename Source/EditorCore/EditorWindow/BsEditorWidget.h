@@ -65,6 +65,12 @@ namespace bs
 		 */
 		bool isActive() const { return mIsActive; }
 
+		/**
+		 * Checks is the widget's content currently visible on screen. Widgets that aren't active in their container, or
+		 * are docked in a minimized window, are not visible and don't receive updates.
+		 */
+		bool isVisible() const;
+
 		/**
 		 * Gets the parent editor window this widget is docked in. Can be null (for example when widget is in the process of
 		 * dragging and not visible).
@@ -89,6 +95,9 @@ namespace bs
 		/** Internal method. Called once per frame.	*/
 		virtual void update() { }
 
+		/** Internal method. Called once per frame instead of update() while the widget is not visible. */
+		virtual void suspendedUpdate() { }
+
 		Event<void(UINT32, UINT32)> onResized; /**< Triggered whenever widget size changes. */
 		Event<void(INT32, INT32)> onMoved; /**< Triggered whenever widget position changes. */
 		Event<void(EditorWidgetContainer*)> onParentChanged; /**< Triggered whenever widget parent container changes. */
@@ -113,7 +122,10 @@ namespace bs
 		/**	Sets or removes focus for this widget. */
 		void _setHasFocus(bool focus);
 
-		/** Disables the widget making its GUI contents not visible. The widget	remains docked in its container. */
+		/**
+		 * Disables the widget making its GUI contents not visible and excluding them from layout. The widget remains
+		 * docked in its container.
+		 */
 		void _disable();
 
 		/**	Enables the widget making its previously hidden GUI contents visible. */
@@ -3,6 +3,7 @@
 #include "EditorWindow/BsEditorWidgetContainer.h"
 #include "GUI/BsGUITabbedTitleBar.h"
 #include "EditorWindow/BsEditorWidget.h"
+#include "EditorWindow/BsEditorWidgetManager.h"
 #include "GUI/BsDragAndDropManager.h"
 #include "EditorWindow/BsEditorWindow.h"
 #include "GUI/BsGUIPanel.h"
@@ -45,9 +46,20 @@ namespace bs
 
 	void EditorWidgetContainer::update()
 	{
+		EditorWidgetManager& widgetManager = EditorWidgetManager::instance();
 		for (auto& widget : mWidgets)
 		{
-			widget.second->update();
+			// Widgets that aren't visible can't be interacted with, so there is no need to update their contents
+			if (widget.second->isVisible())
+			{
+				widget.second->update();
+				widgetManager._notifyWidgetUpdated(false);
+			}
+			else
+			{
+				widget.second->suspendedUpdate();
+				widgetManager._notifyWidgetUpdated(true);
+			}
 		}
 	}
 
@@ -293,6 +293,14 @@ namespace bs
 			mainWindow->getRenderWindow()->maximize();
 	}
 
+	void EditorWidgetManager::_notifyWidgetUpdated(bool suspended)
+	{
+		if (suspended)
+			mNumSuspendedWidgetUpdates++;
+		else
+			mNumWidgetUpdates++;
+	}
+
 	void EditorWidgetManager::onFocusGained(const RenderWindow& window)
 	{
 		// Do nothing, possibly regain focus on last focused widget?
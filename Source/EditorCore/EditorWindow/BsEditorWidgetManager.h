@@ -68,6 +68,21 @@ namespace bs
 		 */
 		void setLayout(const SPtr<EditorWidgetLayout>& layout);
 
+		/** Returns the number of times a visible widget was updated, since the manager was created. */
+		UINT64 getNumWidgetUpdates() const { return mNumWidgetUpdates; }
+
+		/**
+		 * Returns the number of times a widget update was skipped because the widget wasn't visible (e.g. its tab isn't
+		 * active, or its window is minimized), since the manager was created.
+		 */
+		UINT64 getNumSuspendedWidgetUpdates() const { return mNumSuspendedWidgetUpdates; }
+
+		/**
+		 * Called by widget containers whenever a widget is updated, or its update is skipped because it isn't visible.
+		 * Internal method.
+		 */
+		void _notifyWidgetUpdated(bool suspended);
+
 		/**
 		 * Allows you to queue up widgets that will be registered as soon as an instance of EditorWidgetManager is created.
 		 *
@@ -90,6 +105,9 @@ namespace bs
 		HEvent mOnFocusLostConn;
 		HEvent mOnFocusGainedConn;
 
+		UINT64 mNumWidgetUpdates = 0;
+		UINT64 mNumSuspendedWidgetUpdates = 0;
+
 		static Stack<std::pair<String, std::function<EditorWidgetBase*(EditorWidgetContainer&)>>> QueuedCreateCallbacks;
 	};
 
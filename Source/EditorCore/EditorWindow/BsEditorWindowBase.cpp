@@ -138,6 +138,13 @@ namespace bs
 		return (UINT32)mRenderWindow->getProperties().height;
 	}
 
+	bool EditorWindowBase::isMinimized() const
+	{
+		// Minimized windows report an empty client area
+		const RenderWindowProperties& props = mRenderWindow->getProperties();
+		return props.width == 0 || props.height == 0;
+	}
+
 	bool EditorWindowBase::hasFocus() const
 	{
 		return mRenderWindow->getProperties().hasFocus;
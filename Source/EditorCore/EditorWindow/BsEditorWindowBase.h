@@ -39,6 +39,9 @@ namespace bs
 		/**	Returns the height of the window in pixels. */
 		UINT32 getHeight() const;
 
+		/** Checks is the window minimized, in which case none of its contents are visible. */
+		bool isMinimized() const;
+
 		/**	Closes and destroys the window. */
 		virtual void close();
 
@@ -168,6 +168,7 @@ namespace bs
 	void GUIResourceTreeView::deleteTreeElement(ResourceTreeElement* element)
 	{
 		closeTemporarilyExpandedElements(); // In case this element is one of them
+		clearVisibleElements();
 
 		for(auto& child : element->mChildren)
 			deleteTreeElement((ResourceTreeElement*)child);
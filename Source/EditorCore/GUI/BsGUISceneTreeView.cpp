@@ -290,6 +290,7 @@ namespace bs
 	void GUISceneTreeView::deleteTreeElementInternal(GUITreeView::TreeElement* element)
 	{
 		closeTemporarilyExpandedElements(); // In case this element is one of them
+		clearVisibleElements();
 
 		for(auto& child : element->mChildren)
 			deleteTreeElementInternal(child);
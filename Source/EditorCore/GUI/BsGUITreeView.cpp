@@ -61,22 +61,6 @@ namespace bs
 		return false;
 	}
 
-	GUITreeView::TreeElement* GUITreeView::InteractableElement::getTreeElement() const
-	{
-		if(!isTreeElement())
-			return nullptr;
-
-		UINT32 sortedIdx = (index - 1) / 2;
-
-		auto findIter = std::find_if(parent->mChildren.begin(), parent->mChildren.end(),
-			[&](const TreeElement* x) { return x->mSortedIdx == sortedIdx; });
-
-		if(findIter != parent->mChildren.end())
-			return *findIter;
-
-		return nullptr;
-	}
-
 	GUITreeView::GUITreeView(const String& backgroundStyle, const String& elementBtnStyle, 
 		const String& foldoutBtnStyle, const String& selectionBackgroundStyle, const String& highlightBackgroundStyle, 
 		const String& editBoxStyle, const String& dragHighlightStyle, const String& dragSepHighlightStyle, const GUIDimensions& dimensions)
@@ -238,53 +222,21 @@ namespace bs
 								TreeElement* selectionRoot = mSelectedElements[0].element;
 								unselectAll();
 
-								auto iterStartFind = std::find_if(mVisibleElements.begin(), mVisibleElements.end(),
-									[&](const InteractableElement& x) { return x.parent == selectionRoot->mParent; });
+								INT32 startIdx = findVisibleElementIdx(selectionRoot);
+								INT32 endIdx = (INT32)(element - mVisibleElements.data());
 
-								bool foundStart = false;
-								bool foundEnd = false;
-								for (; iterStartFind != mVisibleElements.end(); ++iterStartFind)
+								if (startIdx != -1)
 								{
-									if (!iterStartFind->isTreeElement())
-										continue;
+									INT32 firstIdx = std::min(startIdx, endIdx);
+									INT32 lastIdx = std::max(startIdx, endIdx);
 
-									TreeElement* curElem = iterStartFind->getTreeElement();
-									if (curElem == selectionRoot)
+									for (INT32 i = firstIdx; i <= lastIdx; i++)
 									{
-										foundStart = true;
-										break;
+										if (mVisibleElements[i].isTreeElement())
+											selectElement(mVisibleElements[i].getTreeElement());
 									}
 								}
-
-								auto iterEndFind = std::find_if(mVisibleElements.begin(), mVisibleElements.end(),
-									[&](const InteractableElement& x) { return &x == element; });
-
-								if (iterEndFind != mVisibleElements.end())
-									foundEnd = true;
-
-								if (foundStart && foundEnd)
-								{
-									if (iterStartFind < iterEndFind)
-									{
-										for (; iterStartFind != (iterEndFind + 1); ++iterStartFind)
-										{
-											if (iterStartFind->isTreeElement())
-												selectElement(iterStartFind->getTreeElement());
-										}
-									}
-									else if (iterEndFind < iterStartFind)
-									{
-										for (; iterEndFind != (iterStartFind + 1); ++iterEndFind)
-										{
-											if (iterEndFind->isTreeElement())
-												selectElement(iterEndFind->getTreeElement());
-										}
-									}
-									else
-										selectElement(treeElement);
-								}
-
-								if (!foundStart || !foundEnd)
+								else
 									selectElement(treeElement);
 							}
 							else
@@ -444,8 +396,8 @@ namespace bs
 		if(ev.getType() == GUICommandEventType::MoveUp || ev.getType() == GUICommandEventType::SelectUp)
 		{
 			TreeElement* topMostElement = getTopMostSelectedElement();
-			auto topMostIter = std::find_if(mVisibleElements.begin(), mVisibleElements.end(), 
-				[&] (const InteractableElement& x) { return x.getTreeElement() == topMostElement; });
+			INT32 topMostIdx = findVisibleElementIdx(topMostElement);
+			auto topMostIter = topMostIdx != -1 ? mVisibleElements.begin() + topMostIdx : mVisibleElements.end();
 
 			if(topMostIter != mVisibleElements.end() && topMostIter != mVisibleElements.begin())
 			{
@@ -468,8 +420,8 @@ namespace bs
 		else if(ev.getType() == GUICommandEventType::MoveDown || ev.getType() == GUICommandEventType::SelectDown)
 		{
 			TreeElement* bottoMostElement = getBottomMostSelectedElement();
-			auto bottomMostIter = std::find_if(mVisibleElements.begin(), mVisibleElements.end(), 
-				[&] (const InteractableElement& x) { return x.getTreeElement() == bottoMostElement; });
+			INT32 bottomMostIdx = findVisibleElementIdx(bottoMostElement);
+			auto bottomMostIter = bottomMostIdx != -1 ? mVisibleElements.begin() + bottomMostIdx : mVisibleElements.end();
 
 			if(bottomMostIter != mVisibleElements.end())
 			{
@@ -977,6 +929,7 @@ namespace bs
 		};
 
 		mVisibleElements.clear();
+		mVisibleElementLookup.clear();
 
 		Stack<UpdateTreeElement> todo;
 		todo.push(UpdateTreeElement(&getRootElement(), 0));
@@ -1002,8 +955,12 @@ namespace bs
 				Vector2I elementSize = current->mElement->_getOptimalSize();
 				btnHeight = elementSize.y;
 
-				mVisibleElements.push_back(InteractableElement(current->mParent, current->mSortedIdx * 2 + 0, Rect2I(data.area.x, offset.y, data.area.width, ELEMENT_EXTRA_SPACING)));
-				mVisibleElements.push_back(InteractableElement(current->mParent, current->mSortedIdx * 2 + 1, Rect2I(data.area.x, offset.y + ELEMENT_EXTRA_SPACING, data.area.width, btnHeight)));
+				mVisibleElements.push_back(InteractableElement(current->mParent, current->mSortedIdx * 2 + 0, nullptr,
+					Rect2I(data.area.x, offset.y, data.area.width, ELEMENT_EXTRA_SPACING)));
+
+				mVisibleElementLookup[current] = (UINT32)mVisibleElements.size();
+				mVisibleElements.push_back(InteractableElement(current->mParent, current->mSortedIdx * 2 + 1, current,
+					Rect2I(data.area.x, offset.y + ELEMENT_EXTRA_SPACING, data.area.width, btnHeight)));
 
 				offset.x = data.area.x + INITIAL_INDENT_OFFSET + indent * INDENT_SIZE;
 				offset.y += ELEMENT_EXTRA_SPACING;
@@ -1066,7 +1023,10 @@ namespace bs
 		UINT32 remainingHeight = (UINT32)std::max(0, (INT32)data.area.height - (offset.y - data.area.y));
 
 		if(remainingHeight > 0)
-			mVisibleElements.push_back(InteractableElement(&getRootElement(), (UINT32)getRootElement().mChildren.size() * 2, Rect2I(data.area.x, offset.y, data.area.width, remainingHeight)));
+		{
+			mVisibleElements.push_back(InteractableElement(&getRootElement(), (UINT32)getRootElement().mChildren.size() * 2,
+				nullptr, Rect2I(data.area.x, offset.y, data.area.width, remainingHeight)));
+		}
 
 		for(auto selectedElem : mSelectedElements)
 		{
@@ -1164,67 +1124,66 @@ namespace bs
 
 	const GUITreeView::InteractableElement* GUITreeView::findElementUnderCoord(const Vector2I& coord) const
 	{
-		for(auto& element : mVisibleElements)
-		{
-			if(element.bounds.contains(coord))
-			{
-				return &element;
-			}
-		}
+		// Elements are laid out top to bottom without overlap, so find the last one starting at or above the coordinate
+		auto iterFind = std::upper_bound(mVisibleElements.begin(), mVisibleElements.end(), coord.y,
+			[](INT32 y, const InteractableElement& x) { return y < x.bounds.y; });
+
+		if(iterFind == mVisibleElements.begin())
+			return nullptr;
+
+		--iterFind;
+		if(iterFind->bounds.contains(coord))
+			return &(*iterFind);
 
 		return nullptr;
 	}
 
-	GUITreeView::TreeElement* GUITreeView::getTopMostSelectedElement() const
+	INT32 GUITreeView::findVisibleElementIdx(const TreeElement* element) const
+	{
+		auto iterFind = mVisibleElementLookup.find(element);
+		if(iterFind != mVisibleElementLookup.end())
+			return (INT32)iterFind->second;
+
+		return -1;
+	}
+
+	void GUITreeView::clearVisibleElements()
 	{
-		auto topMostElement = mVisibleElements.end();
+		mVisibleElements.clear();
+		mVisibleElementLookup.clear();
 
+		_markLayoutAsDirty();
+	}
+
+	GUITreeView::TreeElement* GUITreeView::getTopMostSelectedElement() const
+	{
+		// Visible elements are sorted top to bottom, so the lowest index is the top-most
+		INT32 topMostIdx = -1;
 		for(auto& selectedElement : mSelectedElements)
 		{
-			auto iterFind = std::find_if(mVisibleElements.begin(), mVisibleElements.end(), 
-				[&] (const InteractableElement& x) { return x.getTreeElement() == selectedElement.element; });
-
-			if(iterFind != mVisibleElements.end())
-			{
-				if(topMostElement == mVisibleElements.end())
-					topMostElement = iterFind;
-				else
-				{
-					if(iterFind->bounds.y < topMostElement->bounds.y)
-						topMostElement = iterFind;
-				}
-			}
+			INT32 idx = findVisibleElementIdx(selectedElement.element);
+			if(idx != -1 && (topMostIdx == -1 || idx < topMostIdx))
+				topMostIdx = idx;
 		}
 
-		if(topMostElement != mVisibleElements.end())
-			return topMostElement->getTreeElement();
+		if(topMostIdx != -1)
+			return mVisibleElements[topMostIdx].getTreeElement();
 		else
 			return nullptr;
 	}
 
 	GUITreeView::TreeElement* GUITreeView::getBottomMostSelectedElement() const
 	{
-		auto botMostElement = mVisibleElements.end();
-
+		INT32 botMostIdx = -1;
 		for(auto& selectedElement : mSelectedElements)
 		{
-			auto iterFind = std::find_if(mVisibleElements.begin(), mVisibleElements.end(), 
-				[&] (const InteractableElement& x) { return x.getTreeElement() == selectedElement.element; });
-
-			if(iterFind != mVisibleElements.end())
-			{
-				if(botMostElement == mVisibleElements.end())
-					botMostElement = iterFind;
-				else
-				{
-					if((iterFind->bounds.y + iterFind->bounds.height) > (botMostElement->bounds.y + botMostElement->bounds.height))
-						botMostElement = iterFind;
-				}
-			}
+			INT32 idx = findVisibleElementIdx(selectedElement.element);
+			if(idx > botMostIdx)
+				botMostIdx = idx;
 		}
 
-		if(botMostElement != mVisibleElements.end())
-			return botMostElement->getTreeElement();
+		if(botMostIdx != -1)
+			return mVisibleElements[botMostIdx].getTreeElement();
 		else
 			return nullptr;
 	}
@@ -70,15 +70,16 @@ namespace bs
 		 */
 		struct InteractableElement
 		{
-			InteractableElement(TreeElement* parent, UINT32 index, const Rect2I& bounds)
-				:parent(parent), index(index), bounds(bounds)
+			InteractableElement(TreeElement* parent, UINT32 index, TreeElement* element, const Rect2I& bounds)
+				:parent(parent), index(index), element(element), bounds(bounds)
 			{ }
 
 			bool isTreeElement() const { return index % 2 == 1; }
-			TreeElement* getTreeElement() const;
+			TreeElement* getTreeElement() const { return element; }
 
 			TreeElement* parent;
 			UINT32 index;
+			TreeElement* element; /**< Tree element represented by this entry, or null for separators. */
 			Rect2I bounds;
 		};
 
@@ -157,6 +158,18 @@ namespace bs
 		 */
 		const InteractableElement* findElementUnderCoord(const Vector2I& coord) const;
 
+		/**
+		 * Returns the index of the entry in the visible element list representing the provided tree element, or -1 if the
+		 * element is not visible.
+		 */
+		INT32 findVisibleElementIdx(const TreeElement* element) const;
+
+		/**
+		 * Clears the list of visible elements until the next layout update. Must be called before deleting a tree element,
+		 * so the list doesn't reference it.
+		 */
+		void clearVisibleElements();
+
 		/**	Returns the top-most selected tree element if selection is active, null otherwise. */
 		TreeElement* getTopMostSelectedElement() const;
 
@@ -283,7 +296,8 @@ namespace bs
 
 		GUITexture* mBackgroundImage;
 
-		Vector<InteractableElement> mVisibleElements;
+		Vector<InteractableElement> mVisibleElements; // Sorted by Y coordinate
+		UnorderedMap<const TreeElement*, UINT32> mVisibleElementLookup;
 
 		bool mIsElementSelected;
 		Vector<SelectedElement> mSelectedElements;
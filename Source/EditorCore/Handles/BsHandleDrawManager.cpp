@@ -45,13 +45,14 @@ namespace bs
 
 	HandleDrawManager::~HandleDrawManager()
 	{
-		clearMeshes();
+		mMeshCache.reset();
 		bs_delete(mDrawHelper);
 	}
 
 	void HandleDrawManager::setColor(const Color& color)
 	{
 		mDrawHelper->setColor(color);
+		mMeshCache.addToHash(color);
 	}
 
 	void HandleDrawManager::setTransform(const Matrix4& transform)
@@ -62,6 +63,7 @@ namespace bs
 	void HandleDrawManager::setLayer(UINT64 layer)
 	{
 		mDrawHelper->setLayer(layer);
+		mMeshCache.addToHash(layer);
 	}
 
 	void HandleDrawManager::drawCube(const Vector3& position, const Vector3& extents, float size)
@@ -69,6 +71,7 @@ namespace bs
 		Matrix4 scale = Matrix4::scaling(size);
 		mDrawHelper->setTransform(mTransform * scale);
 
+		mMeshCache.addAllToHash(DrawShape::Cube, mTransform, size, position, extents);
 		mDrawHelper->cube(position, extents);
 	}
 
@@ -77,6 +80,7 @@ namespace bs
 		Matrix4 scale = Matrix4::scaling(size);
 		mDrawHelper->setTransform(mTransform * scale);
 
+		mMeshCache.addAllToHash(DrawShape::Sphere, mTransform, size, position, radius);
 		mDrawHelper->sphere(position, radius);
 	}
 
@@ -85,6 +89,7 @@ namespace bs
 		Matrix4 scale = Matrix4::scaling(size);
 		mDrawHelper->setTransform(mTransform * scale);
 
+		mMeshCache.addAllToHash(DrawShape::WireCube, mTransform, size, position, extents);
 		mDrawHelper->wireCube(position, extents);
 	}
 
@@ -93,6 +98,7 @@ namespace bs
 		Matrix4 scale = Matrix4::scaling(size);
 		mDrawHelper->setTransform(mTransform * scale);
 
+		mMeshCache.addAllToHash(DrawShape::WireSphere, mTransform, size, position, radius);
 		mDrawHelper->wireSphere(position, radius);
 	}
 
@@ -101,6 +107,7 @@ namespace bs
 		Matrix4 scale = Matrix4::scaling(size);
 
 		mDrawHelper->setTransform(mTransform * scale);
+		mMeshCache.addAllToHash(DrawShape::Cone, mTransform, size, base, normal, height, radius);
 		mDrawHelper->cone(base, normal, height, radius);
 	}
 
@@ -109,6 +116,7 @@ namespace bs
 		Matrix4 scale = Matrix4::scaling(size);
 		mDrawHelper->setTransform(mTransform * scale);
 
+		mMeshCache.addAllToHash(DrawShape::Line, mTransform, size, start, end);
 		mDrawHelper->line(start, end);
 	}
 
@@ -117,6 +125,7 @@ namespace bs
 		Matrix4 scale = Matrix4::scaling(size);
 		mDrawHelper->setTransform(mTransform * scale);
 
+		mMeshCache.addAllToHash(DrawShape::Disc, mTransform, size, position, normal, radius);
 		mDrawHelper->disc(position, normal, radius);
 	}
 
@@ -125,6 +134,7 @@ namespace bs
 		Matrix4 scale = Matrix4::scaling(size);
 		mDrawHelper->setTransform(mTransform * scale);
 
+		mMeshCache.addAllToHash(DrawShape::WireDisc, mTransform, size, position, normal, radius);
 		mDrawHelper->wireDisc(position, normal, radius);
 	}
 
@@ -133,6 +143,7 @@ namespace bs
 		Matrix4 scale = Matrix4::scaling(size);
 		mDrawHelper->setTransform(mTransform * scale);
 
+		mMeshCache.addAllToHash(DrawShape::Arc, mTransform, size, position, normal, radius, startAngle, amountAngle);
 		mDrawHelper->arc(position, normal, radius, startAngle, amountAngle);
 	}
 
@@ -141,6 +152,7 @@ namespace bs
 		Matrix4 scale = Matrix4::scaling(size);
 		mDrawHelper->setTransform(mTransform * scale);
 
+		mMeshCache.addAllToHash(DrawShape::WireArc, mTransform, size, position, normal, radius, startAngle, amountAngle);
 		mDrawHelper->wireArc(position, normal, radius, startAngle, amountAngle);
 	}
 
@@ -149,6 +161,7 @@ namespace bs
 		Matrix4 scale = Matrix4::scaling(size);
 		mDrawHelper->setTransform(mTransform * scale);
 
+		mMeshCache.addAllToHash(DrawShape::Rectangle, mTransform, size, area);
 		mDrawHelper->rectangle(area);
 	}
 
@@ -161,6 +174,10 @@ namespace bs
 		if (myFont == nullptr)
 			myFont = BuiltinEditorResources::instance().getDefaultAAFont();
 
+		mMeshCache.addAllToHash(DrawShape::Text, mTransform, size, position, fontSize);
+		mMeshCache.addToHash(text);
+		mMeshCache.addToHash(myFont.getUUID());
+
 		mDrawHelper->text(position, text, myFont, fontSize);
 	}
 
@@ -178,11 +195,7 @@ namespace bs
 			mLastFrameIdx = frameIdx;
 		}
 
-		const Transform& tfrm = camera->getTransform();
-		const Vector<DrawHelper::ShapeMeshData>& meshes = 
-			mDrawHelper->buildMeshes(DrawHelper::SortType::BackToFront, tfrm.getPosition(), camera->getLayers());
-
-		mActiveMeshes.push_back(meshes);
+		const Vector<DrawHelper::ShapeMeshData>& meshes = mMeshCache.getMeshes(*mDrawHelper, *camera, camera->getLayers());
 
 		Vector<ct::HandleRenderer::MeshData> proxyData;
 		for (auto& meshData : meshes)
@@ -214,11 +227,12 @@ namespace bs
 	void HandleDrawManager::clear()
 	{
 		mDrawHelper->clear();
+		mMeshCache.clear();
 	}
 
 	void HandleDrawManager::clearMeshes()
 	{
-		mActiveMeshes.clear();
+		mMeshCache.endFrame();
 	}
 
 	namespace ct
@@ -6,6 +6,7 @@
 #include "Renderer/BsRendererExtension.h"
 #include "RenderAPI/BsGpuParams.h"
 #include "Utility/BsDrawHelper.h"
+#include "Utility/BsShapeMeshCache.h"
 #include "Renderer/BsParamBlocks.h"
 
 namespace bs
@@ -164,17 +165,20 @@ namespace bs
 		/** Clears all handle draw commands. */
 		void clear();
 
+		/** Returns statistics about handle meshes built and re-used during the previous frame. */
+		const EditorMeshStats& getMeshStats() const { return mMeshCache.getLastFrameStats(); }
+
 	private:
 		friend class ct::HandleRenderer;
 
-		/** Destroys all meshes allocated since the last call to this method. */
+		/** Releases meshes of cameras that haven't been drawn to since the last call, and starts a new frame. */
 		void clearMeshes();
 
 		static const UINT32 SPHERE_QUALITY;
 		static const UINT32 WIRE_SPHERE_QUALITY;
 		static const UINT32 ARC_QUALITY;
 
-		Vector<Vector<DrawHelper::ShapeMeshData>> mActiveMeshes;
+		ShapeMeshCache mMeshCache;
 		UINT64 mLastFrameIdx;
 
 		Matrix4 mTransform;
@@ -3,6 +3,9 @@
 #include "Handles/BsHandleSlider.h"
 #include "Components/BsCCamera.h"
 #include "Handles/BsHandleManager.h"
+#include "Handles/BsHandleSliderManager.h"
+#include "Math/BsSphere.h"
+#include "Math/BsRect2I.h"
 #include "Debug/BsDebug.h"
 
 namespace bs
@@ -18,32 +21,50 @@ namespace bs
 	{
 		if (mFixedScale)
 		{
-			mDistanceScale = HandleManager::instance().getHandleSize(camera, mPosition);
-			mTransformDirty = true;
+			float distanceScale = HandleManager::instance().getHandleSize(camera, mPosition);
+			if (distanceScale != mDistanceScale)
+			{
+				mDistanceScale = distanceScale;
+				markTransformDirty();
+			}
 		}
 	}
 
 	void HandleSlider::setPosition(const Vector3& position)
 	{
+		// Handles usually re-apply their transform every frame, so avoid invalidating the slider bounds needlessly
+		if (position == mPosition)
+			return;
+
 		mPosition = position;
-		mTransformDirty = true;
+		markTransformDirty();
 	}
 
 	void HandleSlider::setRotation(const Quaternion& rotation)
 	{
+		if (rotation == mRotation)
+			return;
+
 		mRotation = rotation;
-		mTransformDirty = true;
+		markTransformDirty();
 	}
 
 	void HandleSlider::setScale(const Vector3& scale)
 	{
+		if (scale == mScale)
+			return;
+
 		mScale = scale;
-		mTransformDirty = true;
+		markTransformDirty();
 	}
 
 	void HandleSlider::setEnabled(bool enabled)
 	{
+		if (enabled == mEnabled)
+			return;
+
 		mEnabled = enabled;
+		HandleManager::instance().getSliderManager()._notifySliderModified();
 	}
 
 	const Matrix4& HandleSlider::getTransform() const
@@ -78,6 +99,49 @@ namespace bs
 		mTransformDirty = false;
 	}
 
+	void HandleSlider::markTransformDirty()
+	{
+		mTransformDirty = true;
+		HandleManager::instance().getSliderManager()._notifySliderModified();
+	}
+
+	bool HandleSlider::calculateScreenBounds(const SPtr<Camera>& camera, const Sphere& localBounds,
+		Rect2I& bounds) const
+	{
+		Sphere worldBounds = localBounds;
+		worldBounds.transform(getTransform());
+
+		const Vector3& center = worldBounds.getCenter();
+		float radius = worldBounds.getRadius();
+
+		// Project corners of the box encompassing the sphere. Since the box is convex, its projection contains the
+		// projection of the sphere.
+		Vector2I min(std::numeric_limits<INT32>::max(), std::numeric_limits<INT32>::max());
+		Vector2I max(std::numeric_limits<INT32>::min(), std::numeric_limits<INT32>::min());
+
+		float nearDist = camera->getNearClipDistance();
+		for (UINT32 i = 0; i < 8; i++)
+		{
+			Vector3 corner(
+				center.x + ((i & 1) ? radius : -radius),
+				center.y + ((i & 2) ? radius : -radius),
+				center.z + ((i & 4) ? radius : -radius));
+
+			// Projection is not valid for points behind the near plane (view space looks down negative Z)
+			Vector3 viewPoint = camera->worldToViewPoint(corner);
+			if (-viewPoint.z < nearDist)
+				return false;
+
+			Vector2I screenPoint = camera->viewToScreenPoint(viewPoint);
+			min = Vector2I(std::min(min.x, screenPoint.x), std::min(min.y, screenPoint.y));
+			max = Vector2I(std::max(max.x, screenPoint.x), std::max(max.y, screenPoint.y));
+		}
+
+		// Expand by a pixel to account for rounding
+		bounds = Rect2I(min.x - 1, min.y - 1, (UINT32)(max.x - min.x + 3), (UINT32)(max.y - min.y + 3));
+		return true;
+	}
+
 	void HandleSlider::setInactive() 
 	{ 
 		mState = State::Inactive; 
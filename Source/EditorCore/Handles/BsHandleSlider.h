@@ -58,6 +58,18 @@ namespace bs
 		 */
 		virtual void handleInput(const SPtr<Camera>& camera, const Vector2I& inputDelta) = 0;
 
+		/**
+		 * Calculates the area in screen space that contains all of the slider geometry, as seen through the provided
+		 * camera. Used for quickly rejecting sliders that cannot intersect the pointer.
+		 *
+		 * @param[in]	camera	Camera through which the slider is being viewed.
+		 * @param[out]	bounds	Area in pixels, in the same space as the pointer position. Only valid if the method
+		 *						returns true.
+		 * @return				True if the bounds could be calculated, or false if the slider should always be tested for
+		 *						intersection.
+		 */
+		virtual bool getScreenBounds(const SPtr<Camera>& camera, Rect2I& bounds) const { return false; }
+
 		/**
 		 * Updates the state of the slider. Must be called every frame.
 		 *
@@ -133,6 +145,21 @@ namespace bs
 		/**	Updates the internal transform from the stored position, rotation and scale values. */
 		void updateCachedTransform() const;
 
+		/** Marks the transform as dirty and notifies the slider manager that the slider bounds need to be recalculated. */
+		void markTransformDirty();
+
+		/**
+		 * Calculates screen bounds of a sphere encompassing the slider geometry. Helper for getScreenBounds()
+		 * implementations.
+		 *
+		 * @param[in]	camera		Camera through which the slider is being viewed.
+		 * @param[in]	localBounds	Sphere encompassing the slider geometry, in the slider's local space.
+		 * @param[out]	bounds		Area in pixels covered by the sphere.
+		 * @return					True if the bounds could be calculated. False if the sphere intersects the camera
+		 *							near plane or is behind the camera.
+		 */
+		bool calculateScreenBounds(const SPtr<Camera>& camera, const Sphere& localBounds, Rect2I& bounds) const;
+
 		/**
 		 * Calculates amount of movement along the provided ray depending on pointer movement.
 		 *
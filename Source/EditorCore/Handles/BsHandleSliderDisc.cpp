@@ -4,6 +4,7 @@
 #include "Handles/BsHandleManager.h"
 #include "Handles/BsHandleSliderManager.h"
 #include "Math/BsRay.h"
+#include "Math/BsSphere.h"
 #include "Math/BsVector3.h"
 #include "Math/BsQuaternion.h"
 #include "Components/BsCCamera.h"
@@ -71,6 +72,12 @@ namespace bs
 		return false;
 	}
 
+	bool HandleSliderDisc::getScreenBounds(const SPtr<Camera>& camera, Rect2I& bounds) const
+	{
+		Sphere localBounds(Vector3::ZERO, mRadius + TORUS_RADIUS);
+		return calculateScreenBounds(camera, localBounds, bounds);
+	}
+
 	Vector3 HandleSliderDisc::calculateClosestPointOnArc(const Ray& inputRay, const Vector3& center, const Vector3& up,
 		float radius, Degree startAngle, Degree angleAmount)
 	{
@@ -37,6 +37,9 @@ namespace bs
 		/** @copydoc	HandleSlider::handleInput */
 		void handleInput(const SPtr<Camera>& camera, const Vector2I& inputDelta) override;
 
+		/** @copydoc HandleSlider::getScreenBounds */
+		bool getScreenBounds(const SPtr<Camera>& camera, Rect2I& bounds) const override;
+
 		/**
 		 * Enables or disables a cut-off plane that can allow the disc to be intersected with only in an 180 degree arc.
 		 *
@@ -72,6 +72,12 @@ namespace bs
 		return gotIntersect;
 	}
 
+	bool HandleSliderLine::getScreenBounds(const SPtr<Camera>& camera, Rect2I& bounds) const
+	{
+		Sphere localBounds(mDirection * mLength * 0.5f, mLength * 0.5f + SPHERE_RADIUS);
+		return calculateScreenBounds(camera, localBounds, bounds);
+	}
+
 	void HandleSliderLine::handleInput(const SPtr<Camera>& camera, const Vector2I& inputDelta)
 	{
 		assert(getState() == State::Active);
@@ -4,11 +4,15 @@
 #include "Utility/BsBuiltinEditorResources.h"
 #include "Components/BsCCamera.h"
 #include "Handles/BsHandleSlider.h"
+#include "RenderAPI/BsViewport.h"
 
 using namespace std::placeholders;
 
 namespace bs
 {
+	const UINT32 HandleSliderManager::GRID_CELL_SIZE = 32;
+	const float HandleSliderManager::MAX_SLIDER_COVERAGE = 0.25f;
+
 	void HandleSliderManager::update(const SPtr<Camera>& camera, const Vector2I& inputPos, const Vector2I& inputDelta)
 	{
 		for (auto& slider : mSliders)
@@ -94,22 +98,17 @@ namespace bs
 		}
 	}
 
-	HandleSlider* HandleSliderManager::findUnderCursor(const SPtr<Camera>& camera, const Vector2I& inputPos) const
+	HandleSlider* HandleSliderManager::findUnderCursor(const SPtr<Camera>& camera, const Vector2I& inputPos)
 	{
 		Ray inputRay = camera->screenPointToRay(inputPos);
 
 		float nearestT = std::numeric_limits<float>::max();
 		HandleSlider* overSlider = nullptr;
-		
-		for (auto& slider : mSliders)
-		{
-			if (!slider->getEnabled())
-				continue;
-
-			bool layerMatches = (camera->getLayers() & slider->getLayer()) != 0;
 
+		auto testSlider = [&](HandleSlider* slider)
+		{
 			float t;
-			if (layerMatches && slider->intersects(inputPos, inputRay, t))
+			if (slider->intersects(inputPos, inputRay, t))
 			{
 				if (t < nearestT)
 				{
@@ -117,19 +116,160 @@ namespace bs
 					nearestT = t;
 				}
 			}
+		};
+
+		SliderGrid& grid = mStates[camera->getInternalID()].grid;
+		updateGrid(camera, grid);
+
+		INT32 x = inputPos.x - grid.area.x;
+		INT32 y = inputPos.y - grid.area.y;
+
+		if (x < 0 || y < 0 || x >= (INT32)grid.area.width || y >= (INT32)grid.area.height)
+		{
+			// Pointer is outside of the grid, fall back to testing all sliders
+			for (auto& slider : mSliders)
+			{
+				if (!slider->getEnabled())
+					continue;
+
+				bool layerMatches = (camera->getLayers() & slider->getLayer()) != 0;
+				if (layerMatches)
+					testSlider(slider);
+			}
+
+			return overSlider;
 		}
 
+		UINT32 cellIdx = (y / GRID_CELL_SIZE) * grid.numCellsX + (x / GRID_CELL_SIZE);
+		for (UINT32 i = grid.cellStarts[cellIdx]; i < grid.cellStarts[cellIdx + 1]; i++)
+			testSlider(grid.cellSliders[i]);
+
+		for (auto& slider : grid.unboundedSliders)
+			testSlider(slider);
+
 		return overSlider;
 	}
 
+	void HandleSliderManager::updateGrid(const SPtr<Camera>& camera, SliderGrid& grid)
+	{
+		const Matrix4& viewMatrix = camera->getViewMatrix();
+		const Matrix4& projMatrix = camera->getProjectionMatrixRS();
+		Rect2I area = camera->getViewport()->getPixelArea();
+		UINT64 layers = camera->getLayers();
+
+		bool isDirty = !grid.isBuilt || grid.version != mVersion || grid.viewMatrix != viewMatrix ||
+			grid.projMatrix != projMatrix || grid.area != area || grid.layers != layers;
+
+		if (!isDirty)
+			return;
+
+		grid.isBuilt = true;
+		grid.version = mVersion;
+		grid.viewMatrix = viewMatrix;
+		grid.projMatrix = projMatrix;
+		grid.area = area;
+		grid.layers = layers;
+
+		grid.numCellsX = std::max(1U, (area.width + GRID_CELL_SIZE - 1) / GRID_CELL_SIZE);
+		grid.numCellsY = std::max(1U, (area.height + GRID_CELL_SIZE - 1) / GRID_CELL_SIZE);
+
+		UINT32 numCells = grid.numCellsX * grid.numCellsY;
+		UINT32 maxCoveredCells = std::max(1U, (UINT32)(numCells * MAX_SLIDER_COVERAGE));
+
+		grid.cellStarts.assign(numCells + 1, 0);
+		grid.cellSliders.clear();
+		grid.unboundedSliders.clear();
+
+		/** Range of grid cells covered by a slider. */
+		struct CellRange
+		{
+			HandleSlider* slider;
+			UINT32 minX, minY;
+			UINT32 maxX, maxY;
+		};
+
+		Vector<CellRange> ranges;
+		ranges.reserve(mSliders.size());
+
+		// Determine which cells does each slider cover, and count the number of sliders per cell
+		for (auto& slider : mSliders)
+		{
+			if (!slider->getEnabled())
+				continue;
+
+			bool layerMatches = (layers & slider->getLayer()) != 0;
+			if (!layerMatches)
+				continue;
+
+			Rect2I bounds;
+			if (!slider->getScreenBounds(camera, bounds))
+			{
+				grid.unboundedSliders.push_back(slider);
+				continue;
+			}
+
+			INT32 left = bounds.x - area.x;
+			INT32 top = bounds.y - area.y;
+			INT32 right = left + (INT32)bounds.width - 1;
+			INT32 bottom = top + (INT32)bounds.height - 1;
+
+			// Outside of the grid, cannot be under the pointer
+			if (right < 0 || bottom < 0 || left >= (INT32)area.width || top >= (INT32)area.height)
+				continue;
+
+			CellRange range;
+			range.slider = slider;
+			range.minX = (UINT32)std::max(left, 0) / GRID_CELL_SIZE;
+			range.minY = (UINT32)std::max(top, 0) / GRID_CELL_SIZE;
+			range.maxX = (UINT32)std::min(right, (INT32)area.width - 1) / GRID_CELL_SIZE;
+			range.maxY = (UINT32)std::min(bottom, (INT32)area.height - 1) / GRID_CELL_SIZE;
+
+			UINT32 numCovered = (range.maxX - range.minX + 1) * (range.maxY - range.minY + 1);
+			if (numCovered > maxCoveredCells)
+			{
+				grid.unboundedSliders.push_back(slider);
+				continue;
+			}
+
+			for (UINT32 cellY = range.minY; cellY <= range.maxY; cellY++)
+			{
+				for (UINT32 cellX = range.minX; cellX <= range.maxX; cellX++)
+					grid.cellStarts[cellY * grid.numCellsX + cellX + 1]++;
+			}
+
+			ranges.push_back(range);
+		}
+
+		// Convert counts into offsets, and fill the cells
+		for (UINT32 i = 1; i <= numCells; i++)
+			grid.cellStarts[i] += grid.cellStarts[i - 1];
+
+		grid.cellSliders.resize(grid.cellStarts[numCells]);
+
+		Vector<UINT32> cellOffsets(grid.cellStarts.begin(), grid.cellStarts.end() - 1);
+		for (auto& range : ranges)
+		{
+			for (UINT32 cellY = range.minY; cellY <= range.maxY; cellY++)
+			{
+				for (UINT32 cellX = range.minX; cellX <= range.maxX; cellX++)
+				{
+					UINT32 cellIdx = cellY * grid.numCellsX + cellX;
+					grid.cellSliders[cellOffsets[cellIdx]++] = range.slider;
+				}
+			}
+		}
+	}
+
 	void HandleSliderManager::_registerSlider(HandleSlider* slider)
 	{
 		mSliders.insert(slider);
+		mVersion++;
 	}
 
 	void HandleSliderManager::_unregisterSlider(HandleSlider* slider)
 	{
 		mSliders.erase(slider);
+		mVersion++;
 
 		for(auto& entry : mStates)
 		{
@@ -3,6 +3,8 @@
 #pragma once
 
 #include "BsEditorPrerequisites.h"
+#include "Math/BsMatrix4.h"
+#include "Math/BsRect2I.h"
 
 namespace bs
 {
@@ -10,14 +12,46 @@ namespace bs
 	 *  @{
 	 */
 
-	/** Controls all instantiated HandleSlider%s. */
+	/**
+	 * Controls all instantiated HandleSlider%s. Sliders are sorted into a screen-space grid for each camera, so that
+	 * pointer queries only need to test the sliders near the pointer. The grid is only rebuilt when the camera or any of
+	 * the sliders change.
+	 */
 	class BS_ED_EXPORT HandleSliderManager
 	{
+		/** Screen-space grid of sliders, as seen from a particular camera. */
+		struct SliderGrid
+		{
+			bool isBuilt = false;
+			UINT32 version = 0; /**< Value of HandleSliderManager::mVersion at the time the grid was built. */
+
+			/** Camera properties at the time the grid was built. */
+			Matrix4 viewMatrix;
+			Matrix4 projMatrix;
+			Rect2I area;
+			UINT64 layers = 0;
+
+			UINT32 numCellsX = 0;
+			UINT32 numCellsY = 0;
+
+			/**
+			 * Sliders in each cell, stored contiguously. Sliders of cell i are in range
+			 * [cellStarts[i], cellStarts[i + 1]).
+			 */
+			Vector<UINT32> cellStarts;
+			Vector<HandleSlider*> cellSliders;
+
+			/** Sliders whose bounds could not be determined and that must always be tested. */
+			Vector<HandleSlider*> unboundedSliders;
+		};
+
 		/** Contains active/hover sliders for each camera. */
 		struct StatePerCamera
 		{
 			HandleSlider* activeSlider = nullptr;
 			HandleSlider* hoverSlider = nullptr;
+
+			SliderGrid grid;
 		};
 
 	public:
@@ -51,7 +85,22 @@ namespace bs
 		/**	Unregisters a previously instantiated slider. */
 		void _unregisterSlider(HandleSlider* slider);
 
+		/** Notifies the manager that a slider was moved, enabled or disabled, and the slider grids must be rebuilt. */
+		void _notifySliderModified() { mVersion++; }
+
 	private:
+		/** Size of a single grid cell, in pixels. */
+		static const UINT32 GRID_CELL_SIZE;
+
+		/**
+		 * Sliders covering more than this portion of the grid cells are always tested instead of being added to the
+		 * cells, to keep the grid size in check.
+		 */
+		static const float MAX_SLIDER_COVERAGE;
+
+		/** Rebuilds the grid if the camera or sliders changed since it was last built. */
+		void updateGrid(const SPtr<Camera>& camera, SliderGrid& grid);
+
 
 		/**
 		 * Attempts to find slider at the specified position.
@@ -60,10 +109,11 @@ namespace bs
 		 * @param[in]	inputPos	Position of the pointer.
 		 * @return					Slider if we're intersecting with one, or null otherwise.
 		 */
-		HandleSlider* findUnderCursor(const SPtr<Camera>& camera, const Vector2I& inputPos) const;
+		HandleSlider* findUnderCursor(const SPtr<Camera>& camera, const Vector2I& inputPos);
 
 		UnorderedMap<UINT64, StatePerCamera> mStates;
 		UnorderedSet<HandleSlider*> mSliders;
+		UINT32 mVersion = 0;
 	};
 
 	/** @} */
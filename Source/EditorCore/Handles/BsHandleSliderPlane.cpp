@@ -5,6 +5,7 @@
 #include "Handles/BsHandleSliderManager.h"
 #include "Math/BsVector3.h"
 #include "Math/BsRay.h"
+#include "Math/BsSphere.h"
 #include "Math/BsPlane.h"
 #include "Renderer/BsCamera.h"
 
@@ -48,6 +49,12 @@ namespace bs
 		return false;
 	}
 
+	bool HandleSliderPlane::getScreenBounds(const SPtr<Camera>& camera, Rect2I& bounds) const
+	{
+		Sphere localBounds(mCollider.getCenter(), mLength * 0.5f * Math::sqrt(2.0f));
+		return calculateScreenBounds(camera, localBounds, bounds);
+	}
+
 	void HandleSliderPlane::activate(const SPtr<Camera>& camera, const Vector2I& pointerPos)
 	{
 		mStartPlanePosition = getPosition();
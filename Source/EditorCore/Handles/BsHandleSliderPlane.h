@@ -41,6 +41,9 @@ namespace bs
 		/** @copydoc HandleSlider::handleInput */
 		void handleInput(const SPtr<Camera>& camera, const Vector2I& inputDelta) override;
 
+		/** @copydoc HandleSlider::getScreenBounds */
+		bool getScreenBounds(const SPtr<Camera>& camera, Rect2I& bounds) const override;
+
 		/**
 		 * Returns a delta value that is the result of dragging/sliding the pointer along the plane. Returned movement is
 		 * in terms of the two directions originally provided when constructing the slider. This changes every frame and
@@ -44,6 +44,11 @@ namespace bs
 		return false;
 	}
 
+	bool HandleSliderSphere::getScreenBounds(const SPtr<Camera>& camera, Rect2I& bounds) const
+	{
+		return calculateScreenBounds(camera, mSphereCollider, bounds);
+	}
+
 	void HandleSliderSphere::handleInput(const SPtr<Camera>& camera, const Vector2I& inputDelta)
 	{
 		// Do nothing
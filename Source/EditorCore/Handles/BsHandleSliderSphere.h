@@ -36,6 +36,9 @@ namespace bs
 		/** @copydoc	HandleSlider::handleInput */
 		void handleInput(const SPtr<Camera>& camera, const Vector2I& inputDelta) override;
 
+		/** @copydoc HandleSlider::getScreenBounds */
+		bool getScreenBounds(const SPtr<Camera>& camera, Rect2I& bounds) const override;
+
 	protected:
 		Sphere mSphereCollider;
 	};
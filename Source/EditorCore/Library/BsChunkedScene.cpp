@@ -0,0 +1,611 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "Library/BsChunkedScene.h"
+#include "Scene/BsSceneObject.h"
+#include "Scene/BsComponent.h"
+#include "Scene/BsGameObjectManager.h"
+#include "Scene/BsPrefabInstanceRegistry.h"
+#include "Serialization/BsMemorySerializer.h"
+#include "Serialization/BsBinarySerializer.h"
+#include "Serialization/BsSerializedObject.h"
+#include "FileSystem/BsFileSystem.h"
+#include "FileSystem/BsDataStream.h"
+#include "Debug/BsDebug.h"
+#include <chrono>
+
+namespace bs
+{
+	const char* ChunkedScene::TOC_FILE_NAME = "Contents.toc";
+	const char* ChunkedScene::CHUNK_EXTENSION = ".chunk";
+
+	/** Identifies the table of contents file, and its version. */
+	static constexpr UINT32 TOC_MAGIC = 0x53434842; // "BHCS"
+	static constexpr UINT32 TOC_VERSION = 2;
+
+	ChunkedScene::ChunkedScene(const Path& folder)
+		:mFolder(folder)
+	{
+		mFolder.makeAbsolute(FileSystem::getWorkingDirectoryPath());
+
+		if (FileSystem::exists(Path::combine(mFolder, TOC_FILE_NAME)))
+			readTableOfContents();
+	}
+
+	ChunkedScene::~ChunkedScene()
+	{
+		abortLoad();
+	}
+
+	ChunkedSceneSaveStats ChunkedScene::save(const HSceneObject& root)
+	{
+		ChunkedSceneSaveStats stats;
+
+		if (!FileSystem::exists(mFolder))
+			FileSystem::createDir(mFolder);
+
+		// Find all the chunks first, so references to objects in chunks that follow can be resolved
+		Vector<HSceneObject> children;
+		Vector<LoadedChunk> loadedChunks;
+		UnorderedMap<UINT64, std::pair<UINT32, UINT32>> instanceToObject; // Instance ID -> (chunk, object index)
+
+		UINT32 numChildren = root->getNumChildren();
+		for (UINT32 i = 0; i < numChildren; i++)
+		{
+			HSceneObject child = root->getChild(i);
+			if (child->hasFlag(SOF_DontSave))
+				continue;
+
+			UINT32 chunkIdx = (UINT32)children.size();
+			children.push_back(child);
+			loadedChunks.push_back(LoadedChunk());
+
+			Vector<UINT64>& instanceIds = loadedChunks.back().instanceIds;
+			getInstanceIds(child, instanceIds);
+
+			for (UINT32 j = 0; j < (UINT32)instanceIds.size(); j++)
+				instanceToObject[instanceIds[j]] = std::make_pair(chunkIdx, j);
+		}
+
+		Vector<ChunkedSceneEntry> entries(children.size());
+		UnorderedMap<UINT64, UINT32> instanceToEntry;
+		Vector<bool> isEntryUsed(mEntries.size(), false);
+
+		for (UINT32 i = 0; i < (UINT32)children.size(); i++)
+		{
+			const HSceneObject& child = children[i];
+			ChunkedSceneEntry& entry = entries[i];
+			LoadedChunk& loadedChunk = loadedChunks[i];
+
+			UINT32 size = 0;
+			UINT8* data = encode(child, size);
+			UINT64 dataHash = hash(data, size);
+
+			bool isModified = true;
+
+			auto iterFind = mInstanceToEntry.find(child->getInstanceId());
+			if (iterFind != mInstanceToEntry.end())
+			{
+				entry = mEntries[iterFind->second];
+				isEntryUsed[iterFind->second] = true;
+
+				isModified = entry.hash != dataHash || entry.size != size ||
+					!FileSystem::exists(getChunkPath(entry.uuid));
+
+				if (!isModified)
+					loadedChunk.referenceIds = mLoadedChunks[iterFind->second].referenceIds;
+			}
+			else
+				entry.uuid = UUIDGenerator::generateRandom();
+
+			entry.name = child->getName();
+
+			if (isModified)
+			{
+				SPtr<DataStream> stream = FileSystem::createAndOpenFile(getChunkPath(entry.uuid));
+				stream->write(data, size);
+				stream->close();
+
+				entry.hash = dataHash;
+				entry.size = size;
+				entry.objectIds = loadedChunk.instanceIds;
+				entry.references.clear();
+
+				// Find handles to objects outside of the chunk. The file stores the live instance IDs.
+				UnorderedSet<UINT64> internalIds(entry.objectIds.begin(), entry.objectIds.end());
+
+				BinarySerializer bs;
+				SPtr<SerializedObject> serialized = bs._decodeToIntermediate(data, size);
+
+				loadedChunk.referenceIds.clear();
+				visitInstanceIds(*serialized, true, [&](UINT64& id)
+				{
+					if (id == 0 || internalIds.find(id) != internalIds.end())
+						return;
+
+					internalIds.insert(id);
+
+					ChunkedSceneReference reference;
+					reference.id = id;
+
+					entry.references.push_back(reference);
+					loadedChunk.referenceIds.push_back(id);
+				});
+
+				stats.numChunksWritten++;
+				stats.bytesWritten += size;
+			}
+
+			bs_free(data);
+
+			// Referenced objects might have moved, even if this chunk didn't change
+			for (UINT32 j = 0; j < (UINT32)entry.references.size(); j++)
+			{
+				ChunkedSceneReference& reference = entry.references[j];
+
+				auto iterFindObject = instanceToObject.find(loadedChunk.referenceIds[j]);
+				if (iterFindObject != instanceToObject.end())
+				{
+					reference.chunk = entries[iterFindObject->second.first].uuid;
+					reference.index = iterFindObject->second.second;
+				}
+				else
+				{
+					reference.chunk = UUID();
+					reference.index = 0;
+				}
+			}
+
+			instanceToEntry[child->getInstanceId()] = i;
+		}
+
+		// Delete chunks of scene objects that were removed or re-parented
+		for (UINT32 i = 0; i < (UINT32)mEntries.size(); i++)
+		{
+			if (isEntryUsed[i])
+				continue;
+
+			Path chunkPath = getChunkPath(mEntries[i].uuid);
+			if (FileSystem::exists(chunkPath))
+				FileSystem::remove(chunkPath);
+
+			stats.numChunksRemoved++;
+		}
+
+		mEntries = std::move(entries);
+		mLoadedChunks = std::move(loadedChunks);
+		mInstanceToEntry = std::move(instanceToEntry);
+
+		mUUIDToEntry.clear();
+		for (UINT32 i = 0; i < (UINT32)mEntries.size(); i++)
+			mUUIDToEntry[mEntries[i].uuid] = i;
+
+		writeTableOfContents();
+
+		stats.numChunks = (UINT32)mEntries.size();
+		return stats;
+	}
+
+	void ChunkedScene::beginLoad(const HSceneObject& parent)
+	{
+		abortLoad();
+
+		mInstanceToEntry.clear();
+
+		if (!readTableOfContents())
+		{
+			LOGERR("Cannot load chunked scene. Missing or corrupt table of contents in: \"" + mFolder.toString() + "\"");
+			return;
+		}
+
+		mLoadParent = parent;
+		mIsLoading = !mEntries.empty();
+	}
+
+	bool ChunkedScene::loadStep(float maxTimeMs)
+	{
+		typedef std::chrono::high_resolution_clock Clock;
+
+		if (!mIsLoading)
+			return true;
+
+		Clock::time_point start = Clock::now();
+		do
+		{
+			loadNext();
+		} while (mNextLoadEntry < (UINT32)mEntries.size() &&
+			std::chrono::duration<float, std::milli>(Clock::now() - start).count() < maxTimeMs);
+
+		if (mNextLoadEntry >= (UINT32)mEntries.size())
+		{
+			mIsLoading = false;
+			mLoadParent = nullptr;
+		}
+
+		return !mIsLoading;
+	}
+
+	void ChunkedScene::loadNext()
+	{
+		// Chunks referenced by the chunks being loaded that aren't loaded yet need to be decoded in the same session, in
+		// order to resolve the references. Extend the group up to the last such chunk, so chunks remain in order.
+		UINT32 firstEntry = mNextLoadEntry;
+		UINT32 lastEntry = firstEntry;
+		for (UINT32 i = firstEntry; i <= lastEntry; i++)
+		{
+			for (auto& reference : mEntries[i].references)
+			{
+				auto iterFind = mUUIDToEntry.find(reference.chunk);
+				if (iterFind != mUUIDToEntry.end())
+					lastEntry = std::max(lastEntry, iterFind->second);
+			}
+		}
+
+		UINT32 numEntries = lastEntry - firstEntry + 1;
+		mNextLoadEntry = lastEntry + 1;
+
+		// Objects in the group are assigned keys instead of their stored instance IDs, as instance IDs stored in different
+		// chunk files could clash with each other, or with the instance IDs of live objects they reference
+		Vector<UINT64> keyOffsets(numEntries + 1, 0);
+		for (UINT32 i = 0; i < numEntries; i++)
+			keyOffsets[i + 1] = keyOffsets[i] + mEntries[firstEntry + i].objectIds.size();
+
+		Vector<SPtr<SerializedObject>> serializedObjects(numEntries);
+		UINT64 nextKey = keyOffsets[numEntries];
+		for (UINT32 i = 0; i < numEntries; i++)
+		{
+			const ChunkedSceneEntry& entry = mEntries[firstEntry + i];
+
+			Path chunkPath = getChunkPath(entry.uuid);
+			if (!FileSystem::isFile(chunkPath))
+			{
+				LOGERR("Missing scene chunk \"" + entry.name + "\" at path: \"" + chunkPath.toString() + "\"");
+				continue;
+			}
+
+			SPtr<DataStream> stream = FileSystem::openFile(chunkPath);
+			UINT32 size = (UINT32)stream->size();
+			UINT8* data = (UINT8*)bs_alloc(size);
+			stream->read(data, size);
+			stream->close();
+
+			BinarySerializer bs;
+			SPtr<SerializedObject> serialized = bs._decodeToIntermediate(data, size, true);
+			bs_free(data);
+
+			UnorderedMap<UINT64, UINT64> idToKey;
+			for (UINT32 j = 0; j < (UINT32)entry.objectIds.size(); j++)
+				idToKey[entry.objectIds[j]] = getObjectKey(keyOffsets[i] + j);
+
+			// Objects missing from the table of contents are kept, but cannot be referenced by other chunks
+			visitInstanceIds(*serialized, false, [&](UINT64& id)
+			{
+				auto iterFind = idToKey.find(id);
+				if (iterFind == idToKey.end())
+					iterFind = idToKey.insert(std::make_pair(id, getObjectKey(nextKey++))).first;
+
+				id = iterFind->second;
+			});
+
+			for (auto& reference : entry.references)
+				idToKey[reference.id] = resolveReference(reference, firstEntry, keyOffsets);
+
+			visitInstanceIds(*serialized, true, [&](UINT64& id)
+			{
+				auto iterFind = idToKey.find(id);
+				id = iterFind != idToKey.end() ? iterFind->second : 0;
+			});
+
+			serializedObjects[i] = serialized;
+		}
+
+		// References to objects loaded earlier now contain their actual instance IDs, and are restored as external
+		Vector<HSceneObject> sceneObjects(numEntries);
+		GameObjectManager::instance().startDeserialization();
+		GameObjectManager::instance().setDeserializationMode(GODM_UseNewIds | GODM_RestoreExternal);
+
+		for (UINT32 i = 0; i < numEntries; i++)
+		{
+			if (serializedObjects[i] == nullptr)
+				continue;
+
+			BinarySerializer bs;
+			SPtr<SceneObject> sceneObject = std::static_pointer_cast<SceneObject>(
+				bs._decodeFromIntermediate(serializedObjects[i]));
+
+			sceneObjects[i] = sceneObject->getHandle();
+		}
+
+		GameObjectManager::instance().endDeserialization();
+
+		for (UINT32 i = 0; i < numEntries; i++)
+		{
+			UINT32 entryIdx = firstEntry + i;
+			LoadedChunk& loadedChunk = mLoadedChunks[entryIdx];
+
+			const HSceneObject& sceneObject = sceneObjects[i];
+			if (sceneObject == nullptr)
+				continue;
+
+			sceneObject->setParent(mLoadParent, false);
+			sceneObject->_instantiate();
+			PrefabInstanceRegistry::instance().registerInstances(sceneObject);
+
+			loadedChunk.instanceIds.clear();
+			getInstanceIds(sceneObject, loadedChunk.instanceIds);
+
+			// Encoded data contains instance IDs, which are new after loading. Re-encode to get the hash the next save
+			// will be compared against, otherwise every chunk would be rewritten on the first save.
+			ChunkedSceneEntry& entry = mEntries[entryIdx];
+
+			UINT32 newSize = 0;
+			UINT8* newData = encode(sceneObject, newSize);
+			entry.hash = hash(newData, newSize);
+			entry.size = newSize;
+			bs_free(newData);
+
+			mInstanceToEntry[sceneObject->getInstanceId()] = entryIdx;
+		}
+
+		// Record the live objects the references point to, so they can be stored again if the referenced chunks change.
+		// All chunks in the group are now loaded, so references resolve to instance IDs.
+		for (UINT32 i = firstEntry; i <= lastEntry; i++)
+		{
+			LoadedChunk& loadedChunk = mLoadedChunks[i];
+			loadedChunk.referenceIds.clear();
+
+			for (auto& reference : mEntries[i].references)
+				loadedChunk.referenceIds.push_back(resolveReference(reference, mNextLoadEntry, keyOffsets));
+		}
+	}
+
+	UINT64 ChunkedScene::resolveReference(const ChunkedSceneReference& reference, UINT32 firstEntry,
+		const Vector<UINT64>& keyOffsets) const
+	{
+		auto iterFind = mUUIDToEntry.find(reference.chunk);
+		if (iterFind == mUUIDToEntry.end())
+			return 0;
+
+		UINT32 entryIdx = iterFind->second;
+		if (entryIdx < firstEntry)
+		{
+			const Vector<UINT64>& instanceIds = mLoadedChunks[entryIdx].instanceIds;
+			return reference.index < (UINT32)instanceIds.size() ? instanceIds[reference.index] : 0;
+		}
+
+		if (reference.index >= (UINT32)mEntries[entryIdx].objectIds.size())
+			return 0;
+
+		return getObjectKey(keyOffsets[entryIdx - firstEntry] + reference.index);
+	}
+
+	void ChunkedScene::abortLoad()
+	{
+		mNextLoadEntry = 0;
+		mIsLoading = false;
+		mLoadParent = nullptr;
+	}
+
+	void ChunkedScene::loadAll()
+	{
+		while (!loadStep(std::numeric_limits<float>::max()))
+		{ }
+	}
+
+	float ChunkedScene::getLoadProgress() const
+	{
+		if (mEntries.empty())
+			return 1.0f;
+
+		return mNextLoadEntry / (float)mEntries.size();
+	}
+
+	bool ChunkedScene::readTableOfContents()
+	{
+		mEntries.clear();
+		mLoadedChunks.clear();
+		mUUIDToEntry.clear();
+
+		Path tocPath = Path::combine(mFolder, TOC_FILE_NAME);
+		if (!FileSystem::isFile(tocPath))
+			return false;
+
+		SPtr<DataStream> stream = FileSystem::openFile(tocPath);
+
+		auto readString = [&stream](String& output)
+		{
+			UINT32 length = 0;
+			if (stream->read(&length, sizeof(length)) != sizeof(length) || length > stream->size())
+				return false;
+
+			output.resize(length);
+			return length == 0 || stream->read(&output[0], length) == length;
+		};
+
+		auto readArraySize = [&stream](UINT32& output, UINT32 elementSize)
+		{
+			return stream->read(&output, sizeof(output)) == sizeof(output) &&
+				(UINT64)output * elementSize <= stream->size();
+		};
+
+		UINT32 header[3] = { 0, 0, 0 }; // Magic, version, number of entries
+		if (stream->read(header, sizeof(header)) != sizeof(header) || header[0] != TOC_MAGIC ||
+			header[1] != TOC_VERSION)
+		{
+			return false;
+		}
+
+		mEntries.resize(header[2]);
+		for (auto& entry : mEntries)
+		{
+			String uuid;
+			UINT32 numObjects = 0;
+			if (!readString(uuid) || !readString(entry.name) ||
+				stream->read(&entry.hash, sizeof(entry.hash)) != sizeof(entry.hash) ||
+				stream->read(&entry.size, sizeof(entry.size)) != sizeof(entry.size) ||
+				!readArraySize(numObjects, sizeof(UINT64)))
+			{
+				mEntries.clear();
+				return false;
+			}
+
+			entry.uuid = UUID(uuid);
+			entry.objectIds.resize(numObjects);
+
+			UINT32 numReferences = 0;
+			UINT32 objectIdsSize = numObjects * sizeof(UINT64);
+			if ((numObjects > 0 && stream->read(entry.objectIds.data(), objectIdsSize) != objectIdsSize) ||
+				!readArraySize(numReferences, sizeof(UINT64) + sizeof(UINT32) * 2))
+			{
+				mEntries.clear();
+				return false;
+			}
+
+			entry.references.resize(numReferences);
+			for (auto& reference : entry.references)
+			{
+				String chunkUUID;
+				if (stream->read(&reference.id, sizeof(reference.id)) != sizeof(reference.id) ||
+					!readString(chunkUUID) ||
+					stream->read(&reference.index, sizeof(reference.index)) != sizeof(reference.index))
+				{
+					mEntries.clear();
+					return false;
+				}
+
+				reference.chunk = UUID(chunkUUID);
+			}
+		}
+
+		mLoadedChunks.resize(mEntries.size());
+		for (UINT32 i = 0; i < (UINT32)mEntries.size(); i++)
+			mUUIDToEntry[mEntries[i].uuid] = i;
+
+		return true;
+	}
+
+	void ChunkedScene::writeTableOfContents() const
+	{
+		SPtr<DataStream> stream = FileSystem::createAndOpenFile(Path::combine(mFolder, TOC_FILE_NAME));
+
+		auto writeString = [&stream](const String& input)
+		{
+			UINT32 length = (UINT32)input.size();
+			stream->write(&length, sizeof(length));
+			stream->write(input.data(), length);
+		};
+
+		UINT32 header[3] = { TOC_MAGIC, TOC_VERSION, (UINT32)mEntries.size() };
+		stream->write(header, sizeof(header));
+
+		for (auto& entry : mEntries)
+		{
+			writeString(entry.uuid.toString());
+			writeString(entry.name);
+			stream->write(&entry.hash, sizeof(entry.hash));
+			stream->write(&entry.size, sizeof(entry.size));
+
+			UINT32 numObjects = (UINT32)entry.objectIds.size();
+			stream->write(&numObjects, sizeof(numObjects));
+			stream->write(entry.objectIds.data(), numObjects * sizeof(UINT64));
+
+			UINT32 numReferences = (UINT32)entry.references.size();
+			stream->write(&numReferences, sizeof(numReferences));
+
+			for (auto& reference : entry.references)
+			{
+				stream->write(&reference.id, sizeof(reference.id));
+				writeString(reference.chunk.toString());
+				stream->write(&reference.index, sizeof(reference.index));
+			}
+		}
+
+		stream->close();
+	}
+
+	Path ChunkedScene::getChunkPath(const UUID& uuid) const
+	{
+		return Path::combine(mFolder, uuid.toString() + CHUNK_EXTENSION);
+	}
+
+	UINT8* ChunkedScene::encode(const HSceneObject& sceneObject, UINT32& size)
+	{
+		bool isInstantiated = !sceneObject->hasFlag(SOF_DontInstantiate);
+		sceneObject->_setFlags(SOF_DontInstantiate);
+
+		MemorySerializer serializer;
+		UINT8* data = serializer.encode(sceneObject.get(), size);
+
+		if (isInstantiated)
+			sceneObject->_unsetFlags(SOF_DontInstantiate);
+
+		return data;
+	}
+
+	UINT64 ChunkedScene::hash(const UINT8* data, UINT32 size)
+	{
+		// FNV-1a
+		UINT64 output = 14695981039346656037ULL;
+		for (UINT32 i = 0; i < size; i++)
+		{
+			output ^= data[i];
+			output *= 1099511628211ULL;
+		}
+
+		return output;
+	}
+
+	void ChunkedScene::getInstanceIds(const HSceneObject& sceneObject, Vector<UINT64>& output)
+	{
+		output.push_back(sceneObject->getInstanceId());
+
+		const Vector<HComponent>& components = sceneObject->getComponents();
+		for (auto& component : components)
+			output.push_back(component->getInstanceId());
+
+		UINT32 numChildren = sceneObject->getNumChildren();
+		for (UINT32 i = 0; i < numChildren; i++)
+		{
+			HSceneObject child = sceneObject->getChild(i);
+			if (!child->hasFlag(SOF_DontSave))
+				getInstanceIds(child, output);
+		}
+	}
+
+	void ChunkedScene::visitInstanceIds(SerializedObject& object, bool handles,
+		const std::function<void(UINT64&)>& visitor)
+	{
+		std::function<void(const SPtr<SerializedInstance>&)> visitInstance;
+		visitInstance = [&](const SPtr<SerializedInstance>& instance)
+		{
+			if (instance == nullptr)
+				return;
+
+			if (instance->getTypeId() == TID_SerializedObject)
+				visitInstanceIds(static_cast<SerializedObject&>(*instance), handles, visitor);
+			else if (instance->getTypeId() == TID_SerializedArray)
+			{
+				SerializedArray& array = static_cast<SerializedArray&>(*instance);
+				for (auto& entry : array.entries)
+					visitInstance(entry.second.serialized);
+			}
+		};
+
+		// Both game objects and their handles store the instance ID as their first field
+		UINT32 idTypeId = handles ? TID_GameObjectHandleBase : TID_GameObject;
+		for (auto& subObject : object.subObjects)
+		{
+			for (auto& entryPair : subObject.entries)
+			{
+				SerializedEntry& entry = entryPair.second;
+				if (subObject.typeId == idTypeId && entry.fieldId == 0)
+				{
+					SPtr<SerializedField> field = std::static_pointer_cast<SerializedField>(entry.serialized);
+					if (field != nullptr && field->size == sizeof(UINT64))
+						visitor(*(UINT64*)field->value);
+				}
+				else
+					visitInstance(entry.serialized);
+			}
+		}
+	}
+}
@@ -0,0 +1,196 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsEditorPrerequisites.h"
+#include "Utility/BsUUID.h"
+
+namespace bs
+{
+	/** @addtogroup Library
+	 *  @{
+	 */
+
+	/** Reference from a game object handle in one chunk, to a game object stored in another chunk. */
+	struct ChunkedSceneReference
+	{
+		UINT64 id = 0; /**< Instance ID the handle is stored with in the chunk file. */
+		UUID chunk; /**< Identifier of the chunk containing the referenced object. Empty if the object wasn't found. */
+		UINT32 index = 0; /**< Index of the referenced object in ChunkedSceneEntry::objectIds of its chunk. */
+	};
+
+	/** Entry in the table of contents of a ChunkedScene, describing a single chunk. */
+	struct ChunkedSceneEntry
+	{
+		UUID uuid; /**< Persistent identifier of the chunk, also used as the name of the chunk file. */
+		String name; /**< Name of the top-level scene object stored in the chunk. */
+		UINT64 hash = 0; /**< Hash of the encoded subtree, used for detecting which chunks changed. */
+		UINT32 size = 0; /**< Size of the encoded subtree, in bytes. */
+
+		/**
+		 * Instance IDs the game objects of the subtree are stored with in the chunk file. Each scene object is followed
+		 * by its components and then by its children.
+		 */
+		Vector<UINT64> objectIds;
+
+		/** References from handles in the chunk to game objects in other chunks. */
+		Vector<ChunkedSceneReference> references;
+	};
+
+	/** Information about the chunks written during a single ChunkedScene::save() call. */
+	struct ChunkedSceneSaveStats
+	{
+		UINT32 numChunks = 0; /**< Total number of chunks in the scene. */
+		UINT32 numChunksWritten = 0; /**< Number of chunks that were new or changed, and were written to disk. */
+		UINT32 numChunksRemoved = 0; /**< Number of chunks whose scene objects no longer exist, and were deleted. */
+		UINT64 bytesWritten = 0; /**< Number of bytes of chunk data written to disk. */
+	};
+
+	/**
+	 * Saves and loads a scene as a set of chunks, one per top-level scene object, in a folder with a table of contents.
+	 * Unlike a scene prefab, which is encoded and decoded as a whole, saves only rewrite chunks whose subtrees changed,
+	 * and loads can be spread over multiple frames, decoding and instantiating one subtree at a time.
+	 *
+	 * Chunks are matched to scene objects by their instance ID. The instance IDs are recorded whenever a chunk is saved
+	 * or loaded through this object, so the same object should be used for the lifetime of the loaded scene.
+	 *
+	 * References between objects in different chunks are stored in the table of contents relative to the chunk of the
+	 * referenced object, and are mapped to the instance IDs of the live objects as chunks are loaded. Chunks are loaded
+	 * in order, and a chunk that references a later one is loaded together with all the chunks up to it, so references
+	 * are always resolved at the time a chunk is decoded.
+	 *
+	 * @note	Components on the scene root itself are not saved.
+	 */
+	class BS_ED_EXPORT ChunkedScene
+	{
+	public:
+		/**
+		 * Constructs a new chunked scene. The table of contents is read from the provided folder if one exists.
+		 *
+		 * @param[in]	folder	Folder in which to store the table of contents and the chunk files.
+		 */
+		ChunkedScene(const Path& folder);
+		~ChunkedScene();
+
+		/** Returns the folder in which the table of contents and the chunk files are stored. */
+		const Path& getFolder() const { return mFolder; }
+
+		/** Returns information about all the chunks, in the order their scene objects appear under the root. */
+		const Vector<ChunkedSceneEntry>& getEntries() const { return mEntries; }
+
+		/**
+		 * Saves all children of @p root into their own chunks. Only chunks whose encoded contents changed since the last
+		 * save or load are written, and chunks of scene objects that no longer exist are deleted.
+		 */
+		ChunkedSceneSaveStats save(const HSceneObject& root);
+
+		/**
+		 * Starts loading the chunks, instantiating their scene objects as children of @p parent. Chunks are loaded by
+		 * calling loadStep() until it returns true.
+		 */
+		void beginLoad(const HSceneObject& parent);
+
+		/**
+		 * Loads chunks until the provided time budget is exceeded. Each chunk, or group of chunks if it references later
+		 * ones, is decoded in its own game object deserialization session and instantiated right away, so other objects
+		 * can be deserialized between the calls. At least one chunk is always loaded per call.
+		 *
+		 * @param[in]	maxTimeMs	Maximum amount of time to spend loading, in milliseconds.
+		 * @return					True if all chunks have been loaded, false otherwise.
+		 */
+		bool loadStep(float maxTimeMs);
+
+		/** Loads and instantiates all remaining chunks. */
+		void loadAll();
+
+		/** Checks is the scene currently being loaded. */
+		bool isLoading() const { return mIsLoading; }
+
+		/**
+		 * Returns the percentage of chunks that have been loaded since the last call to beginLoad(), in [0, 1] range.
+		 */
+		float getLoadProgress() const;
+
+		/** Name of the file containing the table of contents, relative to the scene folder. */
+		static const char* TOC_FILE_NAME;
+
+		/** Extension of the individual chunk files. */
+		static const char* CHUNK_EXTENSION;
+
+	private:
+		/** Information about a loaded chunk that is only valid while its objects are alive, and isn't saved. */
+		struct LoadedChunk
+		{
+			/** Instance IDs of the live game objects, in the same order as ChunkedSceneEntry::objectIds. */
+			Vector<UINT64> instanceIds;
+
+			/** Instance IDs of the live game objects referenced by ChunkedSceneEntry::references, in the same order. */
+			Vector<UINT64> referenceIds;
+		};
+
+		/**
+		 * Decodes and instantiates the next chunk, along with any following chunks it references, within a single
+		 * deserialization session.
+		 */
+		void loadNext();
+
+		/**
+		 * Resolves a reference from a chunk loaded as a part of the group starting at @p firstEntry. References to objects
+		 * in chunks loaded earlier resolve to their instance IDs, and references to objects in the group to their keys
+		 * (see getObjectKey()). Returns 0 if the referenced object doesn't exist.
+		 */
+		UINT64 resolveReference(const ChunkedSceneReference& reference, UINT32 firstEntry,
+			const Vector<UINT64>& keyOffsets) const;
+
+		/** Stops the load in progress, if any. Chunks that were already loaded remain in the scene. */
+		void abortLoad();
+
+		/** Reads the table of contents from the scene folder. Returns false if it doesn't exist or is corrupt. */
+		bool readTableOfContents();
+
+		/** Writes the current table of contents into the scene folder. */
+		void writeTableOfContents() const;
+
+		/** Returns the path to the file storing the chunk with the provided identifier. */
+		Path getChunkPath(const UUID& uuid) const;
+
+		/**
+		 * Encodes the provided scene object and all its children. The returned buffer must be freed with bs_free().
+		 * The object is encoded without instantiation, so decoding it doesn't add the copy to the scene.
+		 */
+		static UINT8* encode(const HSceneObject& sceneObject, UINT32& size);
+
+		/** Returns a hash of the provided memory block. */
+		static UINT64 hash(const UINT8* data, UINT32 size);
+
+		/**
+		 * Appends the instance IDs of the provided scene object and all its components and children to @p output, in the
+		 * order described by ChunkedSceneEntry::objectIds.
+		 */
+		static void getInstanceIds(const HSceneObject& sceneObject, Vector<UINT64>& output);
+
+		/**
+		 * Calls @p visitor for the instance ID of every game object (if @p handles is false) or of every game object
+		 * handle (if @p handles is true) in the provided intermediate representation of an encoded object.
+		 */
+		static void visitInstanceIds(SerializedObject& object, bool handles, const std::function<void(UINT64&)>& visitor);
+
+		/**
+		 * Returns the instance ID game objects being decoded are assigned in their intermediate representation, so that
+		 * it cannot clash with instance IDs of the live objects they reference.
+		 */
+		static UINT64 getObjectKey(UINT64 index) { return index | (1ULL << 63); }
+
+		Path mFolder;
+		Vector<ChunkedSceneEntry> mEntries;
+		Vector<LoadedChunk> mLoadedChunks;
+		UnorderedMap<UUID, UINT32> mUUIDToEntry;
+		UnorderedMap<UINT64, UINT32> mInstanceToEntry;
+
+		bool mIsLoading = false;
+		HSceneObject mLoadParent;
+		UINT32 mNextLoadEntry = 0;
+	};
+
+	/** @} */
+}
@@ -0,0 +1,103 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "Library/BsFileChangeBatcher.h"
+
+namespace bs
+{
+	FileChangeBatcher::FileChangeBatcher(UINT64 debounceMs, UINT64 maxDelayMs)
+		:mDebounceMs(debounceMs), mMaxDelayMs(maxDelayMs)
+	{ }
+
+	void FileChangeBatcher::addChange(const Path& path, UINT64 timeMs)
+	{
+		if (mPendingPaths.empty())
+			mFirstChangeTimeMs = timeMs;
+
+		mLastChangeTimeMs = timeMs;
+		mNumChangesReceived++;
+
+		mPendingPaths.insert(path);
+	}
+
+	void FileChangeBatcher::addRename(const Path& from, const Path& to, UINT64 timeMs)
+	{
+		addChange(from, timeMs);
+		addChange(to, timeMs);
+
+		// Counts as a single notification
+		mNumChangesReceived--;
+	}
+
+	Vector<Path> FileChangeBatcher::update(UINT64 timeMs)
+	{
+		if (mPendingPaths.empty())
+			return Vector<Path>();
+
+		bool isSettled = (timeMs - mLastChangeTimeMs) >= mDebounceMs;
+		bool isOverdue = (timeMs - mFirstChangeTimeMs) >= mMaxDelayMs;
+		if (!isSettled && !isOverdue)
+			return Vector<Path>();
+
+		return flush();
+	}
+
+	Vector<Path> FileChangeBatcher::flush()
+	{
+		Vector<Path> output = fold(mPendingPaths);
+		mPendingPaths.clear();
+
+		return output;
+	}
+
+	Vector<Path> FileChangeBatcher::coalesce(const Vector<Path>& paths, UINT32 minPathsPerFolder)
+	{
+		UnorderedMap<Path, UINT32> numPathsPerFolder;
+		for (auto& entry : paths)
+			numPathsPerFolder[entry.getParent()]++;
+
+		UnorderedSet<Path> coalescedPaths;
+		for (auto& entry : paths)
+		{
+			Path parent = entry.getParent();
+			if (numPathsPerFolder[parent] >= minPathsPerFolder)
+				coalescedPaths.insert(parent);
+			else
+				coalescedPaths.insert(entry);
+		}
+
+		return fold(coalescedPaths);
+	}
+
+	Vector<Path> FileChangeBatcher::fold(const UnorderedSet<Path>& paths)
+	{
+		Vector<std::pair<String, Path>> sortedPaths;
+		sortedPaths.reserve(paths.size());
+
+		for (auto& entry : paths)
+		{
+			// Separators sort before any other character, so the contents of a folder directly follow the folder
+			String key = entry.toString();
+			std::replace(key.begin(), key.end(), '/', '\x01');
+			std::replace(key.begin(), key.end(), '\\', '\x01');
+
+			sortedPaths.push_back(std::make_pair(key, entry));
+		}
+
+		// A path only needs to be checked against the last path kept, as that is either its parent folder or unrelated
+		std::sort(sortedPaths.begin(), sortedPaths.end(),
+			[](const std::pair<String, Path>& a, const std::pair<String, Path>& b) { return a.first < b.first; });
+
+		Vector<Path> output;
+		output.reserve(sortedPaths.size());
+
+		for (auto& entry : sortedPaths)
+		{
+			if (!output.empty() && output.back().includes(entry.second))
+				continue;
+
+			output.push_back(entry.second);
+		}
+
+		return output;
+	}
+}
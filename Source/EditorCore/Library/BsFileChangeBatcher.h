@@ -0,0 +1,90 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsEditorPrerequisites.h"
+
+namespace bs
+{
+	/** @addtogroup Library
+	 *  @{
+	 */
+
+	/**
+	 * Collects file system change notifications and reports them in batches, once a burst of changes settles down. Each
+	 * changed path is reported once per batch regardless of how many notifications were received for it, and paths within
+	 * a changed folder are folded into the folder itself. Used for refreshing the project library once per burst of
+	 * changes (e.g. a version control checkout), rather than once per notification.
+	 */
+	class BS_ED_EXPORT FileChangeBatcher
+	{
+	public:
+		/**
+		 * Constructs a new batcher.
+		 *
+		 * @param[in]	debounceMs	Time without any new changes after which the pending changes are reported.
+		 * @param[in]	maxDelayMs	Maximum time a change can remain pending, even if new changes keep arriving.
+		 */
+		FileChangeBatcher(UINT64 debounceMs = DEFAULT_DEBOUNCE_MS, UINT64 maxDelayMs = DEFAULT_MAX_DELAY_MS);
+
+		/** Registers a file or folder that was added, removed or modified. */
+		void addChange(const Path& path, UINT64 timeMs);
+
+		/** Registers a file or folder that was renamed. Both the old and the new path are reported as changed. */
+		void addRename(const Path& from, const Path& to, UINT64 timeMs);
+
+		/**
+		 * Checks if the pending changes should be reported and returns them if so, clearing the pending list. Should be
+		 * called once per frame.
+		 *
+		 * @param[in]	timeMs	Current time, in milliseconds, on the same timeline as the times provided when adding
+		 *						changes.
+		 * @return				Changed paths, sorted and without any paths that are contained in other changed folders.
+		 *						Empty if there are no pending changes, or they haven't settled down yet.
+		 */
+		Vector<Path> update(UINT64 timeMs);
+
+		/** Returns all the pending changes, regardless of how recent they are, and clears the pending list. */
+		Vector<Path> flush();
+
+		/**
+		 * Replaces paths that share a parent folder with the folder itself, if there are at least @p minPathsPerFolder of
+		 * them. Checking a folder once is cheaper than checking many of its files one by one.
+		 *
+		 * @param[in]	paths				Paths to coalesce.
+		 * @param[in]	minPathsPerFolder	Minimum number of paths in the same folder required for them to be replaced.
+		 * @return							Coalesced paths, sorted and without any paths that are contained in other
+		 *									folders in the list.
+		 */
+		static Vector<Path> coalesce(const Vector<Path>& paths, UINT32 minPathsPerFolder = DEFAULT_MIN_PATHS_PER_FOLDER);
+
+		/** Checks are there any changes that haven't been reported yet. */
+		bool hasPendingChanges() const { return !mPendingPaths.empty(); }
+
+		/** Returns the number of change notifications received since construction, including renames. */
+		UINT64 getNumChangesReceived() const { return mNumChangesReceived; }
+
+		/** Default time without any new changes after which the pending changes are reported, in milliseconds. */
+		static constexpr UINT64 DEFAULT_DEBOUNCE_MS = 100;
+
+		/** Default maximum time a change can remain pending, in milliseconds. */
+		static constexpr UINT64 DEFAULT_MAX_DELAY_MS = 1000;
+
+		/** Default minimum number of paths in the same folder for coalesce() to replace them with the folder. */
+		static constexpr UINT32 DEFAULT_MIN_PATHS_PER_FOLDER = 16;
+
+	private:
+		/** Sorts the provided paths and removes any paths contained in another folder from the set. */
+		static Vector<Path> fold(const UnorderedSet<Path>& paths);
+
+		UINT64 mDebounceMs;
+		UINT64 mMaxDelayMs;
+
+		UnorderedSet<Path> mPendingPaths;
+		UINT64 mFirstChangeTimeMs = 0;
+		UINT64 mLastChangeTimeMs = 0;
+		UINT64 mNumChangesReceived = 0;
+	};
+
+	/** @} */
+}
@@ -511,160 +511,191 @@ namespace bs
 						continue;
 					}
 				}
-
-				Vector<SubResourceRaw> subresources = queuedImport.importOp.getReturnValue<Vector<SubResourceRaw>>();
-				for(auto& entry : subresources)
-					queuedImport.resources.push_back({entry.name, entry.value});
 			}
 
-			FileEntry* fileEntry = iter->first;
+			finishQueuedImport(iter->first, queuedImport);
+			iter = mQueuedImports.erase(iter);
+		}
+	}
 
-			Path metaPath = fileEntry->path;
-			metaPath.setFilename(metaPath.getFilename() + ".meta");
+	bool ProjectLibrary::_finishQueuedImport(const Path& path)
+	{
+		Path fullPath = path;
+		if (!fullPath.isAbsolute())
+			fullPath.makeAbsolute(mResourcesFolder);
 
-			Vector<HResource> newResources;
-			if(fileEntry->meta == nullptr)
-			{
-				// Generate new resource handles and build the meta-file
-				fileEntry->meta = ProjectFileMeta::create(queuedImport.importOptions);
+		LibraryEntry* entry = findEntry(fullPath);
+		if (entry == nullptr || entry->type != LibraryEntryType::File)
+			return false;
 
-				for(auto& entry : queuedImport.resources)
-				{
-					HResource handle = gResources()._createResourceHandle(entry.resource);
-					newResources.push_back(handle);
+		FileEntry* fileEntry = static_cast<FileEntry*>(entry);
+		auto iterFind = mQueuedImports.find(fileEntry);
+		if (iterFind == mQueuedImports.end())
+			return false;
 
-					SPtr<ResourceMetaData> subMeta = handle->getMetaData();
-					const UINT32 typeId = handle->getTypeId();
-					const UUID& UUID = handle.getUUID();
-					Path::stripInvalid(entry.name);
+		QueuedImport& queuedImport = iterFind->second;
+		if (queuedImport.importOp != nullptr && !queuedImport.importOp.hasCompleted())
+			queuedImport.importOp.blockUntilComplete();
 
-					const ProjectResourceIcons icons = generatePreviewIcons(*handle);
+		finishQueuedImport(fileEntry, queuedImport);
 
-					const SPtr<ProjectResourceMeta> resMeta = 
-						ProjectResourceMeta::create(entry.name, UUID, typeId, icons, subMeta);
-					fileEntry->meta->add(resMeta);
-				}
+		// Finishing can queue imports of dependants, invalidating the iterator
+		mQueuedImports.erase(fileEntry);
+		return true;
+	}
 
-				if(!queuedImport.resources.empty())
-				{
-					HResource primary = newResources[0];
+	void ProjectLibrary::finishQueuedImport(FileEntry* fileEntry, QueuedImport& queuedImport)
+	{
+		if(queuedImport.importOp != nullptr)
+		{
+			Vector<SubResourceRaw> subresources = queuedImport.importOp.getReturnValue<Vector<SubResourceRaw>>();
+			for(auto& entry : subresources)
+				queuedImport.resources.push_back({entry.name, entry.value});
+		}
 
-					mUUIDToPath[primary.getUUID()] = fileEntry->path;
-					for (UINT32 i = 1; i < (UINT32)queuedImport.resources.size(); i++)
-					{
-						const QueuedImportResource& entry = queuedImport.resources[i];
+		Path metaPath = fileEntry->path;
+		metaPath.setFilename(metaPath.getFilename() + ".meta");
 
-						const UUID& UUID = newResources[i].getUUID();
-						mUUIDToPath[UUID] = fileEntry->path + entry.name;
-					}
-				}
+		Vector<HResource> newResources;
+		if(fileEntry->meta == nullptr)
+		{
+			// Generate new resource handles and build the meta-file
+			fileEntry->meta = ProjectFileMeta::create(queuedImport.importOptions);
 
-				FileEncoder fs(metaPath);
-				fs.encode(fileEntry->meta.get());
-			}
-			else
+			for(auto& entry : queuedImport.resources)
 			{
-				removeDependencies(fileEntry);
+				HResource handle = gResources()._createResourceHandle(entry.resource);
+				newResources.push_back(handle);
 
-				Vector<SPtr<ProjectResourceMeta>> existingResourceMetas = fileEntry->meta->getAllResourceMetaData();
-				fileEntry->meta->clearResourceMetaData();
+				SPtr<ResourceMetaData> subMeta = handle->getMetaData();
+				const UINT32 typeId = handle->getTypeId();
+				const UUID& UUID = handle.getUUID();
+				Path::stripInvalid(entry.name);
 
-				for (auto& entry : queuedImport.resources)
+				const ProjectResourceIcons icons = generatePreviewIcons(*handle);
+
+				const SPtr<ProjectResourceMeta> resMeta = 
+					ProjectResourceMeta::create(entry.name, UUID, typeId, icons, subMeta);
+				fileEntry->meta->add(resMeta);
+			}
+
+			if(!queuedImport.resources.empty())
+			{
+				HResource primary = newResources[0];
+
+				mUUIDToPath[primary.getUUID()] = fileEntry->path;
+				for (UINT32 i = 1; i < (UINT32)queuedImport.resources.size(); i++)
 				{
-					Path::stripInvalid(entry.name);
+					const QueuedImportResource& entry = queuedImport.resources[i];
 
-					const ProjectResourceIcons icons = generatePreviewIcons(*entry.resource);
+					const UUID& UUID = newResources[i].getUUID();
+					mUUIDToPath[UUID] = fileEntry->path + entry.name;
+				}
+			}
 
-					bool foundMeta = false;
-					for (auto iterMeta = existingResourceMetas.begin(); iterMeta != existingResourceMetas.end(); ++iterMeta)
-					{
-						const SPtr<ProjectResourceMeta>& metaEntry = *iterMeta;
+			FileEncoder fs(metaPath);
+			fs.encode(fileEntry->meta.get());
+		}
+		else
+		{
+			removeDependencies(fileEntry);
 
-						if (entry.name == metaEntry->getUniqueName())
-						{
-							HResource importedResource = gResources()._getResourceHandle(metaEntry->getUUID());
-							gResources().update(importedResource, entry.resource);
+			Vector<SPtr<ProjectResourceMeta>> existingResourceMetas = fileEntry->meta->getAllResourceMetaData();
+			fileEntry->meta->clearResourceMetaData();
 
-							newResources.push_back(importedResource);
+			for (auto& entry : queuedImport.resources)
+			{
+				Path::stripInvalid(entry.name);
 
-							metaEntry->setPreviewIcons(icons);
-							fileEntry->meta->add(metaEntry);
+				const ProjectResourceIcons icons = generatePreviewIcons(*entry.resource);
 
-							iterMeta = existingResourceMetas.erase(iterMeta);
-							foundMeta = true;
-							break;
-						}
-					}
+				bool foundMeta = false;
+				for (auto iterMeta = existingResourceMetas.begin(); iterMeta != existingResourceMetas.end(); ++iterMeta)
+				{
+					const SPtr<ProjectResourceMeta>& metaEntry = *iterMeta;
 
-					if (!foundMeta)
+					if (entry.name == metaEntry->getUniqueName())
 					{
-						HResource importedResource = gResources()._createResourceHandle(entry.resource);
+						HResource importedResource = gResources()._getResourceHandle(metaEntry->getUUID());
+						gResources().update(importedResource, entry.resource);
+
 						newResources.push_back(importedResource);
 
-						SPtr<ResourceMetaData> subMeta = entry.resource->getMetaData();
-						const UINT32 typeId = entry.resource->getTypeId();
-						const UUID& UUID = importedResource.getUUID();
+						metaEntry->setPreviewIcons(icons);
+						fileEntry->meta->add(metaEntry);
 
-						SPtr<ProjectResourceMeta> resMeta = ProjectResourceMeta::create(entry.name, UUID, typeId,
-							icons, subMeta);
-						fileEntry->meta->add(resMeta);
+						iterMeta = existingResourceMetas.erase(iterMeta);
+						foundMeta = true;
+						break;
 					}
+				}
 
-					// Keep resource metas that we are not currently using, in case they get restored so their references
-					// don't get broken
-					if(!queuedImport.pruneMetas)
-					{
-						for (auto& metaEntry : existingResourceMetas)
-							fileEntry->meta->addInactive(metaEntry);
-					}
+				if (!foundMeta)
+				{
+					HResource importedResource = gResources()._createResourceHandle(entry.resource);
+					newResources.push_back(importedResource);
 
-					// Update UUID to path mapping
-					auto& resourceMetas = fileEntry->meta->getResourceMetaData();
-					if (!resourceMetas.empty())
-					{
-						mUUIDToPath[resourceMetas[0]->getUUID()] = fileEntry->path;
+					SPtr<ResourceMetaData> subMeta = entry.resource->getMetaData();
+					const UINT32 typeId = entry.resource->getTypeId();
+					const UUID& UUID = importedResource.getUUID();
 
-						for (UINT32 i = 1; i < (UINT32)resourceMetas.size(); i++)
-						{
-							const SPtr<ProjectResourceMeta>& meta = resourceMetas[i];
-							mUUIDToPath[meta->getUUID()] = fileEntry->path + meta->getUniqueName();
-						}
-					}
+					SPtr<ProjectResourceMeta> resMeta = ProjectResourceMeta::create(entry.name, UUID, typeId,
+						icons, subMeta);
+					fileEntry->meta->add(resMeta);
 				}
 
-				fileEntry->meta->mImportOptions = queuedImport.importOptions;
+				// Keep resource metas that we are not currently using, in case they get restored so their references
+				// don't get broken
+				if(!queuedImport.pruneMetas)
+				{
+					for (auto& metaEntry : existingResourceMetas)
+						fileEntry->meta->addInactive(metaEntry);
+				}
+
+				// Update UUID to path mapping
+				auto& resourceMetas = fileEntry->meta->getResourceMetaData();
+				if (!resourceMetas.empty())
+				{
+					mUUIDToPath[resourceMetas[0]->getUUID()] = fileEntry->path;
 
-				FileEncoder fs(metaPath);
-				fs.encode(fileEntry->meta.get());
+					for (UINT32 i = 1; i < (UINT32)resourceMetas.size(); i++)
+					{
+						const SPtr<ProjectResourceMeta>& meta = resourceMetas[i];
+						mUUIDToPath[meta->getUUID()] = fileEntry->path + meta->getUniqueName();
+					}
+				}
 			}
 
-			addDependencies(fileEntry);
+			fileEntry->meta->mImportOptions = queuedImport.importOptions;
 
-			if (!newResources.empty())
-			{
-				Path internalResourcesPath = mProjectFolder;
-				internalResourcesPath.append(INTERNAL_RESOURCES_DIR);
+			FileEncoder fs(metaPath);
+			fs.encode(fileEntry->meta.get());
+		}
 
-				if (!FileSystem::isDirectory(internalResourcesPath))
-					FileSystem::createDir(internalResourcesPath);
+		addDependencies(fileEntry);
 
-				for (auto& entry : newResources)
-				{
-					String uuidStr = entry.getUUID().toString();
+		if (!newResources.empty())
+		{
+			Path internalResourcesPath = mProjectFolder;
+			internalResourcesPath.append(INTERNAL_RESOURCES_DIR);
 
-					internalResourcesPath.setFilename(uuidStr + ".asset");
-					gResources().save(entry, internalResourcesPath, true);
+			if (!FileSystem::isDirectory(internalResourcesPath))
+				FileSystem::createDir(internalResourcesPath);
 
-					const UUID& uuid = entry.getUUID();
-					mResourceManifest->registerResource(uuid, internalResourcesPath);
-				}
-			}
+			for (auto& entry : newResources)
+			{
+				String uuidStr = entry.getUUID().toString();
 
-			onEntryImported(fileEntry->path);
-			reimportDependants(fileEntry->path);
+				internalResourcesPath.setFilename(uuidStr + ".asset");
+				gResources().save(entry, internalResourcesPath, true);
 
-			iter = mQueuedImports.erase(iter);
+				const UUID& uuid = entry.getUUID();
+				mResourceManifest->registerResource(uuid, internalResourcesPath);
+			}
 		}
+
+		onEntryImported(fileEntry->path);
+		reimportDependants(fileEntry->path);
 	}
 
 	bool ProjectLibrary::isUpToDate(FileEntry* resource) const
@@ -945,7 +976,11 @@ namespace bs
 
 		Path absPath = assetPath.getAbsolute(getResourcesFolder());
 		Resources::instance().save(resource, absPath, false);
+
+		// Only the saved file needs to be checked, and native resources import synchronously so the entry can be
+		// finalized right away instead of waiting for the next _finishQueuedImports()
 		checkForModifications(absPath);
+		_finishQueuedImport(absPath);
 	}
 
 	void ProjectLibrary::saveEntry(const HResource& resource)
@@ -964,6 +999,7 @@ namespace bs
 
 		Resources::instance().save(resource, filePath, true);
 		checkForModifications(filePath);
+		_finishQueuedImport(filePath);
 	}
 
 	void ProjectLibrary::createFolderEntry(const Path& path)
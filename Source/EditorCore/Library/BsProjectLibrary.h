@@ -133,7 +133,8 @@ namespace bs
 		Path uuidToPath(const UUID& uuid) const;
 
 		/**
-		 * Registers a new resource in the library.
+		 * Registers a new resource in the library. The entry is fully registered (including its meta-data and UUID)
+		 * when the method returns, without requiring a refresh of the library.
 		 *
 		 * @param[in]	resource	Resource instance to add to the library. A copy of the resource will be saved at the
 		 *							provided path.
@@ -148,7 +149,10 @@ namespace bs
 		 */
 		void createFolderEntry(const Path& path);
 
-		/**	Updates a resource that is already in the library. */
+		/**
+		 * Updates a resource that is already in the library. Only the entry of the saved resource is updated, and any
+		 * resources depending on it are queued for reimport.
+		 */
 		void saveEntry(const HResource& resource);
 
 		/**
@@ -266,6 +270,15 @@ namespace bs
 		 */
 		void _finishQueuedImports(bool wait = false);
 
+		/**
+		 * Finalizes the queued import of a single file, blocking until the import finishes if it is still in progress.
+		 * Other queued imports are left as is.
+		 *
+		 * @param[in]	path	Absolute path to the file, or path relative to the resources folder.
+		 * @return				True if the file had a queued import that was finalized, false otherwise.
+		 */
+		bool _finishQueuedImport(const Path& path);
+
 		/** @} */
 
 		static const Path RESOURCES_DIR;
@@ -347,6 +360,13 @@ namespace bs
 		bool reimportResourceInternal(FileEntry* file, const SPtr<ImportOptions>& importOptions = nullptr, 
 			bool forceReimport = false, bool pruneResourceMetas = false);
 
+		/**
+		 * Registers the results of a finished import with the library: updates the resource meta-data, the UUID to path
+		 * mapping and the manifest, and queues dependants for reimport. Caller is responsible for removing the import
+		 * from the queue.
+		 */
+		void finishQueuedImport(FileEntry* fileEntry, QueuedImport& queuedImport);
+
 		/**
 		 * Creates a full hierarchy of directory entries up to the provided directory, if any are needed.
 		 *
@@ -9,6 +9,7 @@
 #include "Math/BsMatrix4.h"
 #include "RenderAPI/BsGpuParam.h"
 #include "Utility/BsDrawHelper.h"
+#include "Utility/BsShapeMeshCache.h"
 #include "Renderer/BsParamBlocks.h"
 #include "Renderer/BsRendererExtension.h"
 
@@ -240,6 +241,9 @@ namespace bs
 		 */
 		HSceneObject getSceneObject(UINT32 gizmoIdx);
 
+		/** Returns statistics about gizmo meshes built and re-used during the previous frame. */
+		const EditorMeshStats& getMeshStats() const { return mMeshCache.getLastFrameStats(); }
+
 		/** @name Internal
 		 *  @{
 		 */
@@ -410,7 +414,8 @@ namespace bs
 		typedef SPtr<IconRenderDataVec> IconRenderDataVecPtr;
 
 		/**
-		 * Builds a brand new mesh that can be used for rendering all icon gizmos.
+		 * Builds a mesh that can be used for rendering all icon gizmos. The mesh is sub-allocated from the icon mesh heap
+		 * and must be released with MeshHeap::dealloc() once it is no longer needed.
 		 *
 		 * @param[in]	camera		Camera the mesh will be rendered to.
 		 * @param[in]	iconData	A list of all icons and their properties.
@@ -420,7 +425,7 @@ namespace bs
 		 *
 		 * @return					A mesh containing all of the visible icons.	
 		 */
-		SPtr<Mesh> buildIconMesh(const SPtr<Camera>& camera, const Vector<IconData>& iconData, bool forPicking, 
+		SPtr<TransientMesh> buildIconMesh(const SPtr<Camera>& camera, const Vector<IconData>& iconData, bool forPicking, 
 			IconRenderDataVecPtr& renderData);
 
 		/**	Resizes the icon width/height so it is always scaled to optimal size (with preserved aspect). */
@@ -481,9 +486,11 @@ namespace bs
 		Vector<TextData> mTextData;
 		Map<UINT32, HSceneObject> mIdxToSceneObjectMap;
 
-		Vector<DrawHelper::ShapeMeshData> mActiveMeshes;
+		ShapeMeshCache mMeshCache;
+		UINT64 mLastFrameIdx;
 
-		SPtr<Mesh> mIconMesh;
+		SPtr<MeshHeap> mIconMeshHeap;
+		SPtr<TransientMesh> mIconMesh;
 
 		SPtr<ct::GizmoRenderer> mGizmoRenderer;
 
@@ -0,0 +1,114 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsEditorPrerequisites.h"
+#include "Utility/BsModule.h"
+
+namespace bs
+{
+	/** @addtogroup Scene-Editor
+	 *  @{
+	 */
+
+	/**
+	 * Keeps track of prefab instances in the scene. Used for propagating prefab changes to only the instances of the
+	 * changed prefab.
+	 *
+	 * Instances are registered as they are created (see registerInstances()), instead of the scene being searched for
+	 * them. Instances that were destroyed or whose prefab link was broken are removed the next time their prefab is
+	 * applied.
+	 *
+	 * When a prefab is applied, the old and the new version of the prefab are diffed once and the resulting diff is
+	 * applied to every instance, instead of re-instantiating the prefab for each instance. Instances are updated over
+	 * multiple frames, a limited number each frame.
+	 */
+	class BS_ED_EXPORT PrefabInstanceRegistry : public Module<PrefabInstanceRegistry>
+	{
+	public:
+		~PrefabInstanceRegistry();
+
+		/**
+		 * Registers all prefab instances in the hierarchy under @p root, including @p root itself. Must be called whenever
+		 * a hierarchy that might contain prefab instances is added to the scene, or linked to a prefab. Instances that
+		 * are already registered are ignored.
+		 */
+		void registerInstances(const HSceneObject& root);
+
+		/** Clears all registered instances, and registers the prefab instances in the hierarchy under @p root. */
+		void refresh(const HSceneObject& root);
+
+		/** Returns the root objects of all registered instances of the provided prefab that are still linked to it. */
+		Vector<HSceneObject> getInstances(const UUID& prefabUUID) const;
+
+		/**
+		 * Updates the prefab with the contents of one of its instances, and queues all other instances of the prefab in
+		 * the scene for update. Instance specific modifications are preserved.
+		 *
+		 * @param[in]	instance	Root object of the prefab instance to apply.
+		 * @param[in]	prefab		Prefab the instance is linked to.
+		 */
+		void applyPrefab(const HSceneObject& instance, const HPrefab& prefab);
+
+		/** Immediately updates all instances that are still queued for update. */
+		void completeUpdates();
+
+		/** Checks are there any prefab instances queued for update. */
+		bool isUpdating() const { return !mQueue.empty(); }
+
+		/**
+		 * Returns the percentage of queued instances that have been updated, in [0, 1] range. Reset whenever the queue
+		 * becomes empty.
+		 */
+		float getUpdateProgress() const;
+
+		/** @name Internal
+		 *  @{
+		 */
+
+		/**
+		 * Updates queued prefab instances until the provided time budget is exceeded. At least one instance is always
+		 * updated if any are queued. Should be called once per frame.
+		 */
+		void _update(float maxTimeMs = DEFAULT_UPDATE_BUDGET_MS);
+
+		/** @} */
+
+		/** Default maximum amount of time to spend updating prefab instances in a single frame, in milliseconds. */
+		static constexpr float DEFAULT_UPDATE_BUDGET_MS = 4.0f;
+
+	private:
+		/** Changes made to a single prefab, shared by all of its instances queued for update. */
+		struct PrefabChange
+		{
+			HSceneObject oldRoot;
+			SPtr<PrefabDiff> diff;
+			UINT32 numRemaining = 0;
+		};
+
+		/** A single prefab instance queued for update. */
+		struct QueuedInstance
+		{
+			HSceneObject instance;
+			SPtr<PrefabChange> change;
+		};
+
+		/** Applies prefab changes to a single instance, preserving the instance specific modifications. */
+		void updateInstance(const QueuedInstance& entry);
+
+		/** Removes instances of the provided prefab that were destroyed, or are no longer linked to it. */
+		void removeStaleInstances(const UUID& prefabUUID);
+
+		/** Checks is the provided instance still alive and linked to the provided prefab. */
+		static bool isInstanceOf(const HSceneObject& instance, const UUID& prefabUUID);
+
+		UnorderedMap<UUID, Vector<HSceneObject>> mInstances;
+		UnorderedMap<UINT64, UUID> mRegisteredInstances;
+
+		Queue<QueuedInstance> mQueue;
+		UINT32 mNumQueued = 0;
+		UINT32 mNumUpdated = 0;
+	};
+
+	/** @} */
+}
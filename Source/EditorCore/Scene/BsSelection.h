@@ -27,6 +27,15 @@ namespace bs
 		/**	Sets a new set of scene objects to select, replacing the old ones. */
 		void setSceneObjects(const Vector<HSceneObject>& sceneObjects);
 
+		/** Checks is the provided scene object currently selected. Constant time. */
+		bool isSelected(const HSceneObject& sceneObject) const;
+
+		/**
+		 * Returns all renderable components attached to the currently selected scene objects. The list is cached and only
+		 * rebuilt when the selection changes, or when components on the selected scene objects change.
+		 */
+		const Vector<HRenderable>& getSelectedRenderables() const;
+
 		/**	Returns a currently selected set of resource paths. */
 		const Vector<Path>& getResourcePaths() const;
 
@@ -85,6 +94,15 @@ namespace bs
 		/** Removes any destroyed scene objects from the selected scene object list. */
 		void pruneDestroyedSceneObjects() const;
 
+		/**
+		 * Rebuilds the set of selected instance IDs and marks the renderable cache as dirty. Must be called whenever the
+		 * selected scene object list changes.
+		 */
+		void onSceneObjectsModified() const;
+
+		/** Checks if components on any of the selected scene objects changed since the renderable cache was built. */
+		bool areRenderablesDirty() const;
+
 		mutable Vector<HSceneObject> mSelectedSceneObjects;
 		Vector<Path> mSelectedResourcePaths;
 
@@ -92,6 +110,11 @@ namespace bs
 		HMessage mResourceSelectionChangedConn;
 
 		mutable Vector<HSceneObject> mTempSO;
+
+		mutable UnorderedSet<UINT64> mSelectedInstanceIds;
+		mutable Vector<HRenderable> mSelectedRenderables;
+		mutable Vector<UINT32> mSelectedNumComponents; /**< Component count per selected SO, when renderables were cached. */
+		mutable bool mRenderablesDirty = true;
 	};
 
 	/** @} */
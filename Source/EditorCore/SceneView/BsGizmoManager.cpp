@@ -2,6 +2,8 @@
 //**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
 #include "Scene/BsGizmoManager.h"
 #include "Mesh/BsMesh.h"
+#include "Mesh/BsMeshHeap.h"
+#include "Mesh/BsTransientMesh.h"
 #include "Math/BsAABox.h"
 #include "Math/BsSphere.h"
 #include "RenderAPI/BsVertexDataDesc.h"
@@ -18,11 +20,14 @@
 #include "Renderer/BsRendererUtility.h"
 #include "Renderer/BsRendererManager.h"
 #include "Utility/BsDrawHelper.h"
+#include "Utility/BsTime.h"
 
 using namespace std::placeholders;
 
 namespace bs
 {
+	const UINT32 GizmoManager::VERTEX_BUFFER_GROWTH = 4096;
+	const UINT32 GizmoManager::INDEX_BUFFER_GROWTH = 4096 * 2;
 	const UINT32 GizmoManager::SPHERE_QUALITY = 1;
 	const UINT32 GizmoManager::WIRE_SPHERE_QUALITY = 10;
 	const float GizmoManager::MAX_ICON_RANGE = 500.0f;
@@ -31,8 +36,7 @@ namespace bs
 
 	GizmoManager::GizmoManager()
 		: mPickable(false), mCurrentIdx(0), mTransformDirty(false), mColorDirty(false), mDrawHelper(nullptr)
-		, mPickingDrawHelper(nullptr)
-		
+		, mPickingDrawHelper(nullptr), mLastFrameIdx((UINT64)-1)
 	{
 		mTransform = Matrix4::IDENTITY;
 		mDrawHelper = bs_new<DrawHelper>();
@@ -44,6 +48,10 @@ namespace bs
 		mIconVertexDesc->addVertElem(VET_COLOR, VES_COLOR, 0);
 		mIconVertexDesc->addVertElem(VET_COLOR, VES_COLOR, 1);
 
+		// Icon meshes are rebuilt every frame, so they are sub-allocated from persistent buffers instead of creating a
+		// new mesh each time
+		mIconMeshHeap = MeshHeap::create(VERTEX_BUFFER_GROWTH, INDEX_BUFFER_GROWTH, mIconVertexDesc);
+
 		HMaterial solidMaterial = BuiltinEditorResources::instance().createSolidGizmoMat();
 		HMaterial wireMaterial = BuiltinEditorResources::instance().createWireGizmoMat();
 		HMaterial lineMaterial = BuiltinEditorResources::instance().createLineGizmoMat();
@@ -67,7 +75,10 @@ namespace bs
 
 	GizmoManager::~GizmoManager()
 	{
-		mActiveMeshes.clear();
+		if (mIconMesh != nullptr)
+			mIconMeshHeap->dealloc(mIconMesh);
+
+		mMeshCache.reset();
 
 		bs_delete(mDrawHelper);
 		bs_delete(mPickingDrawHelper);
@@ -99,6 +110,7 @@ namespace bs
 	void GizmoManager::setColor(const Color& color)
 	{
 		mDrawHelper->setColor(color);
+		mMeshCache.addToHash(color);
 		mColor = color;
 
 		mColorDirty = true;
@@ -125,6 +137,7 @@ namespace bs
 		cubeData.sceneObject = mActiveSO;
 		cubeData.pickable = mPickable;
 
+		mMeshCache.addAllToHash(DrawShape::Cube, mTransform, position, extents);
 		mDrawHelper->cube(position, extents);
 		mIdxToSceneObjectMap[cubeData.idx] = mActiveSO;
 	}
@@ -142,6 +155,7 @@ namespace bs
 		sphereData.sceneObject = mActiveSO;
 		sphereData.pickable = mPickable;
 
+		mMeshCache.addAllToHash(DrawShape::Sphere, mTransform, position, radius);
 		mDrawHelper->sphere(position, radius);
 		mIdxToSceneObjectMap[sphereData.idx] = mActiveSO;
 	}
@@ -160,6 +174,7 @@ namespace bs
 		coneData.pickable = mPickable;
 		coneData.scale = scale;
 
+		mMeshCache.addAllToHash(DrawShape::Cone, mTransform, base, normal, height, radius, scale);
 		mDrawHelper->cone(base, normal, height, radius, scale);
 		mIdxToSceneObjectMap[coneData.idx] = mActiveSO;
 	}
@@ -178,6 +193,7 @@ namespace bs
 		discData.sceneObject = mActiveSO;
 		discData.pickable = mPickable;
 
+		mMeshCache.addAllToHash(DrawShape::Disc, mTransform, position, normal, radius);
 		mDrawHelper->disc(position, normal, radius);
 		mIdxToSceneObjectMap[discData.idx] = mActiveSO;
 	}
@@ -195,6 +211,7 @@ namespace bs
 		cubeData.sceneObject = mActiveSO;
 		cubeData.pickable = mPickable;
 
+		mMeshCache.addAllToHash(DrawShape::WireCube, mTransform, position, extents);
 		mDrawHelper->wireCube(position, extents);
 		mIdxToSceneObjectMap[cubeData.idx] = mActiveSO;
 	}
@@ -212,6 +229,7 @@ namespace bs
 		sphereData.sceneObject = mActiveSO;
 		sphereData.pickable = mPickable;
 
+		mMeshCache.addAllToHash(DrawShape::WireSphere, mTransform, position, radius);
 		mDrawHelper->wireSphere(position, radius);
 		mIdxToSceneObjectMap[sphereData.idx] = mActiveSO;
 	}
@@ -266,6 +284,7 @@ namespace bs
 		coneData.pickable = mPickable;
 		coneData.scale = scale;
 
+		mMeshCache.addAllToHash(DrawShape::WireCone, mTransform, base, normal, height, radius, scale);
 		mDrawHelper->wireCone(base, normal, height, radius, scale);
 		mIdxToSceneObjectMap[coneData.idx] = mActiveSO;
 	}
@@ -283,6 +302,7 @@ namespace bs
 		lineData.sceneObject = mActiveSO;
 		lineData.pickable = mPickable;
 
+		mMeshCache.addAllToHash(DrawShape::Line, mTransform, start, end);
 		mDrawHelper->line(start, end);
 		mIdxToSceneObjectMap[lineData.idx] = mActiveSO;
 	}
@@ -299,6 +319,8 @@ namespace bs
 		lineListData.sceneObject = mActiveSO;
 		lineListData.pickable = mPickable;
 
+		mMeshCache.addAllToHash(DrawShape::LineList, mTransform, (UINT32)linePoints.size());
+		mMeshCache.addBytesToHash(linePoints.data(), (UINT32)(linePoints.size() * sizeof(Vector3)));
 		mDrawHelper->lineList(linePoints);
 		mIdxToSceneObjectMap[lineListData.idx] = mActiveSO;
 	}
@@ -317,6 +339,7 @@ namespace bs
 		wireDiscData.sceneObject = mActiveSO;
 		wireDiscData.pickable = mPickable;
 
+		mMeshCache.addAllToHash(DrawShape::WireDisc, mTransform, position, normal, radius);
 		mDrawHelper->wireDisc(position, normal, radius);
 		mIdxToSceneObjectMap[wireDiscData.idx] = mActiveSO;
 	}
@@ -338,6 +361,7 @@ namespace bs
 		wireArcData.sceneObject = mActiveSO;
 		wireArcData.pickable = mPickable;
 
+		mMeshCache.addAllToHash(DrawShape::WireArc, mTransform, position, normal, radius, startAngle, amountAngle);
 		mDrawHelper->wireArc(position, normal, radius, startAngle, amountAngle);
 		mIdxToSceneObjectMap[wireArcData.idx] = mActiveSO;
 	}
@@ -354,6 +378,9 @@ namespace bs
 		wireMeshData.sceneObject = mActiveSO;
 		wireMeshData.pickable = mPickable;
 
+		// Only the vertices are hashed, as the index buffer is not expected to change independently of them
+		mMeshCache.addAllToHash(DrawShape::WireMesh, mTransform, meshData->getNumVertices(), meshData->getNumIndices());
+		mMeshCache.addBytesToHash(meshData->getStreamData(0), meshData->getStreamSize(0));
 		mDrawHelper->wireMesh(meshData);
 		mIdxToSceneObjectMap[wireMeshData.idx] = mActiveSO;
 	}
@@ -374,6 +401,7 @@ namespace bs
 		frustumData.sceneObject = mActiveSO;
 		frustumData.pickable = mPickable;
 
+		mMeshCache.addAllToHash(DrawShape::Frustum, mTransform, position, aspect, FOV, near, far);
 		mDrawHelper->frustum(position, aspect, FOV, near, far);
 		mIdxToSceneObjectMap[frustumData.idx] = mActiveSO;
 	}
@@ -414,6 +442,7 @@ namespace bs
 		textData.sceneObject = mActiveSO;
 		textData.pickable = mPickable;
 
+		mMeshCache.addAllToHash(DrawShape::Text, mTransform, position, fontSize, text, myFont.getUUID());
 		mDrawHelper->text(position, text, myFont, fontSize);
 		mIdxToSceneObjectMap[textData.idx] = mActiveSO;
 	}
@@ -442,10 +471,20 @@ namespace bs
 
 	void GizmoManager::update(const SPtr<Camera>& camera)
 	{
-		mActiveMeshes.clear();
-		mActiveMeshes = mDrawHelper->buildMeshes(DrawHelper::SortType::BackToFront, camera->getTransform().getPosition());
+		UINT64 frameIdx = gTime().getFrameIdx();
+		if (frameIdx != mLastFrameIdx)
+		{
+			mMeshCache.endFrame();
+			mLastFrameIdx = frameIdx;
+		}
+
+		const Vector<DrawHelper::ShapeMeshData>& meshes = mMeshCache.getMeshes(*mDrawHelper, *camera);
+		Vector<MeshRenderData> proxyData = createMeshProxyData(meshes);
+
+		// Heap memory is only re-used once the GPU is done with the previous icon mesh
+		if (mIconMesh != nullptr)
+			mIconMeshHeap->dealloc(mIconMesh);
 
-		Vector<MeshRenderData> proxyData = createMeshProxyData(mActiveMeshes);
 		IconRenderDataVecPtr iconRenderData;
 		mIconMesh = buildIconMesh(camera, mIconData, false, iconRenderData);
 
@@ -637,9 +676,9 @@ namespace bs
 		const Vector<DrawHelper::ShapeMeshData>& meshes = 
 			mPickingDrawHelper->buildMeshes(DrawHelper::SortType::BackToFront, camera->getTransform().getPosition());
 
-		SPtr<Mesh> iconMesh = buildIconMesh(camera, iconData, true, iconRenderData);
+		SPtr<TransientMesh> iconMesh = buildIconMesh(camera, iconData, true, iconRenderData);
 		
-		SPtr<ct::Mesh> iconMeshCore;
+		SPtr<ct::MeshBase> iconMeshCore;
 		if (iconMesh != nullptr)
 			iconMeshCore = iconMesh->getCore();
 
@@ -649,6 +688,10 @@ namespace bs
 		Vector<MeshRenderData> proxyData = createMeshProxyData(meshes);
 		gCoreThread().queueCommand(std::bind(&ct::GizmoRenderer::renderData, renderer, camera->getCore(),
 											 proxyData, iconMeshCore, iconRenderData, true));
+
+		// Safe to release right away, the heap keeps the memory reserved until the queued render completes
+		if (iconMesh != nullptr)
+			mIconMeshHeap->dealloc(iconMesh);
 	}
 
 	void GizmoManager::clearGizmos()
@@ -671,14 +714,20 @@ namespace bs
 		mIdxToSceneObjectMap.clear();
 
 		mDrawHelper->clear();
+		mMeshCache.clear();
 
 		mCurrentIdx = 0;
 	}
 
 	void GizmoManager::clearRenderData()
 	{
-		mActiveMeshes.clear();
-		mIconMesh = nullptr;
+		mMeshCache.reset();
+
+		if (mIconMesh != nullptr)
+		{
+			mIconMeshHeap->dealloc(mIconMesh);
+			mIconMesh = nullptr;
+		}
 
 		ct::GizmoRenderer* renderer = mGizmoRenderer.get();
 		IconRenderDataVecPtr iconRenderData = bs_shared_ptr_new<IconRenderDataVec>();
@@ -687,7 +736,7 @@ namespace bs
 			nullptr, Vector<MeshRenderData>(), nullptr, iconRenderData));
 	}
 
-	SPtr<Mesh> GizmoManager::buildIconMesh(const SPtr<Camera>& camera, const Vector<IconData>& iconData,
+	SPtr<TransientMesh> GizmoManager::buildIconMesh(const SPtr<Camera>& camera, const Vector<IconData>& iconData,
 		bool forPicking, GizmoManager::IconRenderDataVecPtr& iconRenderData)
 	{
 		mSortedIconData.clear();
@@ -853,7 +902,13 @@ namespace bs
 		}
 
 		if(actualNumIcons > 0)
-			return Mesh::_createPtr(meshData);
+		{
+			UINT64 numBytes = meshData->getNumVertices() * (UINT64)mIconVertexDesc->getVertexStride() +
+				meshData->getNumIndices() * (UINT64)sizeof(UINT32);
+			mMeshCache.addTransientMesh(numBytes);
+
+			return mIconMeshHeap->alloc(meshData, DOT_TRIANGLE_LIST);
+		}
 
 		return nullptr;
 	}
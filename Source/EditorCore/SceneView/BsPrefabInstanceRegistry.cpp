@@ -0,0 +1,209 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "Scene/BsPrefabInstanceRegistry.h"
+#include "Scene/BsSceneObject.h"
+#include "Scene/BsPrefab.h"
+#include "Scene/BsPrefabDiff.h"
+#include <chrono>
+
+namespace bs
+{
+	PrefabInstanceRegistry::~PrefabInstanceRegistry()
+	{
+		// Old prefab copies aren't part of the scene, so they don't get destroyed with it
+		while (!mQueue.empty())
+		{
+			SPtr<PrefabChange> change = mQueue.front().change;
+			mQueue.pop();
+
+			change->numRemaining--;
+			if (change->numRemaining == 0)
+				change->oldRoot->destroy(true);
+		}
+	}
+
+	void PrefabInstanceRegistry::registerInstances(const HSceneObject& root)
+	{
+		if (root == nullptr || root.isDestroyed())
+			return;
+
+		Stack<HSceneObject> todo;
+		todo.push(root);
+
+		while (!todo.empty())
+		{
+			HSceneObject current = todo.top();
+			todo.pop();
+
+			const UUID& prefabLink = current->_getPrefabLinkUUID();
+			if (!prefabLink.empty())
+			{
+				auto iterFind = mRegisteredInstances.find(current->getInstanceId());
+				if (iterFind == mRegisteredInstances.end() || iterFind->second != prefabLink)
+				{
+					// Linked to a different prefab since it was registered
+					if (iterFind != mRegisteredInstances.end())
+					{
+						Vector<HSceneObject>& oldInstances = mInstances[iterFind->second];
+						oldInstances.erase(std::remove(oldInstances.begin(), oldInstances.end(), current),
+							oldInstances.end());
+					}
+
+					mInstances[prefabLink].push_back(current);
+					mRegisteredInstances[current->getInstanceId()] = prefabLink;
+				}
+			}
+
+			UINT32 numChildren = current->getNumChildren();
+			for (UINT32 i = 0; i < numChildren; i++)
+				todo.push(current->getChild(i));
+		}
+	}
+
+	void PrefabInstanceRegistry::refresh(const HSceneObject& root)
+	{
+		mInstances.clear();
+		mRegisteredInstances.clear();
+
+		registerInstances(root);
+	}
+
+	Vector<HSceneObject> PrefabInstanceRegistry::getInstances(const UUID& prefabUUID) const
+	{
+		Vector<HSceneObject> output;
+
+		auto iterFind = mInstances.find(prefabUUID);
+		if (iterFind != mInstances.end())
+		{
+			for (auto& instance : iterFind->second)
+			{
+				if (isInstanceOf(instance, prefabUUID))
+					output.push_back(instance);
+			}
+		}
+
+		return output;
+	}
+
+	void PrefabInstanceRegistry::applyPrefab(const HSceneObject& instance, const HPrefab& prefab)
+	{
+		if (instance == nullptr || instance.isDestroyed() || !prefab.isLoaded())
+			return;
+
+		// Instances must not be updated with two different diffs of the same prefab at once
+		completeUpdates();
+
+		SPtr<PrefabChange> change = bs_shared_ptr_new<PrefabChange>();
+		change->oldRoot = prefab->_getRoot()->clone(false);
+
+		prefab->update(instance);
+		change->diff = PrefabDiff::create(change->oldRoot, prefab->_getRoot());
+
+		// Instance might have just been linked to the prefab, or have new instances of other prefabs nested in it
+		registerInstances(instance);
+		removeStaleInstances(prefab.getUUID());
+
+		for (auto& entry : getInstances(prefab.getUUID()))
+		{
+			if (entry == instance)
+				continue;
+
+			mQueue.push({ entry, change });
+			change->numRemaining++;
+			mNumQueued++;
+		}
+
+		if (change->numRemaining == 0)
+			change->oldRoot->destroy(true);
+	}
+
+	void PrefabInstanceRegistry::completeUpdates()
+	{
+		while (!mQueue.empty())
+			_update(std::numeric_limits<float>::max());
+	}
+
+	float PrefabInstanceRegistry::getUpdateProgress() const
+	{
+		if (mNumQueued == 0)
+			return 1.0f;
+
+		return mNumUpdated / (float)mNumQueued;
+	}
+
+	void PrefabInstanceRegistry::_update(float maxTimeMs)
+	{
+		typedef std::chrono::high_resolution_clock Clock;
+
+		Clock::time_point start = Clock::now();
+		while (!mQueue.empty())
+		{
+			QueuedInstance entry = mQueue.front();
+			mQueue.pop();
+
+			if (!entry.instance.isDestroyed())
+				updateInstance(entry);
+
+			mNumUpdated++;
+
+			entry.change->numRemaining--;
+			if (entry.change->numRemaining == 0)
+				entry.change->oldRoot->destroy(true);
+
+			if (std::chrono::duration<float, std::milli>(Clock::now() - start).count() >= maxTimeMs)
+				break;
+		}
+
+		if (mQueue.empty())
+		{
+			mNumQueued = 0;
+			mNumUpdated = 0;
+		}
+	}
+
+	void PrefabInstanceRegistry::updateInstance(const QueuedInstance& entry)
+	{
+		// Record the instance specific modifications against the old version of the prefab, then re-apply them on top
+		// of the prefab changes so they take priority, same as when the instance is re-instantiated from the prefab
+		SPtr<PrefabDiff> instanceDiff = PrefabDiff::create(entry.change->oldRoot, entry.instance);
+
+		if (entry.change->diff != nullptr)
+			entry.change->diff->apply(entry.instance);
+
+		if (instanceDiff != nullptr)
+			instanceDiff->apply(entry.instance);
+
+		entry.instance->_setPrefabDiff(instanceDiff);
+
+		// Prefab changes might have added instances of other prefabs
+		registerInstances(entry.instance);
+	}
+
+	void PrefabInstanceRegistry::removeStaleInstances(const UUID& prefabUUID)
+	{
+		auto iterFind = mInstances.find(prefabUUID);
+		if (iterFind == mInstances.end())
+			return;
+
+		Vector<HSceneObject>& instances = iterFind->second;
+		for (auto iter = instances.begin(); iter != instances.end();)
+		{
+			if (isInstanceOf(*iter, prefabUUID))
+			{
+				++iter;
+				continue;
+			}
+
+			mRegisteredInstances.erase(iter->getInstanceId());
+			iter = instances.erase(iter);
+		}
+
+		if (instances.empty())
+			mInstances.erase(iterFind);
+	}
+
+	bool PrefabInstanceRegistry::isInstanceOf(const HSceneObject& instance, const UUID& prefabUUID)
+	{
+		return !instance.isDestroyed() && instance->_getPrefabLinkUUID() == prefabUUID;
+	}
+}
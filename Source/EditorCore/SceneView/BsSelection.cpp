@@ -6,6 +6,8 @@
 #include "Library/BsProjectLibrary.h"
 #include "Library/BsProjectResourceMeta.h"
 #include "Utility/BsMessageHandler.h"
+#include "Scene/BsSceneObject.h"
+#include "Components/BsCRenderable.h"
 
 namespace bs
 {
@@ -34,6 +36,7 @@ namespace bs
 	{
 		mSelectedSceneObjects = sceneObjects;
 		mSelectedResourcePaths.clear();
+		onSceneObjectsModified();
 
 		updateTreeViews();
 
@@ -41,6 +44,40 @@ namespace bs
 		onSelectionChanged(mSelectedSceneObjects, Vector<Path>());
 	}
 
+	bool Selection::isSelected(const HSceneObject& sceneObject) const
+	{
+		if (sceneObject.isDestroyed(true))
+			return false;
+
+		return mSelectedInstanceIds.find(sceneObject.getInstanceId()) != mSelectedInstanceIds.end();
+	}
+
+	const Vector<HRenderable>& Selection::getSelectedRenderables() const
+	{
+		pruneDestroyedSceneObjects();
+
+		if (!mRenderablesDirty && !areRenderablesDirty())
+			return mSelectedRenderables;
+
+		mSelectedRenderables.clear();
+		mSelectedNumComponents.clear();
+
+		for (auto& SO : mSelectedSceneObjects)
+		{
+			const Vector<HComponent>& components = SO->getComponents();
+			mSelectedNumComponents.push_back((UINT32)components.size());
+
+			for (auto& component : components)
+			{
+				if (rtti_is_of_type<CRenderable>(component.get()))
+					mSelectedRenderables.push_back(static_object_cast<CRenderable>(component));
+			}
+		}
+
+		mRenderablesDirty = false;
+		return mSelectedRenderables;
+	}
+
 	const Vector<Path>& Selection::getResourcePaths() const
 	{
 		return mSelectedResourcePaths;
@@ -50,6 +87,7 @@ namespace bs
 	{
 		mSelectedResourcePaths = paths;
 		mSelectedSceneObjects.clear();
+		onSceneObjectsModified();
 
 		updateTreeViews();
 
@@ -80,6 +118,8 @@ namespace bs
 		}
 
 		mSelectedSceneObjects.clear();
+		onSceneObjectsModified();
+
 		updateTreeViews();
 
 		onSelectionChanged(Vector<HSceneObject>(), mSelectedResourcePaths);
@@ -136,6 +176,7 @@ namespace bs
 
 			mSelectedSceneObjects = newSelection;
 			mSelectedResourcePaths.clear();
+			onSceneObjectsModified();
 
 			pruneDestroyedSceneObjects();
 			onSelectionChanged(mSelectedSceneObjects, Vector<Path>());
@@ -169,6 +210,7 @@ namespace bs
 
 			mSelectedResourcePaths = newSelection;
 			mSelectedSceneObjects.clear();
+			onSceneObjectsModified();
 
 			onSelectionChanged(Vector<HSceneObject>(), mSelectedResourcePaths);
 		}
@@ -201,7 +243,7 @@ namespace bs
 		bool anyDestroyed = false;
 		for (auto& SO : mSelectedSceneObjects)
 		{
-			if (!SO.isDestroyed(true))
+			if (SO.isDestroyed(true))
 			{
 				anyDestroyed = true;
 				break;
@@ -219,5 +261,40 @@ namespace bs
 
 		mSelectedSceneObjects.swap(mTempSO);
 		mTempSO.clear();
+
+		onSceneObjectsModified();
+	}
+
+	void Selection::onSceneObjectsModified() const
+	{
+		mSelectedInstanceIds.clear();
+		for (auto& SO : mSelectedSceneObjects)
+		{
+			if (!SO.isDestroyed(true))
+				mSelectedInstanceIds.insert(SO.getInstanceId());
+		}
+
+		mRenderablesDirty = true;
+	}
+
+	bool Selection::areRenderablesDirty() const
+	{
+		if (mSelectedNumComponents.size() != mSelectedSceneObjects.size())
+			return true;
+
+		// Changed component count means components were added or removed from one of the selected objects
+		for (UINT32 i = 0; i < (UINT32)mSelectedSceneObjects.size(); i++)
+		{
+			if (mSelectedSceneObjects[i]->getComponents().size() != mSelectedNumComponents[i])
+				return true;
+		}
+
+		for (auto& renderable : mSelectedRenderables)
+		{
+			if (renderable.isDestroyed())
+				return true;
+		}
+
+		return false;
 	}
 }
\ No newline at end of file
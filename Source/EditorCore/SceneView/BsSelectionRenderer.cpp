@@ -37,20 +37,11 @@ namespace bs
 	{
 		Vector<SPtr<ct::Renderable>> objects;
 
-		const Vector<HSceneObject>& sceneObjects = Selection::instance().getSceneObjects();
-		Vector<HRenderable> renderables = gSceneManager().findComponents<CRenderable>(true);
-
+		const Vector<HRenderable>& renderables = Selection::instance().getSelectedRenderables();
 		for (auto& renderable : renderables)
 		{
-			HSceneObject renderableSO = renderable->SO();
-			for (auto& so : sceneObjects)
-			{
-				if (renderableSO != so)
-					continue;
-
-				if (renderable->getMesh().isLoaded())
-					objects.push_back(renderable->_getRenderable()->getCore());
-			}
+			if (renderable->getMesh().isLoaded())
+				objects.push_back(renderable->_getRenderable()->getCore());
 		}
 
 		ct::SelectionRendererCore* renderer = mRenderer.get();
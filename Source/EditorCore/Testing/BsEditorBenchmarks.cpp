@@ -0,0 +1,372 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "Testing/BsEditorBenchmarks.h"
+#include "BsEditorApplication.h"
+#include "Scene/BsSceneObject.h"
+#include "Scene/BsGameObjectManager.h"
+#include "Scene/BsPrefab.h"
+#include "Scene/BsPrefabDiff.h"
+#include "Serialization/BsMemorySerializer.h"
+#include "UndoRedo/BsCmdRecordSO.h"
+#include "UndoRedo/BsUndoRedo.h"
+#include "GUI/BsGUISceneTreeView.h"
+#include "Library/BsProjectLibrary.h"
+#include "Resources/BsResources.h"
+#include "Script/BsScriptManager.h"
+#include "FileSystem/BsFileSystem.h"
+#include "FileSystem/BsDataStream.h"
+#include "Debug/BsDebug.h"
+#include <chrono>
+
+namespace bs
+{
+	Event<void(EditorBenchmarks&)> EditorBenchmarks::onRun;
+
+	EditorBenchmarks::EditorBenchmarks(const EDITOR_BENCHMARK_DESC& desc)
+		:mDesc(desc)
+	{ }
+
+	void EditorBenchmarks::run()
+	{
+		mResults.clear();
+
+		for (auto& numSceneObjects : mDesc.sceneSizes)
+			runSceneBenchmarks(numSceneObjects);
+
+		if (mDesc.numLibraryEntries > 0)
+			runLibraryBenchmarks();
+
+		onRun(*this);
+	}
+
+	void EditorBenchmarks::measure(const String& name, UINT32 count, const std::function<void()>& setup,
+		const std::function<void()>& benchmark, const std::function<void()>& teardown, UINT32 numIterations)
+	{
+		typedef std::chrono::high_resolution_clock Clock;
+
+		EditorBenchmarkResult result;
+		result.name = name;
+		result.count = count;
+		result.numIterations = std::max(numIterations > 0 ? numIterations : mDesc.numIterations, 1U);
+		result.minMs = std::numeric_limits<double>::max();
+
+		double totalMs = 0.0;
+		for (UINT32 i = 0; i < result.numIterations; i++)
+		{
+			if (setup != nullptr)
+				setup();
+
+			Clock::time_point start = Clock::now();
+			benchmark();
+			Clock::time_point end = Clock::now();
+
+			if (teardown != nullptr)
+				teardown();
+
+			double ms = std::chrono::duration<double, std::milli>(end - start).count();
+			result.minMs = std::min(result.minMs, ms);
+			result.maxMs = std::max(result.maxMs, ms);
+			totalMs += ms;
+		}
+
+		result.avgMs = totalMs / result.numIterations;
+		addResult(result);
+	}
+
+	void EditorBenchmarks::addResult(const EditorBenchmarkResult& result)
+	{
+		mResults.push_back(result);
+
+		LOGDBG("Benchmark " + result.name + " (" + toString(result.count) + "): " + toString(result.avgMs) + " ms");
+	}
+
+	void EditorBenchmarks::runSceneBenchmarks(UINT32 numSceneObjects)
+	{
+		HSceneObject root;
+		auto destroyRoot = [&root]()
+		{
+			if (root != nullptr && !root.isDestroyed())
+				root->destroy(true);
+
+			root = nullptr;
+		};
+
+		measure("scene.create", numSceneObjects, nullptr,
+			[&]() { root = generateScene(numSceneObjects); },
+			destroyRoot);
+
+		// Remaining benchmarks all operate on the same scene
+		root = generateScene(numSceneObjects);
+
+		// Serialization
+		UINT8* serializedData = nullptr;
+		UINT32 serializedSize = 0;
+		auto freeSerializedData = [&]()
+		{
+			if (serializedData != nullptr)
+				bs_free(serializedData);
+
+			serializedData = nullptr;
+		};
+
+		// Not instantiating so the decoded copy doesn't get added to the scene
+		root->_setFlags(SOF_DontInstantiate);
+
+		measure("scene.serialize", numSceneObjects, nullptr,
+			[&]()
+			{
+				MemorySerializer serializer;
+				serializedData = serializer.encode(root.get(), serializedSize);
+			},
+			freeSerializedData);
+
+		{
+			MemorySerializer serializer;
+			serializedData = serializer.encode(root.get(), serializedSize);
+			root->_unsetFlags(SOF_DontInstantiate);
+
+			SPtr<SceneObject> decoded;
+			measure("scene.deserialize", numSceneObjects, nullptr,
+				[&]()
+				{
+					GameObjectManager::instance().setDeserializationMode(GODM_UseNewIds | GODM_BreakExternal);
+
+					MemorySerializer decodeSerializer;
+					decoded = std::static_pointer_cast<SceneObject>(decodeSerializer.decode(serializedData,
+						serializedSize));
+				},
+				[&]()
+				{
+					if (decoded != nullptr)
+						decoded->destroy(true);
+
+					decoded = nullptr;
+				});
+
+			freeSerializedData();
+		}
+
+		// Undo/redo
+		measure("undo.record", numSceneObjects, nullptr,
+			[&]() { CmdRecordSO::execute(root, true); },
+			[]() { UndoRedo::instance().clear(); });
+
+		measure("undo.revert", numSceneObjects,
+			[&]()
+			{
+				CmdRecordSO::execute(root, true);
+				root->setName("Modified");
+			},
+			[]() { UndoRedo::instance().undo(); },
+			[]() { UndoRedo::instance().clear(); });
+
+		// Prefab diff, with every 100th object renamed
+		{
+			HPrefab prefab = Prefab::create(root);
+
+			UINT32 numModified = 0;
+			std::function<void(const HSceneObject&)> modify = [&](const HSceneObject& so)
+			{
+				if ((numModified++ % 100) == 0)
+					so->setName(so->getName() + "_Modified");
+
+				UINT32 numChildren = so->getNumChildren();
+				for (UINT32 i = 0; i < numChildren; i++)
+					modify(so->getChild(i));
+			};
+
+			modify(root);
+
+			SPtr<PrefabDiff> diff;
+			measure("prefab.diff", numSceneObjects, nullptr,
+				[&]() { diff = PrefabDiff::create(prefab->_getRoot(), root); },
+				[&]() { diff = nullptr; });
+
+			root->breakPrefabLink();
+			gResources().release(prefab);
+		}
+
+		// Scene tree view, building all the elements from scratch and then just checking for changes
+		{
+			GUISceneTreeView* treeView = nullptr;
+			measure("treeview.build", numSceneObjects,
+				[&]() { treeView = GUISceneTreeView::create(); },
+				[&]() { treeView->_update(); },
+				[&]()
+				{
+					GUIElement::destroy(treeView);
+					treeView = nullptr;
+				});
+
+			treeView = GUISceneTreeView::create();
+			treeView->_update();
+
+			measure("treeview.sync", numSceneObjects, nullptr,
+				[&]() { treeView->_update(); },
+				nullptr);
+
+			GUIElement::destroy(treeView);
+		}
+
+		destroyRoot();
+	}
+
+	void EditorBenchmarks::runLibraryBenchmarks()
+	{
+		Path previousProject = gEditorApplication().getProjectPath();
+
+		Path projectPath = FileSystem::getTempDirectoryPath();
+		projectPath.append("BansheeEditorBenchmark/");
+
+		if (FileSystem::exists(projectPath))
+			FileSystem::remove(projectPath, true);
+
+		gEditorApplication().createProject(projectPath);
+		generateProject(Path::combine(projectPath, ProjectLibrary::RESOURCES_DIR));
+
+		UINT32 numEntries = mDesc.numLibraryEntries;
+
+		// Project load includes the script assembly reload
+		measure("project.load", numEntries, nullptr,
+			[&]() { gEditorApplication().loadProject(projectPath); },
+			nullptr);
+
+		ProjectLibrary& library = gProjectLibrary();
+		const Path& resourcesFolder = library.getResourcesFolder();
+
+		// Initial scan imports all files, later ones only check for modifications
+		measure("library.import", numEntries, nullptr,
+			[&]()
+			{
+				library.checkForModifications(resourcesFolder);
+				library._finishQueuedImports(true);
+			},
+			nullptr, 1);
+
+		library.saveLibrary();
+
+		// Saving only registers the saved entry, so it shouldn't scale with the number of entries in the library
+		HSceneObject sceneRoot = generateScene(1000);
+		HPrefab scene = Prefab::create(sceneRoot);
+		library.createEntry(scene, "BenchmarkScene.prefab");
+
+		// File times have a resolution of one second, so without resetting the import time most iterations would
+		// consider the saved file up to date and skip the reimport a real save goes through
+		ProjectLibrary::LibraryEntry* sceneEntry = library.findEntry(library.uuidToPath(scene.getUUID()));
+		auto markSceneModified = [sceneEntry]()
+		{
+			if (sceneEntry != nullptr && sceneEntry->type == ProjectLibrary::LibraryEntryType::File)
+				static_cast<ProjectLibrary::FileEntry*>(sceneEntry)->lastUpdateTime = 0;
+		};
+
+		measure("library.save", numEntries, markSceneModified,
+			[&]() { library.saveEntry(scene); },
+			nullptr);
+
+		sceneRoot->destroy(true);
+
+		measure("library.scan", numEntries, nullptr,
+			[&]() { library.checkForModifications(resourcesFolder); },
+			nullptr);
+
+		measure("library.search", numEntries, nullptr,
+			[&]() { library.search("*7*"); },
+			nullptr);
+
+		measure("library.load", numEntries, nullptr,
+			[&]() { library.loadLibrary(); },
+			nullptr);
+
+		measure("scripts.reload", 0, nullptr,
+			[]() { ScriptManager::instance().reload(); },
+			nullptr);
+
+		gEditorApplication().unloadProject();
+		FileSystem::remove(projectPath, true);
+
+		if (!previousProject.isEmpty())
+			gEditorApplication().loadProject(previousProject);
+	}
+
+	HSceneObject EditorBenchmarks::generateScene(UINT32 numSceneObjects) const
+	{
+		HSceneObject root = SceneObject::create("BenchmarkRoot");
+		if (numSceneObjects == 0)
+			return root;
+
+		UINT32 branching = std::max(mDesc.sceneBranching, 1U);
+
+		// Breadth first, so parents are always created before their children
+		Vector<HSceneObject> sceneObjects(numSceneObjects);
+		for (UINT32 i = 0; i < numSceneObjects; i++)
+		{
+			HSceneObject so = SceneObject::create("SO" + toString(i));
+			so->setPosition(Vector3((float)(i % 100), (float)(i / 100 % 100), (float)(i / 10000)));
+
+			if (i < branching)
+				so->setParent(root, false);
+			else
+				so->setParent(sceneObjects[i / branching - 1], false);
+
+			sceneObjects[i] = so;
+		}
+
+		return root;
+	}
+
+	void EditorBenchmarks::generateProject(const Path& folder) const
+	{
+		UINT32 entriesPerFolder = std::max(mDesc.libraryEntriesPerFolder, 1U);
+
+		Path currentFolder;
+		for (UINT32 i = 0; i < mDesc.numLibraryEntries; i++)
+		{
+			if ((i % entriesPerFolder) == 0)
+			{
+				currentFolder = folder;
+				currentFolder.append("Folder" + toString(i / entriesPerFolder) + "/");
+
+				FileSystem::createDir(currentFolder);
+			}
+
+			Path filePath = currentFolder;
+			filePath.append("File" + toString(i) + ".txt");
+
+			String contents = "Benchmark file " + toString(i);
+
+			SPtr<DataStream> stream = FileSystem::createAndOpenFile(filePath);
+			stream->write(contents.data(), contents.size());
+			stream->close();
+		}
+	}
+
+	String EditorBenchmarks::toJson() const
+	{
+		StringStream output;
+		output << "{\"benchmarks\":[\n";
+
+		for (UINT32 i = 0; i < (UINT32)mResults.size(); i++)
+		{
+			const EditorBenchmarkResult& result = mResults[i];
+
+			if (i > 0)
+				output << ",\n";
+
+			output << "{\"name\":\"" << result.name << "\",\"count\":" << result.count << ",\"iterations\":"
+				<< result.numIterations << ",\"min_ms\":" << result.minMs << ",\"avg_ms\":" << result.avgMs
+				<< ",\"max_ms\":" << result.maxMs << "}";
+		}
+
+		output << "\n]}\n";
+		return output.str();
+	}
+
+	void EditorBenchmarks::saveJson(const Path& path) const
+	{
+		String output = toJson();
+
+		SPtr<DataStream> stream = FileSystem::createAndOpenFile(path);
+		stream->write(output.c_str(), output.size() * sizeof(String::value_type));
+		stream->close();
+	}
+}
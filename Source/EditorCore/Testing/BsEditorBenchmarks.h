@@ -0,0 +1,114 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsEditorPrerequisites.h"
+
+namespace bs
+{
+	/** @addtogroup Testing-Editor
+	 *  @{
+	 */
+
+	/** Settings used for generating the synthetic data the editor benchmarks run on. */
+	struct EDITOR_BENCHMARK_DESC
+	{
+		/** Number of scene objects in each generated scene. A benchmark set is ran for every entry. */
+		Vector<UINT32> sceneSizes = { 10000, 100000, 1000000 };
+
+		/** Number of children of each generated scene object, determining the depth of the generated hierarchy. */
+		UINT32 sceneBranching = 10;
+
+		/** Number of files in the generated project. Zero disables project library benchmarks. */
+		UINT32 numLibraryEntries = 100000;
+
+		/** Number of files in each folder of the generated project. */
+		UINT32 libraryEntriesPerFolder = 100;
+
+		/** Number of times to run each benchmark. Reported times include the minimum, average and maximum. */
+		UINT32 numIterations = 3;
+	};
+
+	/** Timing results of a single benchmark. */
+	struct EditorBenchmarkResult
+	{
+		String name;
+		UINT32 count = 0; /**< Number of items the benchmark operated on (e.g. scene objects or library entries). */
+		UINT32 numIterations = 0;
+		double minMs = 0.0;
+		double avgMs = 0.0;
+		double maxMs = 0.0;
+	};
+
+	/**
+	 * Measures performance of editor subsystems on generated scenes and projects: scene creation and serialization,
+	 * undo/redo recording, prefab diffs, scene tree view synchronization, project library scans, saves, searches and
+	 * loads, and script assembly reload. None of the benchmarks render anything, so they can be ran with the editor
+	 * window hidden and the main loop never started (see the --benchmark command line option).
+	 *
+	 * @note
+	 * Project library benchmarks load a generated project in a temporary folder, replacing the currently loaded
+	 * project.
+	 */
+	class BS_ED_EXPORT EditorBenchmarks
+	{
+	public:
+		EditorBenchmarks(const EDITOR_BENCHMARK_DESC& desc);
+
+		/** Runs all the benchmarks. Results from any previous runs are cleared. */
+		void run();
+
+		/**
+		 * Runs a single benchmark and records its result.
+		 *
+		 * @param[in]	name			Unique name of the benchmark, as output in the results.
+		 * @param[in]	count			Number of items the benchmark operates on.
+		 * @param[in]	setup			Optional callback triggered before every iteration, not included in the timing.
+		 * @param[in]	benchmark		Callback performing the measured operation.
+		 * @param[in]	teardown		Optional callback triggered after every iteration, not included in the timing.
+		 * @param[in]	numIterations	Number of times to run the benchmark. If zero the number provided on
+		 *								construction is used.
+		 */
+		void measure(const String& name, UINT32 count, const std::function<void()>& setup,
+			const std::function<void()>& benchmark, const std::function<void()>& teardown, UINT32 numIterations = 0);
+
+		/**
+		 * Records the result of a benchmark timed by the caller, for benchmarks that cannot be ran through measure() (e.g.
+		 * ones timed in managed code).
+		 */
+		void addResult(const EditorBenchmarkResult& result);
+
+		/** Returns the results of all benchmarks ran so far. */
+		const Vector<EditorBenchmarkResult>& getResults() const { return mResults; }
+
+		/** Returns the results of all benchmarks ran so far, in JSON format. */
+		String toJson() const;
+
+		/** Saves the results of all benchmarks ran so far into a JSON file at the specified path. */
+		void saveJson(const Path& path) const;
+
+		/**
+		 * Triggered at the end of run(), allowing systems the editor core doesn't know about (e.g. the scripting plugin)
+		 * to run their own benchmarks and record them in the same results.
+		 */
+		static Event<void(EditorBenchmarks&)> onRun;
+
+	private:
+		/** Runs benchmarks operating on a generated scene of the provided size. */
+		void runSceneBenchmarks(UINT32 numSceneObjects);
+
+		/** Runs benchmarks on a generated project and the project library. */
+		void runLibraryBenchmarks();
+
+		/** Generates a hierarchy with the provided number of scene objects under a new root object, and returns the root. */
+		HSceneObject generateScene(UINT32 numSceneObjects) const;
+
+		/** Generates a project with the configured number of files and folders in the provided folder. */
+		void generateProject(const Path& folder) const;
+
+		EDITOR_BENCHMARK_DESC mDesc;
+		Vector<EditorBenchmarkResult> mResults;
+	};
+
+	/** @} */
+}
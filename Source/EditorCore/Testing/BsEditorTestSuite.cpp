@@ -15,6 +15,15 @@
 #include "Scene/BsPrefabDiff.h"
 #include "FileSystem/BsFileSystem.h"
 #include "Scene/BsSceneManager.h"
+#include "Library/BsChunkedScene.h"
+#include "Scene/BsPrefabInstanceRegistry.h"
+#include "Library/BsFileChangeBatcher.h"
+#include "EditorWindow/BsEditorWidget.h"
+#include "EditorWindow/BsEditorWidgetManager.h"
+#include "EditorWindow/BsEditorWidgetContainer.h"
+#include "GUI/BsGUIWidget.h"
+#include "Utility/BsBuiltinEditorResources.h"
+#include "FileSystem/BsDataStream.h"
 
 namespace bs
 {
@@ -405,6 +414,20 @@ namespace bs
 		return TestComponentD::getRTTIStatic();
 	}
 
+	class TestEditorWidget : public EditorWidgetBase
+	{
+	public:
+		TestEditorWidget(const String& name, EditorWidgetContainer& parentContainer)
+			:EditorWidgetBase(HString(name), name, 200, 200, parentContainer)
+		{ }
+
+		void update() override { numUpdates++; }
+		void suspendedUpdate() override { numSuspendedUpdates++; }
+
+		UINT32 numUpdates = 0;
+		UINT32 numSuspendedUpdates = 0;
+	};
+
 	EditorTestSuite::EditorTestSuite()
 	{
 		BS_ADD_TEST(EditorTestSuite::SceneObjectRecord_UndoRedo);
@@ -413,6 +436,15 @@ namespace bs
 		BS_ADD_TEST(EditorTestSuite::TestPrefabComplex);
 		BS_ADD_TEST(EditorTestSuite::TestPrefabDiff);
 		BS_ADD_TEST(EditorTestSuite::TestFrameAlloc);
+
+		// Writes to the file system, so avoid running it on every launch of release builds
+#if BS_DEBUG_MODE
+		BS_ADD_TEST(EditorTestSuite::TestChunkedScene);
+#endif
+
+		BS_ADD_TEST(EditorTestSuite::TestPrefabInstanceRegistry);
+		BS_ADD_TEST(EditorTestSuite::TestFileChangeBatcher);
+		BS_ADD_TEST(EditorTestSuite::TestWidgetSuspension);
 	}
 
 	void EditorTestSuite::SceneObjectRecord_UndoRedo()
@@ -807,4 +839,316 @@ namespace bs
 		alloc.free(a13);
 		alloc.clear();
 	}
+
+	void EditorTestSuite::TestChunkedScene()
+	{
+		Path folder = FileSystem::getTempDirectoryPath();
+		folder.append("BansheeChunkedSceneTest/");
+
+		if (FileSystem::exists(folder))
+			FileSystem::remove(folder, true);
+
+		HSceneObject root = SceneObject::create("root");
+		HSceneObject so0 = SceneObject::create("so0");
+		HSceneObject so1 = SceneObject::create("so1");
+		HSceneObject so2 = SceneObject::create("so2");
+		HSceneObject so3 = SceneObject::create("so3");
+		HSceneObject so1_0 = SceneObject::create("so1_0");
+
+		so0->setParent(root);
+		so1->setParent(root);
+		so2->setParent(root);
+		so3->setParent(root);
+		so1_0->setParent(so1);
+
+		GameObjectHandle<TestComponentA> cmpA = so1->addComponent<TestComponentA>();
+		cmpA->ref1 = so1_0;
+
+		GameObjectHandle<TestComponentB> cmpB = so2->addComponent<TestComponentB>();
+		cmpB->val1 = "InitialValue";
+
+		// References to objects in other chunks, both ones loaded before and after the referencing chunk
+		cmpA->ref2 = cmpB;
+		cmpB->ref1 = so1_0;
+
+		ChunkedScene chunkedScene(folder);
+		ChunkedSceneSaveStats stats = chunkedScene.save(root);
+		BS_TEST_ASSERT(stats.numChunks == 4 && stats.numChunksWritten == 4);
+
+		// Nothing changed
+		stats = chunkedScene.save(root);
+		BS_TEST_ASSERT(stats.numChunks == 4 && stats.numChunksWritten == 0);
+
+		// Only the modified subtree is written, and chunks of deleted objects removed. The chunk of so1 is kept, along
+		// with its reference to so2.
+		cmpB->val1 = "ModifiedValue";
+		so0->destroy(true);
+
+		stats = chunkedScene.save(root);
+		BS_TEST_ASSERT(stats.numChunks == 3 && stats.numChunksWritten == 1 && stats.numChunksRemoved == 1);
+
+		HSceneObject newRoot = SceneObject::create("newRoot");
+
+		ChunkedScene loadedScene(folder);
+		BS_TEST_ASSERT(loadedScene.getEntries().size() == 3);
+
+		// Load a step at a time. so1 and so2 reference each other, so are loaded together, followed by so3.
+		loadedScene.beginLoad(newRoot);
+
+		UINT32 numSteps = 0;
+		while (!loadedScene.loadStep(0.0f))
+		{
+			numSteps++;
+
+			// Chunks are instantiated as soon as they are loaded
+			BS_TEST_ASSERT(newRoot->getNumChildren() == 2);
+			BS_TEST_ASSERT(!newRoot->getChild(0)->hasFlag(SOF_DontInstantiate));
+			BS_TEST_ASSERT(loadedScene.getLoadProgress() > 0.0f && loadedScene.getLoadProgress() < 1.0f);
+		}
+
+		BS_TEST_ASSERT(numSteps == 1);
+		BS_TEST_ASSERT(!loadedScene.isLoading());
+		BS_TEST_ASSERT(loadedScene.getLoadProgress() == 1.0f);
+		BS_TEST_ASSERT(newRoot->getNumChildren() == 3);
+		BS_TEST_ASSERT(newRoot->getChild(0)->getName() == "so1");
+		BS_TEST_ASSERT(newRoot->getChild(1)->getName() == "so2");
+		BS_TEST_ASSERT(newRoot->getChild(2)->getName() == "so3");
+
+		GameObjectHandle<TestComponentA> loadedCmpA = newRoot->getChild(0)->getComponent<TestComponentA>();
+		BS_TEST_ASSERT(loadedCmpA != nullptr && loadedCmpA->ref1 == newRoot->getChild(0)->getChild(0));
+
+		GameObjectHandle<TestComponentB> loadedCmpB = newRoot->getChild(1)->getComponent<TestComponentB>();
+		BS_TEST_ASSERT(loadedCmpB != nullptr && loadedCmpB->val1 == "ModifiedValue");
+
+		// References between chunks point to the loaded objects, rather than being broken
+		BS_TEST_ASSERT(loadedCmpA->ref2 == loadedCmpB);
+		BS_TEST_ASSERT(loadedCmpB->ref1 == newRoot->getChild(0)->getChild(0));
+
+		// Loaded scene objects are recognized by the chunked scene they were loaded from
+		stats = loadedScene.save(newRoot);
+		BS_TEST_ASSERT(stats.numChunks == 3 && stats.numChunksWritten == 0);
+
+		// References from chunks that weren't rewritten still resolve, even though the referenced objects were saved with
+		// different instance IDs
+		loadedCmpB->val1 = "ReloadedValue";
+
+		stats = loadedScene.save(newRoot);
+		BS_TEST_ASSERT(stats.numChunks == 3 && stats.numChunksWritten == 1);
+
+		HSceneObject reloadedRoot = SceneObject::create("reloadedRoot");
+
+		ChunkedScene reloadedScene(folder);
+		reloadedScene.beginLoad(reloadedRoot);
+		reloadedScene.loadAll();
+
+		GameObjectHandle<TestComponentA> reloadedCmpA = reloadedRoot->getChild(0)->getComponent<TestComponentA>();
+		GameObjectHandle<TestComponentB> reloadedCmpB = reloadedRoot->getChild(1)->getComponent<TestComponentB>();
+		BS_TEST_ASSERT(reloadedCmpB != nullptr && reloadedCmpB->val1 == "ReloadedValue");
+		BS_TEST_ASSERT(reloadedCmpA != nullptr && reloadedCmpA->ref2 == reloadedCmpB);
+		BS_TEST_ASSERT(reloadedCmpB->ref1 == reloadedRoot->getChild(0)->getChild(0));
+
+		root->destroy();
+		newRoot->destroy();
+		reloadedRoot->destroy();
+
+		FileSystem::remove(folder, true);
+	}
+
+	void EditorTestSuite::TestPrefabInstanceRegistry()
+	{
+		// Keep the test objects hidden from the user's scene, and out of it when it is saved
+		HSceneObject testRoot = SceneObject::create("PrefabInstanceRegistryTest", SOF_Internal | SOF_DontSave);
+
+		HSceneObject root = SceneObject::create("root");
+		root->setParent(testRoot);
+
+		HSceneObject child = SceneObject::create("child");
+		child->setParent(root);
+
+		GameObjectHandle<TestComponentB> cmp = child->addComponent<TestComponentB>();
+		cmp->val1 = "InitialValue";
+
+		HPrefab prefab = Prefab::create(root, false);
+
+		HSceneObject instance0 = prefab->instantiate();
+		HSceneObject instance1 = prefab->instantiate();
+		HSceneObject instance2 = prefab->instantiate();
+
+		instance0->setParent(testRoot);
+		instance1->setParent(testRoot);
+		instance2->setParent(testRoot);
+
+		// Instance specific modification, must survive the prefab update
+		instance1->getChild(0)->getComponent<TestComponentB>()->val1 = "InstanceValue";
+
+		instance0->getChild(0)->setName("modified");
+		instance0->getChild(0)->getComponent<TestComponentB>()->val1 = "ModifiedValue";
+
+		// Instances are normally registered by the systems that create them
+		PrefabInstanceRegistry& registry = PrefabInstanceRegistry::instance();
+		registry.registerInstances(instance0);
+		registry.registerInstances(instance1);
+		registry.registerInstances(instance2);
+
+		registry.applyPrefab(instance0, prefab);
+
+		BS_TEST_ASSERT(registry.getInstances(prefab.getUUID()).size() == 3);
+		BS_TEST_ASSERT(registry.isUpdating());
+
+		registry.completeUpdates();
+		BS_TEST_ASSERT(!registry.isUpdating());
+
+		HSceneObject child1 = instance1->getChild(0);
+		BS_TEST_ASSERT(child1->getName() == "modified");
+		BS_TEST_ASSERT(child1->getComponent<TestComponentB>()->val1 == "InstanceValue");
+
+		HSceneObject child2 = instance2->getChild(0);
+		BS_TEST_ASSERT(child2->getName() == "modified");
+		BS_TEST_ASSERT(child2->getComponent<TestComponentB>()->val1 == "ModifiedValue");
+
+		testRoot->destroy();
+		gResources().release(prefab);
+	}
+
+	void EditorTestSuite::TestFileChangeBatcher()
+	{
+		const UINT32 NUM_FILES = 1000;
+
+		// Only the paths are used, nothing is written to disk
+		Path folder = FileSystem::getTempDirectoryPath();
+		folder.append("BansheeFileChangeTest/");
+
+		Path subFolder = folder;
+		subFolder.append("Sub/");
+
+		FileChangeBatcher batcher(100, 1000);
+		UINT64 time = 0;
+
+		// Burst of notifications a folder monitor would report, ten files per millisecond. Each file is reported as
+		// added and then modified.
+		batcher.addChange(subFolder, time);
+
+		UINT32 numBatches = 0;
+		for (UINT32 i = 0; i < NUM_FILES; i++)
+		{
+			Path filePath = Path::combine(i % 2 == 0 ? folder : subFolder, "File" + toString(i) + ".txt");
+
+			batcher.addChange(filePath, time);
+			batcher.addChange(filePath, time);
+
+			if ((i % 10) == 9)
+				time++;
+
+			if (!batcher.update(time).empty())
+				numBatches++;
+		}
+
+		// Nothing reported while changes keep arriving
+		BS_TEST_ASSERT(numBatches == 0);
+		BS_TEST_ASSERT(batcher.getNumChangesReceived() == NUM_FILES * 2 + 1);
+
+		Vector<Path> changes = batcher.update(time + 1);
+		BS_TEST_ASSERT(changes.empty());
+
+		// Once settled, a single batch with every path once, and files in the added folder folded into the folder
+		changes = batcher.update(time + 100);
+		BS_TEST_ASSERT(changes.size() == NUM_FILES / 2 + 1);
+		BS_TEST_ASSERT(!batcher.hasPendingChanges());
+
+		for (auto& entry : changes)
+			BS_TEST_ASSERT(entry == subFolder || !subFolder.includes(entry));
+
+		BS_TEST_ASSERT(batcher.update(time + 200).empty());
+
+		// Many files in the same folder coalesce into the folder, a few don't
+		Vector<Path> coalesced = FileChangeBatcher::coalesce(changes, 16);
+		BS_TEST_ASSERT(coalesced.size() == 1 && coalesced[0] == folder);
+
+		Vector<Path> fewChanges = { Path::combine(folder, "File0.txt"), Path::combine(folder, "File2.txt"), subFolder };
+		coalesced = FileChangeBatcher::coalesce(fewChanges, 16);
+		BS_TEST_ASSERT(coalesced.size() == 3);
+
+		// Renames report both paths, and changes are reported after the maximum delay even if they keep arriving
+		Path fromPath = Path::combine(folder, "File0.txt");
+		Path toPath = Path::combine(folder, "Renamed.txt");
+
+		time += 1000;
+		batcher.addRename(fromPath, toPath, time);
+
+		numBatches = 0;
+		for (UINT32 i = 0; i < 1000; i += 50)
+		{
+			batcher.addChange(toPath, time + i);
+
+			changes = batcher.update(time + i + 50);
+			if (!changes.empty())
+			{
+				BS_TEST_ASSERT(changes.size() == 2);
+				numBatches++;
+			}
+		}
+
+		BS_TEST_ASSERT(numBatches == 1);
+		BS_TEST_ASSERT(!batcher.hasPendingChanges());
+	}
+
+	void EditorTestSuite::TestWidgetSuspension()
+	{
+		const UINT32 NUM_FRAMES = 10;
+
+		EditorWidgetManager& widgetManager = EditorWidgetManager::instance();
+		widgetManager.registerWidget("TestWidgetA",
+			[](EditorWidgetContainer& parent) { return bs_new<TestEditorWidget>("TestWidgetA", parent); });
+		widgetManager.registerWidget("TestWidgetB",
+			[](EditorWidgetContainer& parent) { return bs_new<TestEditorWidget>("TestWidgetB", parent); });
+
+		// Container isn't docked in an editor window, and its GUI widget has no camera, so no OS window gets created.
+		// Both widgets are docked as tabs in the container, with the first one added being the active tab.
+		SPtr<GUIWidget> guiWidget = GUIWidget::create(nullptr);
+		guiWidget->setSkin(BuiltinEditorResources::instance().getSkin());
+
+		EditorWidgetContainer* container = bs_new<EditorWidgetContainer>(guiWidget.get(), nullptr);
+		auto widgetA = static_cast<TestEditorWidget*>(widgetManager.create("TestWidgetA", *container));
+		auto widgetB = static_cast<TestEditorWidget*>(widgetManager.create("TestWidgetB", *container));
+
+		BS_TEST_ASSERT(widgetA->isVisible());
+		BS_TEST_ASSERT(!widgetB->isVisible());
+
+		UINT64 numUpdates = widgetManager.getNumWidgetUpdates();
+		UINT64 numSuspendedUpdates = widgetManager.getNumSuspendedWidgetUpdates();
+
+		for (UINT32 i = 0; i < NUM_FRAMES; i++)
+			container->update();
+
+		BS_TEST_ASSERT(widgetA->numUpdates == NUM_FRAMES);
+		BS_TEST_ASSERT(widgetA->numSuspendedUpdates == 0);
+		BS_TEST_ASSERT(widgetB->numUpdates == 0);
+		BS_TEST_ASSERT(widgetB->numSuspendedUpdates == NUM_FRAMES);
+		BS_TEST_ASSERT(widgetManager.getNumWidgetUpdates() - numUpdates == NUM_FRAMES);
+		BS_TEST_ASSERT(widgetManager.getNumSuspendedWidgetUpdates() - numSuspendedUpdates == NUM_FRAMES);
+
+		// Switching tabs resumes the newly active widget, and suspends the previous one
+		widgetB->setActive();
+
+		BS_TEST_ASSERT(!widgetA->isVisible());
+		BS_TEST_ASSERT(widgetB->isVisible());
+
+		for (UINT32 i = 0; i < NUM_FRAMES; i++)
+			container->update();
+
+		BS_TEST_ASSERT(widgetA->numUpdates == NUM_FRAMES);
+		BS_TEST_ASSERT(widgetA->numSuspendedUpdates == NUM_FRAMES);
+		BS_TEST_ASSERT(widgetB->numUpdates == NUM_FRAMES);
+		BS_TEST_ASSERT(widgetB->numSuspendedUpdates == NUM_FRAMES);
+		BS_TEST_ASSERT(widgetManager.getNumWidgetUpdates() - numUpdates == NUM_FRAMES * 2);
+		BS_TEST_ASSERT(widgetManager.getNumSuspendedWidgetUpdates() - numSuspendedUpdates == NUM_FRAMES * 2);
+
+		widgetA->close();
+		widgetB->close();
+		bs_delete(container);
+		guiWidget->_destroy();
+
+		widgetManager.unregisterWidget("TestWidgetA");
+		widgetManager.unregisterWidget("TestWidgetB");
+	}
 }
\ No newline at end of file
@@ -93,6 +93,21 @@ namespace bs
 
 		/**	Tests the frame allocator. */
 		void TestFrameAlloc();
+
+		/**
+		 * Tests saving and loading of a chunked scene, including incremental saves. Only runs in debug builds, as it
+		 * writes to a temporary folder.
+		 */
+		void TestChunkedScene();
+
+		/** Tests propagation of prefab changes to prefab instances through the prefab instance registry. */
+		void TestPrefabInstanceRegistry();
+
+		/** Tests coalescing and debouncing of file change notifications on a burst of file writes. */
+		void TestFileChangeBatcher();
+
+		/** Tests that widgets on inactive tabs are skipped when updating their parent widget container. */
+		void TestWidgetSuspension();
 	};
 
 	/** @} */
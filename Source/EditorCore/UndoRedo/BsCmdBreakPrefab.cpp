@@ -2,6 +2,7 @@
 //**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
 #include "UndoRedo/BsCmdBreakPrefab.h"
 #include "Scene/BsSceneObject.h"
+#include "Scene/BsPrefabInstanceRegistry.h"
 
 namespace bs
 {
@@ -127,6 +128,8 @@ namespace bs
 					todo.push(child);
 			}
 		}
+
+		PrefabInstanceRegistry::instance().registerInstances(mPrefabRoot);
 	}
 
 	void CmdBreakPrefab::clear()
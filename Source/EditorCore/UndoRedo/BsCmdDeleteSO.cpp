@@ -4,6 +4,7 @@
 #include "Scene/BsSceneObject.h"
 #include "Scene/BsComponent.h"
 #include "Serialization/BsMemorySerializer.h"
+#include "Scene/BsPrefabInstanceRegistry.h"
 
 namespace bs
 {
@@ -76,6 +77,7 @@ namespace bs
 		restored->setParent(parent);
 
 		restored->_instantiate();
+		PrefabInstanceRegistry::instance().registerInstances(restored->getHandle());
 	}
 
 	void CmdDeleteSO::recordSO(const HSceneObject& sceneObject)
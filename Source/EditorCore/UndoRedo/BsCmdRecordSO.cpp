@@ -4,6 +4,7 @@
 #include "Scene/BsSceneObject.h"
 #include "Scene/BsComponent.h"
 #include "Serialization/BsMemorySerializer.h"
+#include "Scene/BsPrefabInstanceRegistry.h"
 
 namespace bs
 {
@@ -91,6 +92,7 @@ namespace bs
 		}
 
 		restored->_instantiate();
+		PrefabInstanceRegistry::instance().registerInstances(restored->getHandle());
 	}
 
 	void CmdRecordSO::recordSO(const HSceneObject& sceneObject)
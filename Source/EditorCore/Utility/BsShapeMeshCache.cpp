@@ -0,0 +1,115 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "Utility/BsShapeMeshCache.h"
+#include "Mesh/BsMesh.h"
+#include "RenderAPI/BsVertexDataDesc.h"
+#include "Renderer/BsCamera.h"
+
+namespace bs
+{
+	void ShapeMeshCache::addToHash(const String& value)
+	{
+		UINT32 size = (UINT32)value.size();
+		addBytesToHash(&size, sizeof(size));
+		addBytesToHash(value.data(), size);
+	}
+
+	void ShapeMeshCache::addBytesToHash(const void* data, UINT32 size)
+	{
+		mHash = hashBytes(mHash, data, size);
+	}
+
+	const Vector<DrawHelper::ShapeMeshData>& ShapeMeshCache::getMeshes(DrawHelper& drawHelper, const Camera& camera,
+		UINT64 layers)
+	{
+		// Shapes are sorted back to front, so the same shapes need to be rebuilt if the camera moved
+		Vector3 cameraPosition = camera.getTransform().getPosition();
+
+		UINT64 key = hashBytes(mHash, &cameraPosition, sizeof(cameraPosition));
+		key = hashBytes(key, &layers, sizeof(layers));
+
+		CameraEntry& entry = mEntries[&camera];
+		entry.used = true;
+
+		UINT32 numMeshes = 0;
+		if (entry.key == key && !entry.meshes.empty())
+		{
+			mStats.bytesReused += getMeshBytes(entry.meshes, numMeshes);
+			mStats.numMeshesReused += numMeshes;
+
+			return entry.meshes;
+		}
+
+		// Old meshes are released once the core thread is done with them, as the render proxies hold core references
+		entry.meshes = drawHelper.buildMeshes(DrawHelper::SortType::BackToFront, cameraPosition, layers);
+		entry.key = key;
+
+		mStats.bytesUploaded += getMeshBytes(entry.meshes, numMeshes);
+		mStats.numMeshesBuilt += numMeshes;
+
+		return entry.meshes;
+	}
+
+	void ShapeMeshCache::clear()
+	{
+		mHash = FNV_OFFSET;
+	}
+
+	void ShapeMeshCache::endFrame()
+	{
+		for (auto iter = mEntries.begin(); iter != mEntries.end();)
+		{
+			if (!iter->second.used)
+				iter = mEntries.erase(iter);
+			else
+			{
+				iter->second.used = false;
+				++iter;
+			}
+		}
+
+		mLastFrameStats = mStats;
+		mStats = EditorMeshStats();
+	}
+
+	void ShapeMeshCache::reset()
+	{
+		mEntries.clear();
+	}
+
+	UINT64 ShapeMeshCache::hashBytes(UINT64 hash, const void* data, UINT32 size)
+	{
+		// FNV-1a
+		const UINT8* bytes = (const UINT8*)data;
+		for (UINT32 i = 0; i < size; i++)
+		{
+			hash ^= bytes[i];
+			hash *= FNV_PRIME;
+		}
+
+		return hash;
+	}
+
+	UINT64 ShapeMeshCache::getMeshBytes(const Vector<DrawHelper::ShapeMeshData>& meshes, UINT32& numMeshes)
+	{
+		UINT64 numBytes = 0;
+		numMeshes = 0;
+
+		// Multiple entries can reference different sub-meshes of the same mesh
+		const Mesh* lastMesh = nullptr;
+		for (auto& entry : meshes)
+		{
+			if (entry.mesh == nullptr || entry.mesh.get() == lastMesh)
+				continue;
+
+			lastMesh = entry.mesh.get();
+
+			const MeshProperties& props = entry.mesh->getProperties();
+			numBytes += props.getNumVertices() * (UINT64)entry.mesh->getVertexDesc()->getVertexStride();
+			numBytes += props.getNumIndices() * (UINT64)sizeof(UINT32);
+			numMeshes++;
+		}
+
+		return numBytes;
+	}
+}
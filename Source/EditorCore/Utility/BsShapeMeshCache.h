@@ -0,0 +1,131 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsEditorPrerequisites.h"
+#include "Utility/BsDrawHelper.h"
+
+namespace bs
+{
+	/** @addtogroup Utility-Editor-Internal
+	 *  @{
+	 */
+
+	/** Statistics about meshes used for rendering editor shapes (e.g. handles or gizmos), during a single frame. */
+	struct EditorMeshStats
+	{
+		UINT32 numMeshesBuilt = 0; /**< Number of meshes created this frame. */
+		UINT32 numMeshesReused = 0; /**< Number of meshes from a previous frame rendered this frame. */
+		UINT64 bytesUploaded = 0; /**< Number of bytes of vertex and index data written to the GPU this frame. */
+		UINT64 bytesReused = 0; /**< Number of bytes of vertex and index data rendered without being re-written. */
+		UINT32 numTransientMeshes = 0; /**< Number of meshes sub-allocated from a persistent mesh heap this frame. */
+		UINT64 bytesTransient = 0; /**< Number of bytes written into persistent mesh heap buffers this frame. */
+	};
+
+	/** Identifies the type of a shape queued in a DrawHelper, when hashing the shape in ShapeMeshCache. */
+	enum class DrawShape : UINT32
+	{
+		Cube, Sphere, WireCube, WireSphere, Cone, WireCone, Line, LineList, Disc, WireDisc, Arc, WireArc, WireMesh,
+		Rectangle, Frustum, Text
+	};
+
+	/**
+	 * Keeps the meshes built by a DrawHelper alive across frames and only rebuilds them when the queued shapes change.
+	 * The owner is expected to report every shape queued to the draw helper (and any state the shape depends on, like
+	 * color or transform) through addToHash(), in the same order as it was queued. If the resulting hash and the camera
+	 * position match the previous frame the meshes from that frame are returned without calling
+	 * DrawHelper::buildMeshes().
+	 */
+	class BS_ED_EXPORT ShapeMeshCache
+	{
+	public:
+		/** Appends a plain-old-data value to the hash of the shapes queued since the last call to clear(). */
+		template<class T>
+		void addToHash(const T& value)
+		{
+			static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable types can be hashed directly.");
+			addBytesToHash(&value, sizeof(value));
+		}
+
+		/** Appends all the provided values to the hash of the shapes queued since the last call to clear(), in order. */
+		template<class... Args>
+		void addAllToHash(const Args&... args)
+		{
+			int dummy[] = { 0, (addToHash(args), 0)... };
+			(void)dummy;
+		}
+
+		/** Appends the contents of a string to the hash of the shapes queued since the last call to clear(). */
+		void addToHash(const String& value);
+
+		/** Appends the contents of a memory block to the hash of the shapes queued since the last call to clear(). */
+		void addBytesToHash(const void* data, UINT32 size);
+
+		/**
+		 * Returns meshes for all shapes queued in @p drawHelper. Meshes are only built if the shapes changed since the
+		 * last call for the same camera, otherwise previously built meshes are returned.
+		 *
+		 * @param[in]	drawHelper	Draw helper containing the queued shapes.
+		 * @param[in]	camera		Camera the meshes will be rendered with. Meshes are cached separately per camera.
+		 * @param[in]	layers		Layer bitfield used for filtering the shapes.
+		 * @return					Meshes to render. Remain valid until the next call to this method for the same
+		 *							camera, or until cameras are pruned by endFrame().
+		 */
+		const Vector<DrawHelper::ShapeMeshData>& getMeshes(DrawHelper& drawHelper, const Camera& camera,
+			UINT64 layers = 0xFFFFFFFFFFFFFFFF);
+
+		/**
+		 * Records a mesh that was sub-allocated from a MeshHeap outside of this cache, so it is included in the per-frame
+		 * statistics.
+		 */
+		void addTransientMesh(UINT64 numBytes)
+		{
+			mStats.numTransientMeshes++;
+			mStats.bytesTransient += numBytes;
+		}
+
+		/** Resets the hash of queued shapes. Should be called whenever the draw helper is cleared. */
+		void clear();
+
+		/**
+		 * Releases meshes of cameras that didn't request any meshes since the last call, and resets the per-frame
+		 * statistics. Should be called once per frame before any calls to getMeshes().
+		 */
+		void endFrame();
+
+		/** Releases all cached meshes. */
+		void reset();
+
+		/** Returns statistics about the meshes returned since the last call to endFrame(). */
+		const EditorMeshStats& getStats() const { return mStats; }
+
+		/** Returns statistics about meshes returned during the previous frame. */
+		const EditorMeshStats& getLastFrameStats() const { return mLastFrameStats; }
+
+	private:
+		/** Meshes built for a single camera. */
+		struct CameraEntry
+		{
+			UINT64 key = 0;
+			bool used = false;
+			Vector<DrawHelper::ShapeMeshData> meshes;
+		};
+
+		/** Appends the contents of a memory block to the provided hash and returns the result. */
+		static UINT64 hashBytes(UINT64 hash, const void* data, UINT32 size);
+
+		/** Returns the number of bytes of vertex and index data used by the provided meshes. */
+		static UINT64 getMeshBytes(const Vector<DrawHelper::ShapeMeshData>& meshes, UINT32& numMeshes);
+
+		UINT64 mHash = FNV_OFFSET;
+		UnorderedMap<const Camera*, CameraEntry> mEntries;
+
+		EditorMeshStats mStats;
+		EditorMeshStats mLastFrameStats;
+
+		static constexpr UINT64 FNV_OFFSET = 14695981039346656037ULL;
+		static constexpr UINT64 FNV_PRIME = 1099511628211ULL;
+	};
+
+	/** @} */
+}
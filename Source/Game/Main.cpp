@@ -7,12 +7,14 @@
 #include "Utility/BsGameSettings.h"
 #include "FileSystem/BsFileSystem.h"
 #include "Resources/BsResources.h"
-#include "Resources/BsResourceManifest.h"
 #include "Scene/BsPrefab.h"
 #include "Scene/BsSceneObject.h"
 #include "Scene/BsSceneManager.h"
 #include "RenderAPI/BsRenderAPI.h"
 #include "Resources/BsGameResourceManager.h"
+#include "FileSystem/BsDataStream.h"
+#include "Utility/BsTimer.h"
+#include "Debug/BsDebug.h"
 #include "BsEngineConfig.h"
 
 void runApplication();
@@ -54,8 +56,56 @@ int main()
 
 using namespace bs;
 
+/**
+ * Name of the file listing the main scene and all of its dependencies, in the game resources folder. Must match
+ * BuildManager::PRELOAD_LIST_NAME.
+ */
+static const char* PRELOAD_LIST_NAME = "Preload.txt";
+
+/**
+ * Loads all resources listed in the preload list in parallel, on worker threads, and waits until they're all loaded.
+ * Returned handles must be kept alive until the resources are referenced by the instantiated scene.
+ */
+static Vector<HResource> preloadResources(const Path& preloadListPath)
+{
+	Vector<HResource> resources;
+	if (!FileSystem::isFile(preloadListPath))
+		return resources;
+
+	SPtr<DataStream> stream = FileSystem::openFile(preloadListPath);
+	Vector<String> lines = StringUtil::split(stream->getAsString(), "\n");
+	stream->close();
+
+	// Queue all the loads before waiting on any of them, so they proceed in parallel
+	for (auto& line : lines)
+	{
+		StringUtil::trim(line);
+		if (line.empty())
+			continue;
+
+		HResource resource = gResources().loadFromUUID(UUID(line), true, ResourceLoadFlag::LoadDependencies);
+		if (!resource.getUUID().empty())
+			resources.push_back(resource);
+	}
+
+	for (auto& entry : resources)
+		entry.blockUntilLoaded();
+
+	return resources;
+}
+
 void runApplication()
 {
+	// Time spent in each start-up phase, in milliseconds
+	Vector<std::pair<const char*, float>> timings;
+	Timer timer;
+
+	auto endPhase = [&timings, &timer](const char* name)
+	{
+		timings.push_back(std::make_pair(name, timer.getMicroseconds() / 1000.0f));
+		timer.reset();
+	};
+
 	Path gameSettingsPath = Paths::getGameSettingsPath();
 
 	FileDecoder fd(gameSettingsPath);
@@ -86,16 +136,11 @@ void runApplication()
 	startUpDesc.primaryWindowDesc.hidden = gameSettings->fullscreen;
 	startUpDesc.primaryWindowDesc.depthBuffer = false;
 
-	Application::startUp(startUpDesc);
-
-	// Note: What if script tries to load resources during startup? The manifest nor the mapping wont be set up yet.
-	Path resourcesPath = Paths::getGameResourcesPath();
-	Path resourceMappingPath = resourcesPath + GAME_RESOURCE_MAPPING_NAME;
+	endPhase("settings");
 
-	FileDecoder mappingFd(resourceMappingPath);
-	SPtr<ResourceMapping> resMapping = std::static_pointer_cast<ResourceMapping>(mappingFd.decode());
-
-	GameResourceManager::instance().setMapping(resMapping);
+	// Resource manifest and mapping are registered by the script system before any scripts run
+	Application::startUp(startUpDesc);
+	endPhase("engine");
 
 	if (gameSettings->fullscreen)
 	{
@@ -132,23 +177,16 @@ void runApplication()
 
 	FileEncoder fe(gameSettingsPath);
 	fe.encode(gameSettings.get());
+	endPhase("window");
 
-	Path resourceManifestPath = resourcesPath + GAME_RESOURCE_MANIFEST_NAME;
-
-	SPtr<ResourceManifest> manifest;
-	if (FileSystem::exists(resourceManifestPath))
 	{
-		Path resourceRoot = resourcesPath;
-		resourceRoot.makeParent(); // Remove /Resources entry, as we expect all resources to be relative to that path
-
-		manifest = ResourceManifest::load(resourceManifestPath, resourceRoot);
+		Vector<HResource> preloadedResources = preloadResources(Paths::getGameResourcesPath() + PRELOAD_LIST_NAME);
+		endPhase("preload");
 
-		gResources().registerResourceManifest(manifest);
-	}
-
-	{
 		HPrefab mainScene = static_resource_cast<Prefab>(gResources().loadFromUUID(gameSettings->mainSceneUUID, 
 			false, ResourceLoadFlag::LoadDependencies));
+		endPhase("scene load");
+
 		if (mainScene.isLoaded(false))
 		{
 			HSceneObject root = mainScene->instantiate();
@@ -157,8 +195,17 @@ void runApplication()
 			gSceneManager().setRootNode(root);
 			oldRoot->destroy();
 		}
+
+		endPhase("scene instantiate");
 	}
 
+	String timingReport = "Start-up timings:";
+	for (auto& entry : timings)
+		timingReport += String(" ") + entry.first + " " + toString(entry.second) + "ms,";
+
+	timingReport.pop_back();
+	LOGDBG(timingReport);
+
 	Application::instance().runMainLoop();
 	Application::shutDown();
 }
\ No newline at end of file
@@ -39,6 +39,7 @@ namespace BansheeEditor
 
         private State state;
         private bool isModified;
+        private bool refreshCollapsedRows;
 
         /// <summary>
         /// Expands or collapses the entries of the dictionary.
@@ -246,11 +247,19 @@ namespace BansheeEditor
         public virtual InspectableState Refresh()
         {
             InspectableState state = InspectableState.NotModified;
-            for (int i = 0; i < rows.Count; i++)
-                state |= rows[i].Refresh();
 
-            if (editRow != null && editRow.Enabled)
-                state |= editRow.Refresh();
+            // Rows of a collapsed dictionary are hidden and don't need refreshing, other than to report edits that were
+            // still in progress when the dictionary was collapsed
+            if (isExpanded || refreshCollapsedRows)
+            {
+                for (int i = 0; i < rows.Count; i++)
+                    state |= rows[i].Refresh();
+
+                if (editRow != null && editRow.Enabled)
+                    state |= editRow.Refresh();
+
+                refreshCollapsedRows = !isExpanded && state != InspectableState.NotModified;
+            }
 
             if (isModified)
             {
@@ -465,6 +474,9 @@ namespace BansheeEditor
         {
             isExpanded = expanded;
 
+            if (!expanded)
+                refreshCollapsedRows = true;
+
             if (guiChildLayout != null)
                 guiChildLayout.Active = isExpanded && (rows.Count > 0 || IsEditInProgress());
 
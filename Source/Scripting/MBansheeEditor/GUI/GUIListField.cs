@@ -33,6 +33,7 @@ namespace BansheeEditor
 
         private State state;
         private bool isModified;
+        private bool refreshCollapsedRows;
 
         /// <summary>
         /// Expands or collapses the entries of the dictionary.
@@ -234,8 +235,15 @@ namespace BansheeEditor
         {
             InspectableState state = InspectableState.NotModified;
 
-            for (int i = 0; i < rows.Count; i++)
-                state |= rows[i].Refresh();
+            // Rows of a collapsed list are hidden and don't need refreshing, other than to report edits that were still
+            // in progress when the list was collapsed
+            if (isExpanded || refreshCollapsedRows)
+            {
+                for (int i = 0; i < rows.Count; i++)
+                    state |= rows[i].Refresh();
+
+                refreshCollapsedRows = !isExpanded && state != InspectableState.NotModified;
+            }
 
             if (isModified)
             {
@@ -310,6 +318,9 @@ namespace BansheeEditor
         {
             isExpanded = expanded;
 
+            if (!expanded)
+                refreshCollapsedRows = true;
+
             if (guiChildLayout != null)
                 guiChildLayout.Active = isExpanded;
 
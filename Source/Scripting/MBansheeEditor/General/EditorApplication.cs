@@ -311,20 +311,19 @@ namespace BansheeEditor
 
             if (IsProjectLoaded)
             {
-                monitor = new FolderMonitor(ProjectLibrary.ResourceFolder);
-                monitor.OnAdded += OnAssetModified;
-                monitor.OnRemoved += OnAssetModified;
-                monitor.OnModified += OnAssetModified;
+                monitor = new FolderMonitor(ProjectLibrary.ResourceFolder, true);
+                monitor.OnChanged += OnAssetsModified;
             }
         }
 
         /// <summary>
-        /// Triggered when the folder monitor detects an asset in the monitored folder was modified.
+        /// Triggered when the folder monitor detects assets in the monitored folder were modified. Changes are batched, so
+        /// a burst of changes results in a single refresh.
         /// </summary>
-        /// <param name="path">Path to the modified file or folder.</param>
-        private static void OnAssetModified(string path)
+        /// <param name="paths">Paths to the modified files or folders.</param>
+        private static void OnAssetsModified(string[] paths)
         {
-            ProjectLibrary.Refresh(path);
+            ProjectLibrary.Refresh(paths);
         }
 
         /// <summary>
@@ -532,13 +531,45 @@ namespace BansheeEditor
         ///                    prefab if it just needs updating. </param>
         internal static void SaveScene(string path)
         {
+            // Saving registers the scene prefab with the library directly, so no library refresh is needed
             Prefab scene = Internal_SaveScene(path);
             Scene.SetActive(scene);
 
-            ProjectLibrary.Refresh(true);
             SetSceneDirty(false);
         }
 
+        /// <summary>
+        /// Saves the currently loaded scene as a chunked scene, with each top-level scene object stored in its own chunk.
+        /// Only chunks whose scene objects changed since the last save or load of the same chunked scene are written.
+        /// </summary>
+        /// <param name="path">Absolute path to the folder in which to store the chunks.</param>
+        /// <returns>Number of chunks that were written.</returns>
+        public static int SaveChunkedScene(string path)
+        {
+            int numChunksWritten = Internal_SaveChunkedScene(path);
+            SetSceneDirty(false);
+
+            return numChunksWritten;
+        }
+
+        /// <summary>
+        /// Clears the current scene and starts loading a chunked scene saved with <see cref="SaveChunkedScene"/>. Chunks
+        /// are instantiated over multiple frames, use <see cref="ChunkedSceneLoadProgress"/> to track the progress.
+        /// </summary>
+        /// <param name="path">Absolute path to the folder containing the chunks.</param>
+        public static void LoadChunkedScene(string path)
+        {
+            Scene.Clear();
+            Internal_LoadChunkedScene(path);
+
+            SetSceneDirty(false);
+        }
+
+        /// <summary>
+        /// Returns the percentage of chunks loaded by the last call to <see cref="LoadChunkedScene"/>, in [0, 1] range.
+        /// </summary>
+        public static float ChunkedSceneLoadProgress { get { return Internal_GetChunkedSceneLoadProgress(); } }
+
         /// <summary>
         /// Attempts to save the current scene by applying the changes to a prefab, instead of saving it as a brand new
         /// scene. This is necessary for generic prefabs that have don't have a scene root included in the prefab. If the
@@ -577,8 +608,6 @@ namespace BansheeEditor
             if (root != null)
             {
                 PrefabUtility.ApplyPrefab(root, false);
-
-                ProjectLibrary.Refresh(true);
                 SetSceneDirty(false);
 
                 if (onSuccess != null)
@@ -974,10 +1003,8 @@ namespace BansheeEditor
                 monitor = null;
             }
 
-            monitor = new FolderMonitor(ProjectLibrary.ResourceFolder);
-            monitor.OnAdded += OnAssetModified;
-            monitor.OnRemoved += OnAssetModified;
-            monitor.OnModified += OnAssetModified;
+            monitor = new FolderMonitor(ProjectLibrary.ResourceFolder, true);
+            monitor.OnChanged += OnAssetsModified;
 
             if (!string.IsNullOrWhiteSpace(ProjectSettings.LastOpenScene))
             {
@@ -1048,6 +1075,15 @@ namespace BansheeEditor
         [MethodImpl(MethodImplOptions.InternalCall)]
         private static extern Prefab Internal_SaveScene(string path);
 
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern int Internal_SaveChunkedScene(string path);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_LoadChunkedScene(string path);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern float Internal_GetChunkedSceneLoadProgress();
+
         [MethodImpl(MethodImplOptions.InternalCall)]
         private static extern bool Internal_IsValidProject(string path);
 
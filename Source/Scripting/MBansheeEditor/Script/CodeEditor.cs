@@ -1,6 +1,7 @@
 ﻿//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
 //**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
 using System;
+using System.Collections.Generic;
 using System.Runtime.CompilerServices;
 using BansheeEngine;
 
@@ -82,11 +83,39 @@ namespace BansheeEditor
         }
 
         /// <summary>
-        /// Generates a solution file for the active editor, which includes all scripts in the project.
+        /// Generates a solution file for the active editor, which includes all scripts in the project. A separate
+        /// project is generated for each assembly definition (see <see cref="ScriptAssemblyDefinition"/>).
         /// </summary>
         public static void SyncSolution()
         {
-            Internal_SyncSolution();
+            ScriptAssemblyDefinition[] definitions = ScriptAssemblyDefinition.FindAll();
+
+            HashSet<string> definitionNames = new HashSet<string>(StringComparer.OrdinalIgnoreCase);
+            foreach (var definition in definitions)
+                definitionNames.Add(definition.Name);
+
+            // References of all definitions are passed in a single array, so they don't need to be marshalled per
+            // definition. References to unknown definitions are reported by the compiler, and skipped here.
+            string[] names = new string[definitions.Length];
+            string[] folders = new string[definitions.Length];
+            int[] numReferences = new int[definitions.Length];
+            List<string> references = new List<string>();
+            for (int i = 0; i < definitions.Length; i++)
+            {
+                names[i] = definitions[i].Name;
+                folders[i] = definitions[i].Folder;
+
+                foreach (var reference in definitions[i].References)
+                {
+                    if (!definitionNames.Contains(reference))
+                        continue;
+
+                    references.Add(reference);
+                    numReferences[i]++;
+                }
+            }
+
+            Internal_SyncSolution(names, folders, numReferences, references.ToArray());
             isSolutionDirty = false;
         }
 
@@ -111,7 +140,8 @@ namespace BansheeEditor
         internal static extern void Internal_OpenFile(string path, int line);
 
         [MethodImpl(MethodImplOptions.InternalCall)]
-        internal static extern void Internal_SyncSolution();
+        internal static extern void Internal_SyncSolution(string[] names, string[] folders, int[] numReferences,
+            string[] references);
     }
 
     /** @} */
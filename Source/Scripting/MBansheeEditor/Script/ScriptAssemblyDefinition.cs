@@ -0,0 +1,223 @@
+﻿//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+using System;
+using System.Collections.Generic;
+using System.IO;
+using System.Text.RegularExpressions;
+using BansheeEngine;
+
+namespace BansheeEditor
+{
+    /** @addtogroup Script
+     *  @{
+     */
+
+    /// <summary>
+    /// Describes a script assembly defined by an assembly definition file in the project. All non-editor scripts in the
+    /// folder containing the definition file (and its sub-folders, unless they contain their own definition) are
+    /// compiled into a separate assembly, instead of the default game assembly. This allows script changes to only
+    /// recompile the assemblies they belong to (and the assemblies depending on them).
+    /// 
+    /// Definition files use the <see cref="Extension"/> extension, and the name of the file is used as the name of the
+    /// assembly. The file contains one "key = value" pair per line, with the following keys supported:
+    ///  - references: Comma separated list of names of other assembly definitions this assembly depends on.
+    /// Empty lines and lines starting with # are ignored.
+    /// </summary>
+    public sealed class ScriptAssemblyDefinition
+    {
+        /// <summary>
+        /// Extension of the assembly definition files.
+        /// </summary>
+        public const string Extension = ".asmdef";
+
+        private static readonly Regex NameRegex = new Regex(@"^[A-Za-z_][A-Za-z0-9_\.]*$");
+
+        /// <summary>
+        /// Name of the assembly, without the extension.
+        /// </summary>
+        public string Name { get; private set; }
+
+        /// <summary>
+        /// Absolute path to the folder containing the definition file.
+        /// </summary>
+        public string Folder { get; private set; }
+
+        /// <summary>
+        /// Names of the other assembly definitions this assembly depends on.
+        /// </summary>
+        public string[] References { get; private set; }
+
+        /// <summary>
+        /// Finds and parses all assembly definition files in the project's resource folder. Invalid definitions are
+        /// reported and ignored.
+        /// </summary>
+        /// <returns>All valid assembly definitions in the project.</returns>
+        public static ScriptAssemblyDefinition[] FindAll()
+        {
+            List<ScriptAssemblyDefinition> output = new List<ScriptAssemblyDefinition>();
+
+            string resourceFolder = ProjectLibrary.ResourceFolder;
+            if (string.IsNullOrEmpty(resourceFolder) || !Directory.Exists(resourceFolder))
+                return output.ToArray();
+
+            string[] files = Directory.GetFiles(resourceFolder, "*" + Extension, SearchOption.AllDirectories);
+            Array.Sort(files, StringComparer.OrdinalIgnoreCase);
+
+            HashSet<string> reservedNames = new HashSet<string>(StringComparer.OrdinalIgnoreCase)
+            {
+                Path.GetFileNameWithoutExtension(EditorApplication.EngineAssemblyName),
+                Path.GetFileNameWithoutExtension(EditorApplication.EditorAssemblyName),
+                Path.GetFileNameWithoutExtension(EditorApplication.ScriptGameAssemblyName),
+                Path.GetFileNameWithoutExtension(EditorApplication.ScriptEditorAssemblyName)
+            };
+
+            HashSet<string> usedNames = new HashSet<string>(StringComparer.OrdinalIgnoreCase);
+            HashSet<string> usedFolders = new HashSet<string>(StringComparer.OrdinalIgnoreCase);
+            foreach (var file in files)
+            {
+                ScriptAssemblyDefinition definition = Parse(file);
+                if (definition == null)
+                    continue;
+
+                if (reservedNames.Contains(definition.Name) || usedNames.Contains(definition.Name))
+                {
+                    Debug.LogWarning("Ignoring assembly definition \"" + file + "\", assembly name \"" + 
+                        definition.Name + "\" is already in use.");
+                    continue;
+                }
+
+                if (usedFolders.Contains(definition.Folder))
+                {
+                    Debug.LogWarning("Ignoring assembly definition \"" + file + "\", folder already contains an " +
+                        "assembly definition.");
+                    continue;
+                }
+
+                usedNames.Add(definition.Name);
+                usedFolders.Add(definition.Folder);
+                output.Add(definition);
+            }
+
+            return output.ToArray();
+        }
+
+        /// <summary>
+        /// Finds the assembly definition the script file at the specified path belongs to. This is the definition in the
+        /// closest parent folder of the file.
+        /// </summary>
+        /// <param name="definitions">Definitions to search, as returned by <see cref="FindAll"/>.</param>
+        /// <param name="filePath">Absolute path to the script file.</param>
+        /// <returns>Definition the file belongs to, or null if the file belongs to the default assembly.</returns>
+        public static ScriptAssemblyDefinition FindOwner(ScriptAssemblyDefinition[] definitions, string filePath)
+        {
+            if (definitions.Length == 0)
+                return null;
+
+            Dictionary<string, ScriptAssemblyDefinition> lookup = 
+                new Dictionary<string, ScriptAssemblyDefinition>(StringComparer.OrdinalIgnoreCase);
+            foreach (var definition in definitions)
+                lookup[definition.Folder] = definition;
+
+            return FindOwner(lookup, filePath);
+        }
+
+        /// <summary>
+        /// Finds the assembly definition the script file at the specified path belongs to.
+        /// </summary>
+        /// <param name="lookup">Map of definition folders to their definitions.</param>
+        /// <param name="filePath">Absolute path to the script file.</param>
+        /// <returns>Definition the file belongs to, or null if the file belongs to the default assembly.</returns>
+        internal static ScriptAssemblyDefinition FindOwner(Dictionary<string, ScriptAssemblyDefinition> lookup, 
+            string filePath)
+        {
+            string folder = Path.GetDirectoryName(NormalizePath(filePath));
+            while (!string.IsNullOrEmpty(folder))
+            {
+                ScriptAssemblyDefinition definition;
+                if (lookup.TryGetValue(folder, out definition))
+                    return definition;
+
+                folder = Path.GetDirectoryName(folder);
+            }
+
+            return null;
+        }
+
+        /// <summary>
+        /// Converts a path into the form used for comparing folders of assembly definitions.
+        /// </summary>
+        /// <param name="path">Absolute path to a file or folder.</param>
+        /// <returns>Normalized path, with no trailing separator.</returns>
+        internal static string NormalizePath(string path)
+        {
+            return Path.GetFullPath(path).TrimEnd(Path.DirectorySeparatorChar, Path.AltDirectorySeparatorChar);
+        }
+
+        /// <summary>
+        /// Parses an assembly definition file.
+        /// </summary>
+        /// <param name="filePath">Absolute path to the assembly definition file.</param>
+        /// <returns>Parsed definition, or null if the file is not a valid definition.</returns>
+        private static ScriptAssemblyDefinition Parse(string filePath)
+        {
+            string name = Path.GetFileNameWithoutExtension(filePath);
+            if (!NameRegex.IsMatch(name))
+            {
+                Debug.LogWarning("Ignoring assembly definition \"" + filePath + "\", \"" + name + "\" is not a valid " +
+                    "assembly name.");
+                return null;
+            }
+
+            string[] lines;
+            try
+            {
+                lines = File.ReadAllLines(filePath);
+            }
+            catch (Exception e)
+            {
+                Debug.LogWarning("Unable to read assembly definition \"" + filePath + "\": " + e.Message);
+                return null;
+            }
+
+            List<string> references = new List<string>();
+            for (int i = 0; i < lines.Length; i++)
+            {
+                string line = lines[i].Trim();
+                if (line.Length == 0 || line.StartsWith("#"))
+                    continue;
+
+                int separator = line.IndexOf('=');
+                if (separator == -1)
+                {
+                    Debug.LogWarning("Invalid line in assembly definition \"" + filePath + "\" (" + (i + 1) + "): " + 
+                        line);
+                    continue;
+                }
+
+                string key = line.Substring(0, separator).Trim();
+                string value = line.Substring(separator + 1).Trim();
+
+                if (key == "references")
+                {
+                    foreach (var reference in value.Split(','))
+                    {
+                        string referenceName = reference.Trim();
+                        if (referenceName.Length > 0)
+                            references.Add(referenceName);
+                    }
+                }
+                else
+                    Debug.LogWarning("Unknown key \"" + key + "\" in assembly definition \"" + filePath + "\".");
+            }
+
+            ScriptAssemblyDefinition definition = new ScriptAssemblyDefinition();
+            definition.Name = name;
+            definition.Folder = NormalizePath(Path.GetDirectoryName(filePath));
+            definition.References = references.ToArray();
+
+            return definition;
+        }
+    }
+
+    /** @} */
+}
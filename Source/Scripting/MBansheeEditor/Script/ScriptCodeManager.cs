@@ -18,7 +18,7 @@ namespace BansheeEditor
     {
         private bool isGameAssemblyDirty;
         private bool isEditorAssemblyDirty;
-        private CompilerInstance compilerInstance;
+        private ScriptCompilation compilerInstance;
 
         /// <summary>
         /// Constructs a new script code manager.
@@ -46,20 +46,15 @@ namespace BansheeEditor
                     {
                         string outputDir = EditorApplication.ScriptAssemblyPath;
 
-                        if (isGameAssemblyDirty)
-                        {
-                            compilerInstance = ScriptCompiler.CompileAsync(
-                                ScriptAssemblyType.Game, BuildManager.ActivePlatform, true, outputDir);
-
-                            EditorApplication.SetStatusCompiling(true);
-                            isGameAssemblyDirty = false;
-                        }
-                        else if (isEditorAssemblyDirty)
+                        // Editor compilation includes all the game assemblies, but only the out of date ones are
+                        // actually recompiled
+                        if (isGameAssemblyDirty || isEditorAssemblyDirty)
                         {
                             compilerInstance = ScriptCompiler.CompileAsync(
                                 ScriptAssemblyType.Editor, BuildManager.ActivePlatform, true, outputDir);
 
                             EditorApplication.SetStatusCompiling(true);
+                            isGameAssemblyDirty = false;
                             isEditorAssemblyDirty = false;
                         }
                     }
@@ -84,11 +79,16 @@ namespace BansheeEditor
                                 Debug.LogMessage(FormMessage(msg), DebugMessageType.CompilerError);
                         }
 
+                        // No need to reload if all assemblies were up to date
+                        bool anyCompiled = compilerInstance.NumCompiled > 0;
+
                         compilerInstance.Dispose();
                         compilerInstance = null;
 
                         EditorApplication.SetStatusCompiling(false);
-                        EditorApplication.ReloadAssemblies();
+
+                        if (anyCompiled)
+                            EditorApplication.ReloadAssemblies();
                     }
                 }
             }
@@ -100,6 +100,9 @@ namespace BansheeEditor
         /// <param name="path">Path of the added resource, relative to the project's resource folder.</param>
         private void OnEntryAdded(string path)
         {
+            if (IsAssemblyDefinition(path))
+                OnAssemblyDefinitionModified();
+
             if (IsCodeEditorFile(path))
                 CodeEditor.MarkSolutionDirty();
         }
@@ -110,6 +113,9 @@ namespace BansheeEditor
         /// <param name="path">Path of the removed resource, relative to the project's resource folder.</param>
         private void OnEntryRemoved(string path)
         {
+            if (IsAssemblyDefinition(path))
+                OnAssemblyDefinitionModified();
+
             if (IsCodeEditorFile(path))
                 CodeEditor.MarkSolutionDirty();
         }
@@ -120,6 +126,12 @@ namespace BansheeEditor
         /// <param name="path">Path of the imported resource, relative to the project's resource folder.</param>
         private void OnEntryImported(string path)
         {
+            if (IsAssemblyDefinition(path))
+            {
+                OnAssemblyDefinitionModified();
+                return;
+            }
+
             LibraryEntry entry = ProjectLibrary.GetEntry(path);
             if (entry == null || entry.Type != LibraryEntryType.File)
                 return;
@@ -150,6 +162,27 @@ namespace BansheeEditor
                 isGameAssemblyDirty = true;
         }
 
+        /// <summary>
+        /// Checks is the file at the provided path an assembly definition file.
+        /// </summary>
+        /// <param name="path">Path to the file, absolute or relative to the project's resources folder.</param>
+        /// <returns>True if the file is an assembly definition, false otherwise.</returns>
+        private bool IsAssemblyDefinition(string path)
+        {
+            return string.Equals(Path.GetExtension(path), ScriptAssemblyDefinition.Extension, 
+                System.StringComparison.OrdinalIgnoreCase);
+        }
+
+        /// <summary>
+        /// Triggered when an assembly definition file is added, removed or modified. Script files may have moved
+        /// between assemblies, so the assemblies and the code editor solution need to be updated.
+        /// </summary>
+        private void OnAssemblyDefinitionModified()
+        {
+            isGameAssemblyDirty = true;
+            CodeEditor.MarkSolutionDirty();
+        }
+
         /// <summary>
         /// Checks is the resource at the provided path a file relevant to the code editor.
         /// </summary>
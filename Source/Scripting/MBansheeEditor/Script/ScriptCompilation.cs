@@ -0,0 +1,452 @@
+﻿//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+using System;
+using System.Collections.Generic;
+using System.IO;
+using System.Text;
+using BansheeEngine;
+
+namespace BansheeEditor
+{
+    /** @addtogroup Script
+     *  @{
+     */
+
+    /// <summary>
+    /// Kinds of assemblies compiled as part of a <see cref="ScriptCompilation"/>.
+    /// </summary>
+    internal enum ScriptAssemblyKind
+    {
+        /// <summary>Assembly defined by an assembly definition file.</summary>
+        Definition,
+        /// <summary>Default game assembly, containing game scripts not belonging to an assembly definition.</summary>
+        Game,
+        /// <summary>Assembly containing all editor scripts.</summary>
+        Editor
+    }
+
+    /// <summary>
+    /// Information about a single assembly to compile as part of a <see cref="ScriptCompilation"/>.
+    /// </summary>
+    internal class ScriptCompileTarget
+    {
+        public string name;
+        public ScriptAssemblyKind kind;
+        public string[] files;
+        public string[] assemblyFolders;
+        public string[] assemblies;
+        public string outputFile;
+        public List<ScriptCompileTarget> dependencies = new List<ScriptCompileTarget>();
+
+        /// <summary>Hash of all the inputs of the assembly, including signatures of the dependencies.</summary>
+        public string signature;
+    }
+
+    /// <summary>
+    /// Compiles a set of inter-dependent script assemblies. Assemblies whose inputs haven't changed since they were last
+    /// compiled into the same output folder are skipped, and assemblies that don't depend on each other are compiled in
+    /// parallel. Inputs of the compiled assemblies are recorded in a manifest file in the output folder, which is also
+    /// used by the runtime for finding the assemblies to load.
+    /// </summary>
+    public class ScriptCompilation
+    {
+        /// <summary>
+        /// Name of the manifest file in the output folder.
+        /// </summary>
+        internal const string ManifestName = "ScriptAssemblies.manifest";
+
+        /// <summary>
+        /// State of a single assembly in the compilation.
+        /// </summary>
+        private enum TargetState
+        {
+            Pending, Compiling, Compiled, UpToDate, Failed
+        }
+
+        private string outputDir;
+        private string defines;
+        private bool debug;
+
+        private ScriptCompileTarget[] targets;
+        private TargetState[] states;
+        private CompilerInstance[] compilers;
+        private int maxParallel;
+        private bool isDone;
+
+        private List<CompilerMessage> errors = new List<CompilerMessage>();
+        private List<CompilerMessage> warnings = new List<CompilerMessage>();
+
+        /// <summary>
+        /// Creates a new compilation and starts compiling all the assemblies that need to be compiled and have no
+        /// dependencies that need compiling.
+        /// </summary>
+        /// <param name="targets">Assemblies to compile, sorted so that each assembly comes after its dependencies.
+        ///                       </param>
+        /// <param name="defines">A set of semi-colon separated defines to provide to the compiler.</param>
+        /// <param name="debug">Determines should the assemblies be compiled with additional debug information.</param>
+        /// <param name="outputDir">Absolute path to the directory where to output the assemblies.</param>
+        internal ScriptCompilation(ScriptCompileTarget[] targets, string defines, bool debug, string outputDir)
+        {
+            this.targets = targets;
+            this.defines = defines;
+            this.debug = debug;
+            this.outputDir = outputDir;
+
+            states = new TargetState[targets.Length];
+            compilers = new CompilerInstance[targets.Length];
+            maxParallel = Math.Max(1, Environment.ProcessorCount);
+
+            Dictionary<string, string> previousSignatures = ReadManifest(outputDir);
+            for (int i = 0; i < targets.Length; i++)
+            {
+                ScriptCompileTarget target = targets[i];
+                target.signature = CalculateSignature(target);
+
+                // Dependants of recompiled assemblies have their signatures changed as well, since they include the
+                // signatures of their dependencies
+                string previousSignature;
+                if (previousSignatures.TryGetValue(target.name, out previousSignature) &&
+                    previousSignature == target.signature && File.Exists(target.outputFile))
+                {
+                    states[i] = TargetState.UpToDate;
+                }
+                else
+                    states[i] = TargetState.Pending;
+            }
+
+            DeleteStaleOutputs();
+            Update();
+        }
+
+        /// <summary>
+        /// Checks is the compilation done. Also starts compiling any assemblies whose dependencies have finished 
+        /// compiling.
+        /// </summary>
+        public bool IsDone
+        {
+            get
+            {
+                Update();
+                return isDone;
+            }
+        }
+
+        /// <summary>
+        /// Checks has compilation of any of the assemblies failed. Only valid after <see cref="IsDone"/> returns true.
+        /// </summary>
+        public bool HasErrors
+        {
+            get
+            {
+                if (!IsDone)
+                    return false;
+
+                foreach (var state in states)
+                {
+                    if (state == TargetState.Failed)
+                        return true;
+                }
+
+                return false;
+            }
+        }
+
+        /// <summary>
+        /// Number of assemblies that were actually compiled, excluding the ones that were up to date. Only valid after
+        /// <see cref="IsDone"/> returns true.
+        /// </summary>
+        public int NumCompiled
+        {
+            get
+            {
+                int count = 0;
+                foreach (var state in states)
+                {
+                    if (state == TargetState.Compiled || state == TargetState.Failed)
+                        count++;
+                }
+
+                return count;
+            }
+        }
+
+        /// <summary>
+        /// Number of assemblies that were skipped because their inputs didn't change since the last compilation.
+        /// </summary>
+        public int NumUpToDate
+        {
+            get
+            {
+                int count = 0;
+                foreach (var state in states)
+                {
+                    if (state == TargetState.UpToDate)
+                        count++;
+                }
+
+                return count;
+            }
+        }
+
+        /// <summary>
+        /// Returns all warning messages generated by the compiler, for all the assemblies.
+        /// </summary>
+        public CompilerMessage[] WarningMessages
+        {
+            get
+            {
+                List<CompilerMessage> output = new List<CompilerMessage>(warnings);
+                foreach (var compiler in compilers)
+                {
+                    if (compiler != null)
+                        output.AddRange(compiler.WarningMessages);
+                }
+
+                return output.ToArray();
+            }
+        }
+
+        /// <summary>
+        /// Returns all error messages generated by the compiler, for all the assemblies.
+        /// </summary>
+        public CompilerMessage[] ErrorMessages
+        {
+            get
+            {
+                List<CompilerMessage> output = new List<CompilerMessage>(errors);
+                foreach (var compiler in compilers)
+                {
+                    if (compiler != null)
+                        output.AddRange(compiler.ErrorMessages);
+                }
+
+                return output.ToArray();
+            }
+        }
+
+        /// <summary>
+        /// Disposes of all compiler processes. Should be called when done with this object.
+        /// </summary>
+        public void Dispose()
+        {
+            for (int i = 0; i < compilers.Length; i++)
+            {
+                if (compilers[i] != null)
+                    compilers[i].Dispose();
+            }
+        }
+
+        /// <summary>
+        /// Checks the state of running compiler processes and starts compiling assemblies whose dependencies are done.
+        /// </summary>
+        private void Update()
+        {
+            if (isDone)
+                return;
+
+            int numRunning = 0;
+            for (int i = 0; i < targets.Length; i++)
+            {
+                if (states[i] != TargetState.Compiling)
+                    continue;
+
+                if (compilers[i].IsDone)
+                    states[i] = compilers[i].HasErrors ? TargetState.Failed : TargetState.Compiled;
+                else
+                    numRunning++;
+            }
+
+            bool anyPending = false;
+            for (int i = 0; i < targets.Length; i++)
+            {
+                if (states[i] != TargetState.Pending)
+                    continue;
+
+                bool dependenciesReady = true;
+                bool dependencyFailed = false;
+                foreach (var dependency in targets[i].dependencies)
+                {
+                    TargetState dependencyState = states[Array.IndexOf(targets, dependency)];
+                    if (dependencyState == TargetState.Failed)
+                        dependencyFailed = true;
+                    else if (dependencyState != TargetState.Compiled && dependencyState != TargetState.UpToDate)
+                        dependenciesReady = false;
+                }
+
+                if (dependencyFailed)
+                {
+                    CompilerMessage message = new CompilerMessage();
+                    message.type = CompilerMessageType.Error;
+                    message.message = "Assembly \"" + targets[i].name + "\" was not compiled because one of its " + 
+                        "dependencies failed to compile.";
+                    message.file = "";
+
+                    errors.Add(message);
+                    states[i] = TargetState.Failed;
+                    continue;
+                }
+
+                if (!dependenciesReady || numRunning >= maxParallel)
+                {
+                    anyPending = true;
+                    continue;
+                }
+
+                ScriptCompileTarget target = targets[i];
+                compilers[i] = new CompilerInstance(target.files, defines, target.assemblyFolders, target.assemblies,
+                    debug, target.outputFile);
+
+                states[i] = TargetState.Compiling;
+                numRunning++;
+            }
+
+            if (numRunning == 0 && !anyPending)
+            {
+                WriteManifest();
+                isDone = true;
+            }
+        }
+
+        /// <summary>
+        /// Calculates a hash of all the inputs of the assembly.
+        /// </summary>
+        /// <param name="target">Assembly to calculate the signature for. Signatures of all its dependencies must already
+        ///                      be calculated.</param>
+        /// <returns>Signature as a hex string.</returns>
+        private string CalculateSignature(ScriptCompileTarget target)
+        {
+            StringBuilder sb = new StringBuilder();
+            sb.Append(target.kind).Append('|').Append(defines).Append('|').Append(debug).Append('\n');
+
+            string[] files = (string[])target.files.Clone();
+            Array.Sort(files, StringComparer.Ordinal);
+            foreach (var file in files)
+            {
+                FileInfo info = new FileInfo(file);
+                sb.Append(file).Append('|');
+
+                if (info.Exists)
+                    sb.Append(info.LastWriteTimeUtc.Ticks).Append('|').Append(info.Length);
+
+                sb.Append('\n');
+            }
+
+            // Referenced assemblies outside of the output folder (e.g. the engine, or assemblies in the project) are
+            // identified by their timestamps. Ones in the output folder are covered by the dependency signatures.
+            foreach (var assembly in target.assemblies)
+            {
+                sb.Append(assembly).Append('|');
+
+                string fileName = assembly;
+                if (!fileName.EndsWith(".dll", StringComparison.OrdinalIgnoreCase))
+                    fileName += ".dll";
+
+                foreach (var folder in target.assemblyFolders)
+                {
+                    if (folder == outputDir)
+                        continue;
+
+                    FileInfo info = new FileInfo(Path.Combine(folder, fileName));
+                    if (info.Exists)
+                    {
+                        sb.Append(info.LastWriteTimeUtc.Ticks);
+                        break;
+                    }
+                }
+
+                sb.Append('\n');
+            }
+
+            foreach (var dependency in target.dependencies)
+                sb.Append(dependency.name).Append('|').Append(dependency.signature).Append('\n');
+
+            // 64-bit FNV-1a
+            ulong hash = 14695981039346656037UL;
+            string text = sb.ToString();
+            for (int i = 0; i < text.Length; i++)
+            {
+                hash ^= text[i];
+                hash *= 1099511628211UL;
+            }
+
+            return hash.ToString("x16");
+        }
+
+        /// <summary>
+        /// Reads the signatures of the previously compiled assemblies from the manifest in the output folder.
+        /// </summary>
+        /// <param name="outputDir">Folder containing the manifest.</param>
+        /// <returns>Map of assembly names to their signatures.</returns>
+        private static Dictionary<string, string> ReadManifest(string outputDir)
+        {
+            Dictionary<string, string> output = new Dictionary<string, string>();
+
+            string manifestPath = Path.Combine(outputDir, ManifestName);
+            if (!File.Exists(manifestPath))
+                return output;
+
+            foreach (var line in File.ReadAllLines(manifestPath))
+            {
+                string[] columns = line.Split('\t');
+                if (columns.Length < 3)
+                    continue;
+
+                output[columns[0]] = columns[2];
+            }
+
+            return output;
+        }
+
+        /// <summary>
+        /// Writes the signatures of all successfully compiled assemblies into the manifest in the output folder, in
+        /// dependency order. Failed assemblies are left out so they get compiled again next time.
+        /// </summary>
+        private void WriteManifest()
+        {
+            StringBuilder sb = new StringBuilder();
+            for (int i = 0; i < targets.Length; i++)
+            {
+                if (states[i] != TargetState.Compiled && states[i] != TargetState.UpToDate)
+                    continue;
+
+                sb.Append(targets[i].name).Append('\t').Append(targets[i].kind).Append('\t')
+                    .Append(targets[i].signature).Append('\n');
+            }
+
+            if (!Directory.Exists(outputDir))
+                Directory.CreateDirectory(outputDir);
+
+            File.WriteAllText(Path.Combine(outputDir, ManifestName), sb.ToString());
+        }
+
+        /// <summary>
+        /// Deletes outputs of previously compiled assembly definitions that no longer exist, so they don't get loaded.
+        /// </summary>
+        private void DeleteStaleOutputs()
+        {
+            HashSet<string> names = new HashSet<string>();
+            foreach (var target in targets)
+                names.Add(target.name);
+
+            string manifestPath = Path.Combine(outputDir, ManifestName);
+            if (!File.Exists(manifestPath))
+                return;
+
+            foreach (var line in File.ReadAllLines(manifestPath))
+            {
+                string[] columns = line.Split('\t');
+                if (columns.Length < 3 || columns[1] != ScriptAssemblyKind.Definition.ToString())
+                    continue;
+
+                if (names.Contains(columns[0]))
+                    continue;
+
+                string assemblyPath = Path.Combine(outputDir, columns[0] + ".dll");
+                if (File.Exists(assemblyPath))
+                    File.Delete(assemblyPath);
+            }
+        }
+    }
+
+    /** @} */
+}
@@ -40,36 +40,59 @@ namespace BansheeEditor
     {
         /// <summary>
         /// Starts compilation of the script files in the project for the specified assembly for the specified platform.
+        /// Game scripts in folders with an assembly definition (see <see cref="ScriptAssemblyDefinition"/>) are compiled
+        /// into their own assemblies, which the default game assembly and the editor assembly reference. Assemblies 
+        /// whose inputs didn't change since they were last compiled into the same output folder are not recompiled, and
+        /// independent assemblies are compiled in parallel.
         /// </summary>
-        /// <param name="type">Type of the assembly to compile. This determines which script files are used as input.</param>
+        /// <param name="type">Type of the assembly to compile. Editor assembly compilation also compiles any game
+        ///                    assemblies it depends on, if they are out of date.</param>
         /// <param name="platform">Platform to compile the assemblies for.</param>
         /// <param name="debug">Determines should the assemblies contain debug information.</param>
         /// <param name="outputDir">Absolute path to the directory where to output the assemblies.</param>
-        /// <returns>Compiler instance that contains the compiler process. Caller must ensure to properly dispose
+        /// <returns>Compilation object that tracks the compiler processes. Caller must ensure to properly dispose
         ///          of this object when done.</returns>
-        public static CompilerInstance CompileAsync(ScriptAssemblyType type, PlatformType platform, bool debug, string outputDir)
+        public static ScriptCompilation CompileAsync(ScriptAssemblyType type, PlatformType platform, bool debug, 
+            string outputDir)
         {
-            LibraryEntry[] scriptEntries = ProjectLibrary.Search("*", new ResourceType[] { ResourceType.ScriptCode });
+            ScriptAssemblyDefinition[] definitions = ScriptAssemblyDefinition.FindAll();
+
+            Dictionary<string, ScriptAssemblyDefinition> definitionLookup = 
+                new Dictionary<string, ScriptAssemblyDefinition>(StringComparer.OrdinalIgnoreCase);
+            foreach (var definition in definitions)
+                definitionLookup[definition.Folder] = definition;
+
+            // Sort the script files into assemblies
+            Dictionary<ScriptAssemblyDefinition, List<string>> definitionFiles = 
+                new Dictionary<ScriptAssemblyDefinition, List<string>>();
+            foreach (var definition in definitions)
+                definitionFiles[definition] = new List<string>();
+
+            List<string> gameFiles = new List<string>();
+            List<string> editorFiles = new List<string>();
 
-            List<string> scriptFiles = new List<string>();
+            LibraryEntry[] scriptEntries = ProjectLibrary.Search("*", new ResourceType[] { ResourceType.ScriptCode });
             for (int i = 0; i < scriptEntries.Length; i++)
             {
                 if(scriptEntries[i].Type != LibraryEntryType.File)
                     continue;
 
                 FileEntry fileEntry = (FileEntry)scriptEntries[i];
+                string filePath = Path.Combine(ProjectLibrary.ResourceFolder, scriptEntries[i].Path);
 
                 ScriptCodeImportOptions io = (ScriptCodeImportOptions) fileEntry.Options;
-                if (io.EditorScript && type == ScriptAssemblyType.Editor ||
-                    !io.EditorScript && type == ScriptAssemblyType.Game)
+                if (io.EditorScript)
                 {
-                    scriptFiles.Add(Path.Combine(ProjectLibrary.ResourceFolder, scriptEntries[i].Path));
+                    editorFiles.Add(filePath);
+                    continue;
                 }
-            }
 
-            string[] assemblyFolders;
-            string[] assemblies;
-            string outputFile;
+                ScriptAssemblyDefinition owner = ScriptAssemblyDefinition.FindOwner(definitionLookup, filePath);
+                if (owner != null)
+                    definitionFiles[owner].Add(filePath);
+                else
+                    gameFiles.Add(filePath);
+            }
 
             string builtinAssemblyPath = debug
                     ? EditorApplication.BuiltinDebugAssemblyPath
@@ -77,66 +100,171 @@ namespace BansheeEditor
 
             string[] frameworkAssemblies = BuildManager.GetFrameworkAssemblies(platform);
             var otherAssemblies = Directory.GetFiles(ProjectLibrary.ResourceFolder, "*.dll", SearchOption.AllDirectories).ToList(); //TODO: Make platform-agnostic.
-            if (type == ScriptAssemblyType.Game)
+
+            // References common to all assemblies
+            List<string> commonFolders = new List<string>();
+            List<string> commonAssemblies = new List<string>();
+            foreach (var otherAssembly in otherAssemblies)
             {
-                assemblyFolders = new string[otherAssemblies.Count + 2];
-                assemblies = new string[frameworkAssemblies.Length + otherAssemblies.Count + 1];
+                string folder = Path.GetDirectoryName(otherAssembly);
+                if (!commonFolders.Contains(folder))
+                    commonFolders.Add(folder);
+
+                commonAssemblies.Add(Path.GetFileNameWithoutExtension(otherAssembly));
+            }
+
+            commonFolders.Add(builtinAssemblyPath);
+            commonFolders.Add(EditorApplication.FrameworkAssemblyPath);
+            commonFolders.Add(outputDir);
 
-                //TODO: Remove duplicate folders.
+            commonAssemblies.AddRange(frameworkAssemblies);
+            commonAssemblies.Add(EditorApplication.EngineAssemblyName);
+
+            // Assembly definitions, sorted so each comes after its dependencies
+            List<ScriptCompileTarget> targets = new List<ScriptCompileTarget>();
+            Dictionary<string, ScriptCompileTarget> definitionTargets = 
+                new Dictionary<string, ScriptCompileTarget>(StringComparer.OrdinalIgnoreCase);
+
+            HashSet<ScriptAssemblyDefinition> visiting = new HashSet<ScriptAssemblyDefinition>();
+            foreach (var definition in definitions)
+            {
+                AddDefinitionTarget(definition, definitions, definitionFiles, commonFolders, commonAssemblies, outputDir, 
+                    visiting, targets, definitionTargets);
+            }
+
+            List<ScriptCompileTarget> allDefinitionTargets = new List<ScriptCompileTarget>(targets);
+
+            ScriptCompileTarget gameTarget = null;
+            if (gameFiles.Count > 0)
+            {
+                gameTarget = new ScriptCompileTarget();
+                gameTarget.name = Path.GetFileNameWithoutExtension(EditorApplication.ScriptGameAssemblyName);
+                gameTarget.kind = ScriptAssemblyKind.Game;
+                gameTarget.files = gameFiles.ToArray();
+                gameTarget.outputFile = Path.Combine(outputDir, EditorApplication.ScriptGameAssemblyName);
+                gameTarget.dependencies.AddRange(allDefinitionTargets);
+                gameTarget.assemblyFolders = commonFolders.ToArray();
+                gameTarget.assemblies = GetReferences(commonAssemblies, allDefinitionTargets);
+
+                targets.Add(gameTarget);
+            }
+            else
+                DeleteFile(Path.Combine(outputDir, EditorApplication.ScriptGameAssemblyName));
+
+            if (type == ScriptAssemblyType.Editor)
+            {
+                if (editorFiles.Count > 0)
                 {
-                    int i = 0;
-                    foreach (var otherAssembly in otherAssemblies)
-                    {
-                        assemblyFolders[i] = Path.GetDirectoryName(otherAssembly);
-                        assemblies[i] = Path.GetFileNameWithoutExtension(otherAssembly);
-                        ++i;    
-                    }
+                    List<ScriptCompileTarget> editorDependencies = new List<ScriptCompileTarget>(allDefinitionTargets);
+                    if (gameTarget != null)
+                        editorDependencies.Add(gameTarget);
+
+                    List<string> editorAssemblies = new List<string>(commonAssemblies);
+                    editorAssemblies.Add(EditorApplication.EditorAssemblyName);
+
+                    ScriptCompileTarget editorTarget = new ScriptCompileTarget();
+                    editorTarget.name = Path.GetFileNameWithoutExtension(EditorApplication.ScriptEditorAssemblyName);
+                    editorTarget.kind = ScriptAssemblyKind.Editor;
+                    editorTarget.files = editorFiles.ToArray();
+                    editorTarget.outputFile = Path.Combine(outputDir, EditorApplication.ScriptEditorAssemblyName);
+                    editorTarget.dependencies.AddRange(editorDependencies);
+                    editorTarget.assemblyFolders = commonFolders.ToArray();
+                    editorTarget.assemblies = GetReferences(editorAssemblies, editorDependencies);
+
+                    targets.Add(editorTarget);
                 }
-                assemblyFolders[assemblyFolders.Length - 2] = builtinAssemblyPath;
-                assemblyFolders[assemblyFolders.Length - 1] = EditorApplication.FrameworkAssemblyPath;
+                else
+                    DeleteFile(Path.Combine(outputDir, EditorApplication.ScriptEditorAssemblyName));
+            }
 
-                /*foreach (var assemblyFolder in assemblyFolders)
-                {
-                    //Debug.Print(assemblyFolder);
-                    BansheeEngine.Debug.Log(assemblyFolder);
-                }*/
+            string defines = BuildManager.GetDefines(platform);
+            return new ScriptCompilation(targets.ToArray(), defines, debug, outputDir);
+        }
 
-               
-                //otherAssemblies.CopyTo(assemblies, 0);
-                assemblies[assemblies.Length - 1] = EditorApplication.EngineAssemblyName;
+        /// <summary>
+        /// Creates a compile target for the provided assembly definition, after first creating targets for all the
+        /// definitions it references. Definitions without any script files are skipped.
+        /// </summary>
+        private static void AddDefinitionTarget(ScriptAssemblyDefinition definition, 
+            ScriptAssemblyDefinition[] definitions, Dictionary<ScriptAssemblyDefinition, List<string>> definitionFiles, 
+            List<string> commonFolders, List<string> commonAssemblies, string outputDir, 
+            HashSet<ScriptAssemblyDefinition> visiting, List<ScriptCompileTarget> targets, 
+            Dictionary<string, ScriptCompileTarget> definitionTargets)
+        {
+            if (definitionTargets.ContainsKey(definition.Name))
+                return;
 
-                outputFile = Path.Combine(outputDir, EditorApplication.ScriptGameAssemblyName);
+            if (visiting.Contains(definition))
+            {
+                BansheeEngine.Debug.LogError("Circular reference detected in assembly definition \"" + 
+                    definition.Name + "\".");
+                return;
             }
-            else
+
+            visiting.Add(definition);
+
+            List<ScriptCompileTarget> dependencies = new List<ScriptCompileTarget>();
+            foreach (var reference in definition.References)
             {
-                assemblyFolders = new string[otherAssemblies.Count + 3];
-                assemblies = new string[frameworkAssemblies.Length + otherAssemblies.Count + 3];
+                ScriptAssemblyDefinition referencedDefinition = Array.Find(definitions, 
+                    x => string.Equals(x.Name, reference, StringComparison.OrdinalIgnoreCase));
 
-                //TODO: Remove duplicate folders.
+                if (referencedDefinition == null)
                 {
-                    int i = 0;
-                    foreach (var otherAssembly in otherAssemblies)
-                    {
-                        assemblyFolders[i] = Path.GetDirectoryName(otherAssembly);
-                        assemblies[i] = Path.GetFileNameWithoutExtension(otherAssembly);
-                        ++i;
-                    }
+                    BansheeEngine.Debug.LogWarning("Assembly definition \"" + definition.Name + "\" references an " +
+                        "unknown assembly definition \"" + reference + "\".");
+                    continue;
                 }
-                assemblyFolders[assemblyFolders.Length - 3] = builtinAssemblyPath;
-                assemblyFolders[assemblyFolders.Length - 2] = EditorApplication.FrameworkAssemblyPath;
-                assemblyFolders[assemblyFolders.Length - 1] = EditorApplication.ScriptAssemblyPath;
 
-                assemblies[assemblies.Length - 1] = EditorApplication.EngineAssemblyName;
-                assemblies[assemblies.Length - 2] = EditorApplication.EditorAssemblyName;
-                assemblies[assemblies.Length - 3] = EditorApplication.ScriptGameAssemblyName;
+                AddDefinitionTarget(referencedDefinition, definitions, definitionFiles, commonFolders, commonAssemblies, 
+                    outputDir, visiting, targets, definitionTargets);
 
-                outputFile = Path.Combine(outputDir, EditorApplication.ScriptEditorAssemblyName);
+                ScriptCompileTarget dependency;
+                if (definitionTargets.TryGetValue(referencedDefinition.Name, out dependency))
+                    dependencies.Add(dependency);
             }
 
-            Array.Copy(frameworkAssemblies, 0, assemblies, otherAssemblies.Count, frameworkAssemblies.Length);
+            visiting.Remove(definition);
 
-            string defines = BuildManager.GetDefines(platform);
-            return new CompilerInstance(scriptFiles.ToArray(), defines, assemblyFolders, assemblies, debug, outputFile);
+            List<string> files = definitionFiles[definition];
+            if (files.Count == 0)
+            {
+                DeleteFile(Path.Combine(outputDir, definition.Name + ".dll"));
+                return;
+            }
+
+            ScriptCompileTarget target = new ScriptCompileTarget();
+            target.name = definition.Name;
+            target.kind = ScriptAssemblyKind.Definition;
+            target.files = files.ToArray();
+            target.outputFile = Path.Combine(outputDir, definition.Name + ".dll");
+            target.dependencies = dependencies;
+            target.assemblyFolders = commonFolders.ToArray();
+            target.assemblies = GetReferences(commonAssemblies, dependencies);
+
+            targets.Add(target);
+            definitionTargets[definition.Name] = target;
+        }
+
+        /// <summary>
+        /// Combines a list of assembly references with the names of the assemblies produced by the provided targets.
+        /// </summary>
+        private static string[] GetReferences(List<string> assemblies, List<ScriptCompileTarget> dependencies)
+        {
+            List<string> output = new List<string>(assemblies);
+            foreach (var dependency in dependencies)
+                output.Add(Path.GetFileName(dependency.outputFile));
+
+            return output.ToArray();
+        }
+
+        /// <summary>
+        /// Deletes a file if it exists.
+        /// </summary>
+        private static void DeleteFile(string path)
+        {
+            if (File.Exists(path))
+                File.Delete(path);
         }
     }
 
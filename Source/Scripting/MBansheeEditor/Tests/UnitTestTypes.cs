@@ -46,6 +46,21 @@ namespace BansheeEditor
         public int a2;
     }
 
+    /// <summary>
+    /// Helper component used for unit tests. Counts the number of times it was updated.
+    /// </summary>
+    internal class UT5_UpdateComponent : ManagedComponent
+    {
+        public static int numUpdates;
+        public int numInstanceUpdates;
+
+        private void OnUpdate()
+        {
+            numUpdates++;
+            numInstanceUpdates++;
+        }
+    }
+
     /// <summary>
     /// Helper type used for unit tests.
     /// </summary>
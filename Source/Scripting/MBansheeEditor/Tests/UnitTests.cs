@@ -18,6 +18,11 @@ namespace BansheeEditor
     /// </summary>
     class UnitTests
     {
+        /// <summary>
+        /// Checks of tests that span multiple frames. Each check is called once per frame until it returns true.
+        /// </summary>
+        static List<Func<bool>> frameChecks = new List<Func<bool>>();
+
         /// <summary>
         /// Triggers an exception when a unit test condition fails.
         /// </summary>
@@ -776,6 +781,429 @@ namespace BansheeEditor
             */
         }
 
+        /// <summary>
+        /// Ensures component updates triggered both one component at a time and in batches per component type reach
+        /// every component exactly once per frame.
+        /// </summary>
+        static void UnitTest5_BatchedUpdates()
+        {
+            const int numComponents = 8;
+            const int numIterations = 2;
+
+            SceneObject root;
+            UT5_UpdateComponent[] components = CreateUT5Components(numComponents, out root);
+
+            try
+            {
+                UT5_UpdateComponent.numUpdates = 0;
+
+                double perComponentMs, batchedMs;
+                Internal_UT5_BenchmarkUpdate(components, numIterations, out perComponentMs, out batchedMs);
+
+                Assert(UT5_UpdateComponent.numUpdates == numComponents * numIterations * 2);
+                for (int i = 0; i < numComponents; i++)
+                    Assert(components[i].numInstanceUpdates == numIterations * 2);
+            }
+            finally
+            {
+                root.Destroy(true);
+            }
+        }
+
+        /// <summary>
+        /// Creates scene objects with a <see cref="UT5_UpdateComponent"/> each, parented to a new root object.
+        /// </summary>
+        /// <param name="count">Number of components to create.</param>
+        /// <param name="root">Root object all the created scene objects are parented to.</param>
+        /// <returns>Created components.</returns>
+        static UT5_UpdateComponent[] CreateUT5Components(int count, out SceneObject root)
+        {
+            root = new SceneObject("UT5_Root");
+            UT5_UpdateComponent[] components = new UT5_UpdateComponent[count];
+            for (int i = 0; i < count; i++)
+            {
+                SceneObject so = new SceneObject("UT5_SO");
+                so.Parent = root;
+
+                components[i] = so.AddComponent<UT5_UpdateComponent>();
+            }
+
+            return components;
+        }
+
+        /// <summary>
+        /// Ensures sampling an animation curve one point at a time, over a range and at a set of times, all produce the
+        /// same values.
+        /// </summary>
+        static void UnitTest6_CurveSampling()
+        {
+            const int numSamples = 300;
+            const float duration = 10.0f;
+
+            AnimationCurve curve = CreateUT6Curve(duration);
+            float timeStep = duration / numSamples;
+
+            float[] rangeValues = new float[numSamples];
+            curve.EvaluateRange(0.0f, timeStep, rangeValues, false);
+
+            float[] times = new float[numSamples];
+            for (int i = 0; i < numSamples; i++)
+                times[i] = i * timeStep;
+
+            float[] manyValues = new float[numSamples];
+            curve.EvaluateMany(times, manyValues, false);
+
+            for (int i = 0; i < numSamples; i++)
+            {
+                float value = curve.Evaluate(times[i], false);
+
+                Assert(MathEx.ApproxEquals(value, rangeValues[i], 0.0001f));
+                Assert(MathEx.ApproxEquals(value, manyValues[i], 0.0001f));
+            }
+        }
+
+        /// <summary>
+        /// Creates an animation curve with a number of keyframes spread over the provided duration.
+        /// </summary>
+        /// <param name="duration">Time of the last keyframe, in seconds.</param>
+        /// <returns>Created curve.</returns>
+        static AnimationCurve CreateUT6Curve(float duration)
+        {
+            KeyFrame[] keyFrames = new KeyFrame[32];
+            for (int i = 0; i < keyFrames.Length; i++)
+            {
+                keyFrames[i].time = i * duration / (keyFrames.Length - 1);
+                keyFrames[i].value = MathEx.Sin(new Radian(i * 0.5f));
+                keyFrames[i].inTangent = 0.0f;
+                keyFrames[i].outTangent = 0.0f;
+            }
+
+            return new AnimationCurve(keyFrames);
+        }
+
+        /// <summary>
+        /// Tests direct access to pixel data, making sure raw bytes, row and color accessors agree with each other and
+        /// with the per-pixel accessors.
+        /// </summary>
+        static void UnitTest7_PixelDataAccess()
+        {
+            // Odd width so both the four pixel and the single pixel conversion paths are used
+            const int width = 7;
+            const int height = 3;
+
+            PixelData pixelData = new PixelData(width, height, 1, PixelFormat.BGRA8);
+            Assert(pixelData.RowSize == width * 4);
+
+            byte[] raw = new byte[pixelData.RawSize];
+            for (int y = 0; y < height; y++)
+            {
+                for (int x = 0; x < width; x++)
+                {
+                    int offset = (y * (int)pixelData.RawRowPitch + x) * 4;
+                    raw[offset + 0] = (byte)(x * 30); // B
+                    raw[offset + 1] = (byte)(y * 80); // G
+                    raw[offset + 2] = (byte)(255 - x * 30); // R
+                    raw[offset + 3] = 255; // A
+                }
+            }
+
+            Assert(pixelData.WriteRawPixels(raw));
+
+            Color[] colors = new Color[width * height];
+            Assert(pixelData.ReadPixels(colors));
+
+            for (int y = 0; y < height; y++)
+            {
+                for (int x = 0; x < width; x++)
+                {
+                    Color color = colors[y * width + x];
+                    Color expected = pixelData.GetPixel(x, y);
+
+                    Assert(MathEx.ApproxEquals(color.r, expected.r, 0.001f));
+                    Assert(MathEx.ApproxEquals(color.g, expected.g, 0.001f));
+                    Assert(MathEx.ApproxEquals(color.b, expected.b, 0.001f));
+                    Assert(MathEx.ApproxEquals(color.a, expected.a, 0.001f));
+                    Assert(MathEx.ApproxEquals(color.r, (255 - x * 30) / 255.0f, 0.001f));
+                }
+            }
+
+            // Write back through the color path, which must round trip to the same bytes
+            Assert(pixelData.WritePixels(colors));
+
+            byte[] rawCopy = new byte[pixelData.RawSize];
+            Assert(pixelData.ReadRawPixels(rawCopy));
+
+            for (int i = 0; i < raw.Length; i++)
+                Assert(raw[i] == rawCopy[i]);
+
+            byte[] row = new byte[pixelData.RowSize];
+            Color[] rowColors = new Color[width];
+            Assert(pixelData.ReadRow(1, 0, row));
+            Assert(pixelData.ReadRow(1, 0, rowColors));
+            Assert(row[1] == 80);
+            Assert(MathEx.ApproxEquals(rowColors[0].g, 80 / 255.0f, 0.001f));
+            Assert(!pixelData.ReadRow(height, 0, row));
+
+            using (PixelDataLock pixelLock = pixelData.Lock())
+            {
+                IntPtr rowPtr = pixelLock.GetRow(2);
+                Assert(rowPtr != IntPtr.Zero);
+                Assert(System.Runtime.InteropServices.Marshal.ReadByte(rowPtr, 1) == 160);
+
+                // Other accesses are rejected while the lock is held
+                Assert(!pixelData.ReadRow(1, 0, row));
+            }
+
+            // And allowed again once it's released
+            Assert(pixelData.ReadRow(1, 0, row));
+        }
+
+        /// <summary>
+        /// Tests that component versions used for inspector refresh change when, and only when, the component is modified
+        /// through the serialization layer.
+        /// </summary>
+        static void UnitTest8_ChangeTracking()
+        {
+            SceneObject so = new SceneObject("UT8_SO");
+            UT1_Component1 componentA = so.AddComponent<UT1_Component1>();
+            UT1_Component1 componentB = so.AddComponent<UT1_Component1>();
+
+            try
+            {
+                ulong versionA = ManagedChangeTracker.GetVersion(componentA.InstanceId);
+                ulong versionB = ManagedChangeTracker.GetVersion(componentB.InstanceId);
+
+                // Field of a component only changes the version of that component
+                SerializableObject objA = new SerializableObject(componentA);
+                objA.FindField("a").GetProperty().SetValue(42);
+
+                Assert(componentA.a == 42);
+                Assert(ManagedChangeTracker.GetVersion(componentA.InstanceId) != versionA);
+                Assert(ManagedChangeTracker.GetVersion(componentB.InstanceId) == versionB);
+
+                // Reading doesn't change any versions
+                versionA = ManagedChangeTracker.GetVersion(componentA.InstanceId);
+                Assert(objA.FindField("a").GetProperty().GetValue<int>() == 42);
+                Assert(ManagedChangeTracker.GetVersion(componentA.InstanceId) == versionA);
+
+                // Nested objects can't be attributed to a component, so they change the versions of all components
+                SerializableObject nestedObj = new SerializableObject(componentB.complex2);
+                nestedObj.Fields[0].GetProperty().SetValue(7);
+
+                Assert(ManagedChangeTracker.GetVersion(componentA.InstanceId) != versionA);
+                Assert(ManagedChangeTracker.GetVersion(componentB.InstanceId) != versionB);
+            }
+            finally
+            {
+                so.Destroy(true);
+            }
+        }
+
+        /// <summary>
+        /// Tests asynchronous loading of a batch of resources from disk, making sure progress is reported, the
+        /// completion callback triggers exactly once, and the resources are returned in the order they were requested.
+        /// </summary>
+        static void UnitTest9_AsyncResourceLoad()
+        {
+            const int numResources = 8;
+            const int maxPollFrames = 600;
+
+            ResourceRef[] references = Internal_UT9_CreateResources(numResources);
+
+            try
+            {
+                int numCompleted = 0;
+                AsyncResourceLoad load = Resources.LoadAsync(references, false);
+                load.OnCompleted += x => numCompleted++;
+
+                Assert(load.Count == numResources);
+                Assert(load.Progress >= 0.0f && load.Progress <= 1.0f);
+
+                load.BlockUntilComplete();
+                load.BlockUntilComplete();
+
+                Assert(load.IsComplete);
+                Assert(numCompleted == 1);
+                Assert(load.Progress == 1.0f);
+
+                for (int i = 0; i < numResources; i++)
+                {
+                    Prefab prefab = load.GetResource<Prefab>(i);
+                    Assert(prefab != null);
+
+                    SceneObject instance = prefab.Instantiate();
+                    Assert(instance.Name == "UT9_" + i);
+
+                    instance.Destroy(true);
+                }
+
+                Assert(load.GetResource<Prefab>(numResources) == null);
+            }
+            finally
+            {
+                Internal_UT9_DeleteResources(numResources);
+            }
+
+            // Empty batches complete immediately
+            AsyncResourceLoad emptyLoad = Resources.LoadAsync(new ResourceRef[0]);
+            emptyLoad.BlockUntilComplete();
+
+            Assert(emptyLoad.IsComplete);
+            Assert(emptyLoad.Progress == 1.0f);
+
+            // Without blocking, completion is only reported by the per-frame update, so poll a load across frames
+            ResourceRef[] polledReferences = Internal_UT9_CreateResources(numResources);
+            AsyncResourceLoad polledLoad = Resources.LoadAsync(polledReferences, false);
+
+            int numPolledCompleted = 0;
+            polledLoad.OnCompleted += x => numPolledCompleted++;
+
+            Assert(!polledLoad.IsComplete);
+
+            int numFrames = 0;
+            frameChecks.Add(() =>
+            {
+                numFrames++;
+
+                try
+                {
+                    if (!polledLoad.IsComplete)
+                    {
+                        Assert(numPolledCompleted == 0);
+                        Assert(numFrames < maxPollFrames);
+
+                        return false;
+                    }
+
+                    Assert(numPolledCompleted == 1);
+                    Assert(polledLoad.Progress == 1.0f);
+
+                    for (int i = 0; i < numResources; i++)
+                        Assert(polledLoad.GetResource<Prefab>(i) != null);
+                }
+                catch
+                {
+                    Internal_UT9_DeleteResources(numResources);
+                    throw;
+                }
+
+                Internal_UT9_DeleteResources(numResources);
+                return true;
+            });
+        }
+
+        /// <summary>
+        /// Ensures a list and a dictionary survive the round trip through the serialization system intact, both when
+        /// copied one entry at a time and when all the entries are moved in a single call.
+        /// </summary>
+        static void UnitTest10_SerializableCollections()
+        {
+            const int numEntries = 16;
+
+            List<int> list;
+            Dictionary<int, string> dictionary;
+            CreateUT10Collections(numEntries, out list, out dictionary);
+
+            List<int> listCopy;
+            Dictionary<int, string> dictionaryCopy;
+            double perEntryMs, bulkMs;
+            Internal_UT10_BenchmarkCollections(list, dictionary, out listCopy, out dictionaryCopy, out perEntryMs,
+                out bulkMs);
+
+            Assert(listCopy != null && listCopy.Count == numEntries);
+            Assert(dictionaryCopy != null && dictionaryCopy.Count == numEntries);
+
+            for (int i = 0; i < numEntries; i++)
+            {
+                Assert(listCopy[i] == i * 3);
+
+                string value;
+                Assert(dictionaryCopy.TryGetValue(i, out value) && value == "Entry" + i);
+            }
+        }
+
+        /// <summary>
+        /// Creates a list and a dictionary with the provided number of entries.
+        /// </summary>
+        /// <param name="count">Number of entries in each collection.</param>
+        /// <param name="list">List containing multiples of three.</param>
+        /// <param name="dictionary">Dictionary mapping indices to strings containing the index.</param>
+        static void CreateUT10Collections(int count, out List<int> list, out Dictionary<int, string> dictionary)
+        {
+            list = new List<int>(count);
+            dictionary = new Dictionary<int, string>(count);
+            for (int i = 0; i < count; i++)
+            {
+                list.Add(i * 3);
+                dictionary.Add(i, "Entry" + i);
+            }
+        }
+
+        /// <summary>
+        /// Ensures the shared index of editor extension attributes finds the same menu item methods and custom
+        /// inspector classes as a full scan of the editor assembly.
+        /// </summary>
+        static void UnitTest11_AttributeIndex()
+        {
+            int numFound;
+            Assert(Internal_UT11_CompareAttributeIndex(out numFound));
+            Assert(numFound > 0);
+        }
+
+        /// <summary>
+        /// Tests pinning of resources through resource references, and the residency information reported for them.
+        /// </summary>
+        static void UnitTest12_ResourcePinning()
+        {
+            const int width = 64;
+            const int height = 32;
+            const long memoryUsage = width * height * 4;
+
+            Texture texture = Texture.Create2D(width, height, PixelFormat.RGBA8);
+            ResourceRef reference = Internal_UT12_GetResourceRef(texture);
+            ResourceRef otherReference = Internal_UT12_GetResourceRef(texture);
+
+            try
+            {
+                Assert(reference.IsLoaded);
+                Assert(reference.MemoryUsage == memoryUsage);
+                Assert(!reference.IsPinned);
+
+                // Resource stays pinned until the pins for all reasons are removed
+                reference.Pin("UT12_A");
+                reference.Pin("UT12_B");
+                Assert(reference.IsPinned);
+                Assert(otherReference.IsPinned);
+
+                reference.Unpin("UT12_A");
+                Assert(reference.IsPinned);
+
+                reference.Unpin("UT12_Unknown");
+                Assert(reference.IsPinned);
+
+                // Multiple references to the same resource are only counted once
+                ResourceResidency residency =
+                    ResourceRef.GetResidency(new ResourceRef[] { reference, otherReference, reference });
+
+                Assert(residency.NumReferences == 3);
+                Assert(residency.NumLoaded == 1);
+                Assert(residency.NumPinned == 1);
+                Assert(residency.MemoryUsage == memoryUsage);
+
+                reference.Unpin("UT12_B");
+                Assert(!reference.IsPinned);
+
+                residency = ResourceRef.GetResidency(new ResourceRef[] { reference, otherReference });
+                Assert(residency.NumLoaded == 1);
+                Assert(residency.NumPinned == 0);
+            }
+            finally
+            {
+                reference.Unpin("UT12_A");
+                reference.Unpin("UT12_B");
+            }
+        }
+
         /// <summary>
         /// Runs all tests.
         /// </summary>
@@ -785,6 +1213,127 @@ namespace BansheeEditor
             UnitTest2_SerializableProperties();
             UnitTest3_ManagedDiff();
             UnitTest4_Prefabs();
+            UnitTest5_BatchedUpdates();
+            UnitTest6_CurveSampling();
+            UnitTest7_PixelDataAccess();
+            UnitTest8_ChangeTracking();
+            UnitTest9_AsyncResourceLoad();
+            UnitTest10_SerializableCollections();
+            UnitTest11_AttributeIndex();
+            UnitTest12_ResourcePinning();
+        }
+
+        /// <summary>
+        /// Advances the tests that span multiple frames. Called once per frame by the runtime after
+        /// <see cref="RunTests"/>, for as long as it returns true.
+        /// </summary>
+        /// <returns>True if some of the tests are still in progress, false otherwise.</returns>
+        static bool UpdateTests()
+        {
+            for (int i = frameChecks.Count - 1; i >= 0; i--)
+            {
+                Func<bool> check = frameChecks[i];
+                frameChecks.RemoveAt(i);
+
+                if (!check())
+                    frameChecks.Insert(i, check);
+            }
+
+            return frameChecks.Count > 0;
+        }
+
+        /// <summary>
+        /// Compares the cost of triggering component updates one component at a time, versus triggering them in batches
+        /// per component type.
+        /// </summary>
+        static void Benchmark_BatchedUpdates()
+        {
+            const int numComponents = 20000;
+            const int numIterations = 10;
+
+            SceneObject root;
+            UT5_UpdateComponent[] components = CreateUT5Components(numComponents, out root);
+
+            try
+            {
+                double perComponentMs, batchedMs;
+                Internal_UT5_BenchmarkUpdate(components, numIterations, out perComponentMs, out batchedMs);
+
+                Internal_AddBenchmarkResult("script.update.perComponent", numComponents,
+                    perComponentMs / numIterations);
+                Internal_AddBenchmarkResult("script.update.batched", numComponents, batchedMs / numIterations);
+            }
+            finally
+            {
+                root.Destroy(true);
+            }
+        }
+
+        /// <summary>
+        /// Compares the cost of sampling an animation curve one point at a time, versus sampling all the points in a
+        /// single call, either over a range or at a set of times.
+        /// </summary>
+        static void Benchmark_CurveSampling()
+        {
+            const int numSamples = 1000000;
+            const float duration = 10.0f;
+
+            AnimationCurve curve = CreateUT6Curve(duration);
+            float timeStep = duration / numSamples;
+
+            float[] values = new float[numSamples];
+            System.Diagnostics.Stopwatch timer = System.Diagnostics.Stopwatch.StartNew();
+            for (int i = 0; i < numSamples; i++)
+                values[i] = curve.Evaluate(i * timeStep, false);
+
+            Internal_AddBenchmarkResult("curve.sample.perSample", numSamples, timer.Elapsed.TotalMilliseconds);
+
+            timer.Restart();
+            curve.EvaluateRange(0.0f, timeStep, values, false);
+
+            Internal_AddBenchmarkResult("curve.sample.range", numSamples, timer.Elapsed.TotalMilliseconds);
+
+            float[] times = new float[numSamples];
+            for (int i = 0; i < numSamples; i++)
+                times[i] = i * timeStep;
+
+            timer.Restart();
+            curve.EvaluateMany(times, values, false);
+
+            Internal_AddBenchmarkResult("curve.sample.many", numSamples, timer.Elapsed.TotalMilliseconds);
+        }
+
+        /// <summary>
+        /// Compares the cost of copying a large list and dictionary through the serialization system one entry at a
+        /// time, versus moving all the entries in a single call as done by serialization.
+        /// </summary>
+        static void Benchmark_SerializableCollections()
+        {
+            const int numEntries = 100000;
+
+            List<int> list;
+            Dictionary<int, string> dictionary;
+            CreateUT10Collections(numEntries, out list, out dictionary);
+
+            List<int> listCopy;
+            Dictionary<int, string> dictionaryCopy;
+            double perEntryMs, bulkMs;
+            Internal_UT10_BenchmarkCollections(list, dictionary, out listCopy, out dictionaryCopy, out perEntryMs,
+                out bulkMs);
+
+            Internal_AddBenchmarkResult("script.collections.perEntry", numEntries, perEntryMs);
+            Internal_AddBenchmarkResult("script.collections.bulk", numEntries, bulkMs);
+        }
+
+        /// <summary>
+        /// Runs all benchmarks. Triggered by the editor benchmarks (see the --benchmark command line option), which
+        /// also receive the results.
+        /// </summary>
+        static void RunBenchmarks()
+        {
+            Benchmark_BatchedUpdates();
+            Benchmark_CurveSampling();
+            Benchmark_SerializableCollections();
         }
 
         [MethodImpl(MethodImplOptions.InternalCall)]
@@ -795,6 +1344,30 @@ namespace BansheeEditor
 
         [MethodImpl(MethodImplOptions.InternalCall)]
         private static extern void Internal_UT3_ApplyDiff(UT_DiffObj obj);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_UT5_BenchmarkUpdate(UT5_UpdateComponent[] components, int numIterations,
+            out double perComponentMs, out double batchedMs);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern ResourceRef[] Internal_UT9_CreateResources(int count);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_UT9_DeleteResources(int count);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_UT10_BenchmarkCollections(List<int> list,
+            Dictionary<int, string> dictionary, out List<int> listCopy, out Dictionary<int, string> dictionaryCopy,
+            out double perEntryMs, out double bulkMs);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern bool Internal_UT11_CompareAttributeIndex(out int numFound);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern ResourceRef Internal_UT12_GetResourceRef(Resource resource);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_AddBenchmarkResult(string name, int count, double ms);
     }
 
     /** @} */
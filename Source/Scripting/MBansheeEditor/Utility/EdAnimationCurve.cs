@@ -150,6 +150,19 @@ namespace BansheeEditor
             return native.Evaluate(time, loop);
         }
 
+        /// <summary>
+        /// Evaluates the animation curve at evenly spaced points, one for each element of the output array.
+        /// </summary>
+        /// <param name="startTime">Time of the first sample.</param>
+        /// <param name="timeStep">Time between two consecutive samples.</param>
+        /// <param name="output">Array to write the evaluated values to.</param>
+        /// <param name="loop">If true the curve will loop when it goes past the end or beggining. Otherwise the curve 
+        ///                    value will be clamped.</param>
+        internal void EvaluateRange(float startTime, float timeStep, float[] output, bool loop = true)
+        {
+            native.EvaluateRange(startTime, timeStep, output, loop);
+        }
+
         /// <summary>
         /// Adds a new keyframe to the animation curve. Keyframe will use the automatic tangent mode.
         /// </summary>
@@ -17,33 +17,54 @@ namespace BansheeEditor
     public class FolderMonitor : ScriptObject
     {
         /// <summary>
-        /// Triggers when a file in the monitored folder is modified. Provides absolute path to the modified file.
+        /// Triggers when a file in the monitored folder is modified. Provides absolute path to the modified file. Not
+        /// triggered if the monitor batches changes.
         /// </summary>
         public Action<string> OnModified;
 
         /// <summary>
         /// Triggers when a file/folder is added in the monitored folder. Provides absolute path to the added file/folder.
+        /// Not triggered if the monitor batches changes.
         /// </summary>
         public Action<string> OnAdded;
 
         /// <summary>
         /// Triggers when a file/folder is removed from the monitored folder. Provides absolute path to the removed 
-        /// file/folder.
+        /// file/folder. Not triggered if the monitor batches changes.
         /// </summary>
         public Action<string> OnRemoved;
 
         /// <summary>
         /// Triggers when a file/folder is renamed in the monitored folder. Provides absolute path with old and new names.
+        /// Not triggered if the monitor batches changes.
         /// </summary>
         public Action<string, string> OnRenamed;
 
+        /// <summary>
+        /// Triggers once a burst of changes in the monitored folder settles down. Provides absolute paths to all the files
+        /// and folders that were added, removed, modified or renamed since the last time this triggered. Each path is
+        /// reported once, and paths inside a reported folder are omitted. Only triggered if the monitor batches changes.
+        /// </summary>
+        public Action<string[]> OnChanged;
+
         /// <summary>
         /// Constructs a new folder monitor instance that immediately starts monitor the provided folder.
         /// </summary>
         /// <param name="folderToMonitor">Absolute path to the folder to monitor.</param>
         public FolderMonitor(string folderToMonitor)
+            : this(folderToMonitor, false)
+        { }
+
+        /// <summary>
+        /// Constructs a new folder monitor instance that immediately starts monitor the provided folder.
+        /// </summary>
+        /// <param name="folderToMonitor">Absolute path to the folder to monitor.</param>
+        /// <param name="batchChanges">If true, changes are only reported in batches through <see cref="OnChanged"/>,
+        ///                            once a burst of changes settles down. Otherwise each change is reported
+        ///                            individually as it happens.</param>
+        public FolderMonitor(string folderToMonitor, bool batchChanges)
         {
-            Internal_CreateInstance(this, folderToMonitor);
+            Internal_CreateInstance(this, folderToMonitor, batchChanges);
         }
 
         /// <summary>
@@ -95,8 +116,18 @@ namespace BansheeEditor
                 OnRenamed(from, to);
         }
 
+        /// <summary>
+        /// Triggered by the runtime when a burst of changes in the monitored folder settles down.
+        /// </summary>
+        /// <param name="paths">Absolute paths to the changed files/folders.</param>
+        private void Internal_DoOnChanged(string[] paths)
+        {
+            if (OnChanged != null)
+                OnChanged(paths);
+        }
+
         [MethodImpl(MethodImplOptions.InternalCall)]
-        private static extern void Internal_CreateInstance(FolderMonitor instance, string folder);
+        private static extern void Internal_CreateInstance(FolderMonitor instance, string folder, bool batchChanges);
 
         [MethodImpl(MethodImplOptions.InternalCall)]
         private static extern void Internal_Destroy(IntPtr thisPtr);
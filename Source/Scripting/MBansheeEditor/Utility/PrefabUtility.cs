@@ -34,8 +34,9 @@ namespace BansheeEditor
         /// is not a prefab instance nothing happens.
         /// </summary>
         /// <param name="obj">Prefab instance whose prefab to update.</param>
-        /// <param name="refreshScene">If true, all prefab instances in the current scene will be updated so they consistent
-        ///                            with the newly saved data.</param>
+        /// <param name="refreshScene">If true, all other instances of the prefab in the current scene will be updated so
+        ///                            they are consistent with the newly saved data. Instances are updated over the next
+        ///                            few frames, use <see cref="UpdateProgress"/> to track the progress.</param>
         public static void ApplyPrefab(SceneObject obj, bool refreshScene = true)
         {
             if (obj == null)
@@ -45,13 +46,6 @@ namespace BansheeEditor
             if (prefabInstanceRoot == null)
                 return;
 
-            if (refreshScene)
-            {
-                SceneObject root = Scene.Root;
-                if (root != null)
-                    Internal_RecordPrefabDiff(root.GetCachedPtr());
-            }
-
             UUID prefabUUID = GetPrefabUUID(prefabInstanceRoot);
             string prefabPath = ProjectLibrary.GetPath(prefabUUID);
             Prefab prefab = ProjectLibrary.Load<Prefab>(prefabPath);
@@ -60,16 +54,27 @@ namespace BansheeEditor
                 IntPtr soPtr = prefabInstanceRoot.GetCachedPtr();
                 IntPtr prefabPtr = prefab.GetCachedPtr();
 
-                Internal_ApplyPrefab(soPtr, prefabPtr);
+                Internal_ApplyPrefab(soPtr, prefabPtr, refreshScene);
                 ProjectLibrary.Save(prefab);
             }
+        }
 
-            if (refreshScene)
-            {
-                SceneObject root = Scene.Root;
-                if (root != null)
-                    Internal_UpdateFromPrefab(root.GetCachedPtr());
-            }
+        /// <summary>
+        /// Checks are there any prefab instances in the scene still waiting to be updated after a call to
+        /// <see cref="ApplyPrefab"/>.
+        /// </summary>
+        public static bool IsUpdating
+        {
+            get { return Internal_IsUpdating(); }
+        }
+
+        /// <summary>
+        /// Returns the percentage of prefab instances updated since the last call to <see cref="ApplyPrefab"/>, in
+        /// [0, 1] range.
+        /// </summary>
+        public static float UpdateProgress
+        {
+            get { return Internal_GetUpdateProgress(); }
         }
 
         /// <summary>
@@ -151,7 +156,7 @@ namespace BansheeEditor
         private static extern void Internal_BreakPrefab(IntPtr soPtr);
 
         [MethodImpl(MethodImplOptions.InternalCall)]
-        private static extern void Internal_ApplyPrefab(IntPtr soPtr, IntPtr prefabPtr);
+        private static extern void Internal_ApplyPrefab(IntPtr soPtr, IntPtr prefabPtr, bool updateInstances);
 
         [MethodImpl(MethodImplOptions.InternalCall)]
         private static extern void Internal_RecordPrefabDiff(IntPtr soPtr);
@@ -170,6 +175,12 @@ namespace BansheeEditor
 
         [MethodImpl(MethodImplOptions.InternalCall)]
         private static extern void Internal_GetPrefabUUID(IntPtr soPtr, out UUID uuid);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern bool Internal_IsUpdating();
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern float Internal_GetUpdateProgress();
     }
 
     /** @} */
@@ -23,6 +23,7 @@ namespace BansheeEditor
 
         private CurveDrawInfo[] curveInfos;
         private bool[][] selectedKeyframes;
+        private float[] sampleBuffer = new float[0];
 
         private float yRange = 20.0f;
         private float yOffset;
@@ -579,12 +580,16 @@ namespace BansheeEditor
                         timeIncrement = 0.0f;
                     }
 
+                    // Sample the entire segment in a single call. The buffer is kept as long as the sample count stays the same
+                    if (sampleBuffer.Length != numSplits)
+                        sampleBuffer = new float[numSplits];
+
+                    curve.EvaluateRange(start, timeIncrement, sampleBuffer, false);
+
                     for (int j = 0; j < numSplits; j++)
                     {
                         float t = Math.Min(start + j * timeIncrement, end);
-                        float value = curve.Evaluate(t, false);
-
-                        linePoints.Add(CurveToPixelSpace(new Vector2(t, value)));
+                        linePoints.Add(CurveToPixelSpace(new Vector2(t, sampleBuffer[j])));
                     }
                 }
             }
@@ -300,7 +300,7 @@ namespace BansheeEditor
             string destBansheeAssemblyFolder = Path.Combine(destRoot, bansheeAssemblyFolder);
 
             Directory.CreateDirectory(destBansheeAssemblyFolder);
-            CompilerInstance ci = ScriptCompiler.CompileAsync(ScriptAssemblyType.Game, ActivePlatform, platformInfo.Debug, destBansheeAssemblyFolder);
+            ScriptCompilation ci = ScriptCompiler.CompileAsync(ScriptAssemblyType.Game, ActivePlatform, platformInfo.Debug, destBansheeAssemblyFolder);
 
             // Copy engine assembly
             {
@@ -43,7 +43,7 @@ namespace BansheeEditor
         /// <inheritdoc/>
         public override InspectableState Refresh(int layoutIndex)
         {
-            return arrayGUIField.Refresh();
+            return arrayGUIField.Refresh(CheckVersionChanged());
         }
 
         /// <inheritdoc/>
@@ -129,31 +129,40 @@ namespace BansheeEditor
                 return guiArray;
             }
 
-            /// <inheritdoc/>
-            public override InspectableState Refresh()
+            /// <summary>
+            /// Refreshes contents of all array rows and checks if anything was modified.
+            /// </summary>
+            /// <param name="refreshValue">True if the array should be re-read from the property to detect
+            ///                            modifications made outside of the inspector.</param>
+            /// <returns>State representing was anything modified between two last calls to <see cref="Refresh"/>.
+            ///          </returns>
+            public InspectableState Refresh(bool refreshValue)
             {
-                // Check if any modifications to the array were made outside the inspector
-                Array newArray = property.GetValue<Array>();
-                if (array == null && newArray != null)
-                {
-                    array = newArray;
-                    numElements = array.Length;
-                    BuildGUI();
-                }
-                else if (newArray == null && array != null)
+                if (refreshValue)
                 {
-                    array = null;
-                    numElements = 0;
-                    BuildGUI();
-                }
-                else
-                {
-                    if (array != null)
+                    // Check if any modifications to the array were made outside the inspector
+                    Array newArray = property.GetValue<Array>();
+                    if (array == null && newArray != null)
+                    {
+                        array = newArray;
+                        numElements = array.Length;
+                        BuildGUI();
+                    }
+                    else if (newArray == null && array != null)
+                    {
+                        array = null;
+                        numElements = 0;
+                        BuildGUI();
+                    }
+                    else
                     {
-                        if (numElements != array.Length)
+                        if (array != null)
                         {
-                            numElements = array.Length;
-                            BuildGUI();
+                            if (numElements != array.Length)
+                            {
+                                numElements = array.Length;
+                                BuildGUI();
+                            }
                         }
                     }
                 }
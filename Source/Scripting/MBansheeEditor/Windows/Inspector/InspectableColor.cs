@@ -49,7 +49,7 @@ namespace BansheeEditor
         /// <inheritdoc/>
         public override InspectableState Refresh(int layoutIndex)
         {
-            if (guiField != null)
+            if (guiField != null && CheckVersionChanged())
                 guiField.Value = property.GetValue<Color>();
 
             InspectableState oldState = state;
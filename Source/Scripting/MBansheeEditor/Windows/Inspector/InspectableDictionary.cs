@@ -45,7 +45,7 @@ namespace BansheeEditor
         /// <inheritdoc/>
         public override InspectableState Refresh(int layoutIndex)
         {
-            return dictionaryGUIField.Refresh();
+            return dictionaryGUIField.Refresh(CheckVersionChanged());
         }
 
         /// <inheritdoc/>
@@ -139,31 +139,40 @@ namespace BansheeEditor
             }
 
 
-            /// <inheritdoc/>
-            public override InspectableState Refresh()
+            /// <summary>
+            /// Refreshes contents of all dictionary rows and checks if anything was modified.
+            /// </summary>
+            /// <param name="refreshValue">True if the dictionary should be re-read from the property to detect
+            ///                            modifications made outside of the inspector.</param>
+            /// <returns>State representing was anything modified between two last calls to <see cref="Refresh"/>.
+            ///          </returns>
+            public InspectableState Refresh(bool refreshValue)
             {
-                // Check if any modifications to the array were made outside the inspector
-                IDictionary newDict = property.GetValue<IDictionary>();
-                if (dictionary == null && newDict != null)
-                {
-                    dictionary = newDict;
-                    numElements = dictionary.Count;
-                    BuildGUI();
-                }
-                else if (newDict == null && dictionary != null)
+                if (refreshValue)
                 {
-                    dictionary = null;
-                    numElements = 0;
-                    BuildGUI();
-                }
-                else
-                {
-                    if (dictionary != null)
+                    // Check if any modifications to the array were made outside the inspector
+                    IDictionary newDict = property.GetValue<IDictionary>();
+                    if (dictionary == null && newDict != null)
+                    {
+                        dictionary = newDict;
+                        numElements = dictionary.Count;
+                        BuildGUI();
+                    }
+                    else if (newDict == null && dictionary != null)
+                    {
+                        dictionary = null;
+                        numElements = 0;
+                        BuildGUI();
+                    }
+                    else
                     {
-                        if (numElements != dictionary.Count)
+                        if (dictionary != null)
                         {
-                            numElements = dictionary.Count;
-                            BuildGUI();
+                            if (numElements != dictionary.Count)
+                            {
+                                numElements = dictionary.Count;
+                                BuildGUI();
+                            }
                         }
                     }
                 }
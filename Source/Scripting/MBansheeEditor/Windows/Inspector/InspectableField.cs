@@ -25,6 +25,8 @@ namespace BansheeEditor
         protected int depth;
         protected SerializableProperty.FieldType type; 
 
+        private ulong refreshedVersion;
+
         /// <summary>
         /// Property this field is displaying contents of.
         /// </summary>
@@ -81,6 +83,23 @@ namespace BansheeEditor
             return InspectableState.NotModified;
         }
 
+        /// <summary>
+        /// Checks if the contents of the parent inspector changed since the last time this method returned true. Fields
+        /// should only read the property value during <see cref="Refresh"/> if this returns true.
+        /// </summary>
+        /// <returns>True if the property value might have changed, false if it is known to be unchanged.</returns>
+        protected bool CheckVersionChanged()
+        {
+            if (parent == null)
+                return true;
+
+            if (parent.Version == refreshedVersion)
+                return false;
+
+            refreshedVersion = parent.Version;
+            return true;
+        }
+
         /// <summary>
         /// Returns the total number of GUI elements in the field's layout.
         /// </summary>
@@ -48,7 +48,7 @@ namespace BansheeEditor
         /// <inheritdoc/>
         public override InspectableState Refresh(int layoutIndex)
         {
-            if (guiField != null)
+            if (guiField != null && CheckVersionChanged())
                 guiField.Value = property.GetValue<GameObject>();
 
             InspectableState oldState = state;
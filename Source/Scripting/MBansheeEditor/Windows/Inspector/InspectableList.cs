@@ -45,7 +45,7 @@ namespace BansheeEditor
         /// <inheritdoc/>
         public override InspectableState Refresh(int layoutIndex)
         {
-            return listGUIField.Refresh();
+            return listGUIField.Refresh(CheckVersionChanged());
         }
 
         /// <inheritdoc/>
@@ -131,31 +131,40 @@ namespace BansheeEditor
                 return listGUI;
             }
 
-            /// <inheritdoc/>
-            public override InspectableState Refresh()
+            /// <summary>
+            /// Refreshes contents of all list rows and checks if anything was modified.
+            /// </summary>
+            /// <param name="refreshValue">True if the list should be re-read from the property to detect
+            ///                            modifications made outside of the inspector.</param>
+            /// <returns>State representing was anything modified between two last calls to <see cref="Refresh"/>.
+            ///          </returns>
+            public InspectableState Refresh(bool refreshValue)
             {
-                // Check if any modifications to the array were made outside the inspector
-                IList newList = property.GetValue<IList>();
-                if (list == null && newList != null)
-                {
-                    list = newList;
-                    numElements = list.Count;
-                    BuildGUI();
-                }
-                else if (newList == null && list != null)
+                if (refreshValue)
                 {
-                    list = null;
-                    numElements = 0;
-                    BuildGUI();
-                }
-                else
-                {
-                    if (list != null)
+                    // Check if any modifications to the array were made outside the inspector
+                    IList newList = property.GetValue<IList>();
+                    if (list == null && newList != null)
+                    {
+                        list = newList;
+                        numElements = list.Count;
+                        BuildGUI();
+                    }
+                    else if (newList == null && list != null)
+                    {
+                        list = null;
+                        numElements = 0;
+                        BuildGUI();
+                    }
+                    else
                     {
-                        if (numElements != list.Count)
+                        if (list != null)
                         {
-                            numElements = list.Count;
-                            BuildGUI();
+                            if (numElements != list.Count)
+                            {
+                                numElements = list.Count;
+                                BuildGUI();
+                            }
                         }
                     }
                 }
@@ -56,24 +56,26 @@ namespace BansheeEditor
         public override InspectableState Refresh(int layoutIndex)
         {
             // Check if modified internally and rebuild if needed
-            object newPropertyValue = property.GetValue<object>();
-            if (forceUpdate)
+            if (forceUpdate || CheckVersionChanged())
             {
-                propertyValue = newPropertyValue;
-                BuildGUI(layoutIndex);
-                
-                forceUpdate = false;
-            }
-            else if (propertyValue == null && newPropertyValue != null)
-            {
-                propertyValue = newPropertyValue;
-                BuildGUI(layoutIndex);
-                
-            }
-            else if (newPropertyValue == null && propertyValue != null)
-            {
-                propertyValue = null;
-                BuildGUI(layoutIndex);
+                object newPropertyValue = property.GetValue<object>();
+                if (forceUpdate)
+                {
+                    propertyValue = newPropertyValue;
+                    BuildGUI(layoutIndex);
+
+                    forceUpdate = false;
+                }
+                else if (propertyValue == null && newPropertyValue != null)
+                {
+                    propertyValue = newPropertyValue;
+                    BuildGUI(layoutIndex);
+                }
+                else if (newPropertyValue == null && propertyValue != null)
+                {
+                    propertyValue = null;
+                    BuildGUI(layoutIndex);
+                }
             }
 
             InspectableState state = InspectableState.NotModified;
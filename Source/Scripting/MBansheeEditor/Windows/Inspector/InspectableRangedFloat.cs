@@ -52,7 +52,7 @@ namespace BansheeEditor
         /// <inheritdoc/>
         public override InspectableState Refresh(int layoutIndex)
         {
-            if (guiFloatField != null && !guiFloatField.HasInputFocus)
+            if (guiFloatField != null && !guiFloatField.HasInputFocus && CheckVersionChanged())
                 guiFloatField.Value = property.GetValue<float>();
 
             InspectableState oldState = state;
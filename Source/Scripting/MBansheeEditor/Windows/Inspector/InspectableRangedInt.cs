@@ -52,7 +52,7 @@ namespace BansheeEditor
         /// <inheritdoc/>
         public override InspectableState Refresh(int layoutIndex)
         {
-            if (guiIntField != null && !guiIntField.HasInputFocus)
+            if (guiIntField != null && !guiIntField.HasInputFocus && CheckVersionChanged())
                 guiIntField.Value = property.GetValue<int>();
 
             InspectableState oldState = state;
@@ -50,7 +50,7 @@ namespace BansheeEditor
         /// <inheritdoc/>
         public override InspectableState Refresh(int layoutIndex)
         {
-            if (guiField != null && !guiField.HasInputFocus)
+            if (guiField != null && !guiField.HasInputFocus && CheckVersionChanged())
                 guiField.Value = property.GetValue<Vector2>();
 
             InspectableState oldState = state;
@@ -64,6 +64,18 @@ namespace BansheeEditor
         private object inspectedObject;
         private string inspectedResourcePath;
         private SerializableProperties persistent;
+        private ulong version = 1;
+        private ulong trackedVersion;
+
+        /// <summary>
+        /// Version of the inspected object's contents, as of the last call to <see cref="UpdateVersion"/>. Inspectable
+        /// fields compare it against the version they last refreshed at, and skip reading values that couldn't have
+        /// changed.
+        /// </summary>
+        internal ulong Version
+        {
+            get { return version; }
+        }
 
         /// <summary>
         /// Common code called by both Initialize() overloads.
@@ -145,6 +157,35 @@ namespace BansheeEditor
             rootGUI.Active = visible;
         }
         
+        /// <summary>
+        /// Updates <see cref="Version"/> from the change notifications of the inspected object. Should be called once
+        /// per frame, before <see cref="Refresh"/>. Only components not modified by a running game are tracked, the
+        /// version of anything else changes every frame.
+        /// </summary>
+        internal void UpdateVersion()
+        {
+            Component component = inspectedObject as Component;
+            if (component != null && (!EditorApplication.IsPlaying || EditorApplication.IsPaused))
+            {
+                ulong newTrackedVersion = ManagedChangeTracker.GetVersion(component.InstanceId);
+                if (newTrackedVersion == trackedVersion)
+                    return;
+
+                trackedVersion = newTrackedVersion;
+            }
+
+            version++;
+        }
+
+        /// <summary>
+        /// Makes the next call to <see cref="Refresh"/> re-read all values, even if the inspected object reported no
+        /// changes. Used for modifications that bypass the change notifications.
+        /// </summary>
+        internal void ForceRefresh()
+        {
+            version++;
+        }
+
         /// <summary>
         /// Destroys all inspector GUI elements.
         /// </summary>
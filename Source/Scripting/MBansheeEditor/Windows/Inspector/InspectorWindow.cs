@@ -67,6 +67,7 @@ namespace BansheeEditor
         private SceneObject activeSO;
         private InspectableState modifyState;
         private int undoCommandIdx = -1;
+        private int forcedRefreshIdx;
         private GUITextBox soNameInput;
         private GUIToggle soActiveToggle;
         private GUIEnumField soMobility;
@@ -521,9 +522,28 @@ namespace BansheeEditor
                 {
                     RefreshSceneObjectFields(false);
 
+                    // Writes made directly by scripts aren't reported, so fully refresh one component each frame to
+                    // eventually pick them up
+                    if (inspectorComponents.Count > 0)
+                    {
+                        forcedRefreshIdx = (forcedRefreshIdx + 1) % inspectorComponents.Count;
+                        inspectorComponents[forcedRefreshIdx].inspector.ForceRefresh();
+                    }
+
                     InspectableState componentModifyState = InspectableState.NotModified;
                     for (int i = 0; i < inspectorComponents.Count; i++)
-                        componentModifyState |= inspectorComponents[i].inspector.Refresh();
+                    {
+                        Inspector inspector = inspectorComponents[i].inspector;
+                        inspector.UpdateVersion();
+
+                        InspectableState state = inspector.Refresh();
+
+                        // Some edits (e.g. reordering array elements) modify the object in place, without notifying
+                        if (state != InspectableState.NotModified)
+                            inspector.ForceRefresh();
+
+                        componentModifyState |= state;
+                    }
 
                     if (componentModifyState.HasFlag(InspectableState.ModifyInProgress))
                         EditorApplication.SetSceneDirty();
@@ -533,6 +553,7 @@ namespace BansheeEditor
             }
             else if (currentType == InspectorType.Resource)
             {
+                inspectorResource.inspector.UpdateVersion();
                 inspectorResource.inspector.Refresh();
             }
 
@@ -82,7 +82,23 @@ namespace BansheeEditor
         }
 
         /// <summary>
-        /// Registers a new resource in the library.
+        /// Checks the specified files and folders for any modifications and reimports the required resources. Performs
+        /// the same work as calling <see cref="Refresh(string)"/> for each path, with a single call into the runtime.
+        /// Folders with many changed files are checked as a whole, instead of checking each file separately.
+        /// </summary>
+        /// <param name="paths">Paths to files or folders to refresh. Relative to the project library resources folder or
+        ///                     absolute.</param>
+        public static void Refresh(string[] paths)
+        {
+            if (paths == null || paths.Length == 0)
+                return;
+
+            totalFilesToImport += Internal_RefreshMany(paths);
+        }
+
+        /// <summary>
+        /// Registers a new resource in the library. The resource is registered by the time the method returns, there is
+        /// no need to refresh the library.
         /// </summary>
         /// <param name="resource">Resource instance to add to the library. A copy of the resource will be saved at the 
         ///                        provided path.</param>
@@ -93,7 +109,8 @@ namespace BansheeEditor
         }
 
         /// <summary>
-        /// Updates a resource that is already in the library.
+        /// Updates a resource that is already in the library. The library entry is updated by the time the method
+        /// returns, there is no need to refresh the library.
         /// </summary>
         /// <param name="resource">Resource to save.</param>
         public static void Save(Resource resource)
@@ -336,6 +353,9 @@ namespace BansheeEditor
         [MethodImpl(MethodImplOptions.InternalCall)]
         private static extern int Internal_Refresh(string path, bool synchronous);
 
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern int Internal_RefreshMany(string[] paths);
+
         [MethodImpl(MethodImplOptions.InternalCall)]
         private static extern void Internal_FinalizeImports();
 
@@ -24,6 +24,7 @@ namespace BansheeEditor
         private const int ENTRY_HEIGHT = 39;
         private const int SEPARATOR_WIDTH = 3;
         private const float DETAILS_PANE_SIZE_PCT = 0.7f;
+        private const int REFRESH_PAGE_SIZE = 1000;
         private static readonly Color SEPARATOR_COLOR = new Color(33.0f / 255.0f, 33.0f / 255.0f, 33.0f / 255.0f);
         #endregion
         #region Fields
@@ -55,9 +56,14 @@ namespace BansheeEditor
         {
             ClearEntries();
 
-            LogEntry[] existingEntries = Debug.Messages;
-            for (int i = 0; i < existingEntries.Length; i++)
-                OnEntryAdded(existingEntries[i].type, existingEntries[i].message);
+            // Retrieve in pages to avoid converting the entire log at once
+            int numMessages = Debug.NumMessages;
+            for (int offset = 0; offset < numMessages; offset += REFRESH_PAGE_SIZE)
+            {
+                LogEntry[] existingEntries = Debug.GetMessages(offset, REFRESH_PAGE_SIZE);
+                for (int i = 0; i < existingEntries.Length; i++)
+                    OnEntryAdded(existingEntries[i].type, existingEntries[i].message);
+            }
         }
 
         #endregion
@@ -72,6 +78,15 @@ namespace BansheeEditor
             OpenWindow<LogWindow>();
         }
 
+        /// <summary>
+        /// Logs every resource kept in memory by pins or managed references, along with its approximate memory usage.
+        /// </summary>
+        [MenuItem("Tools/Log Resource Residency", 9248)]
+        private static void LogResourceResidency()
+        {
+            Debug.Log(ResourceRef.GetResidencyReport());
+        }
+
         /// <inheritdoc/>
         protected override LocString GetDisplayName()
         {
@@ -160,6 +175,8 @@ namespace BansheeEditor
 
             Refresh();
             Debug.OnAdded += OnEntryAdded;
+            Debug.OnAddedRepeated += OnEntryRepeated;
+            Debug.OnDropped += OnEntriesDropped;
         }
 
         private void OnEditorUpdate()
@@ -170,6 +187,8 @@ namespace BansheeEditor
         private void OnDestroy()
         {
             Debug.OnAdded -= OnEntryAdded;
+            Debug.OnAddedRepeated -= OnEntryRepeated;
+            Debug.OnDropped -= OnEntriesDropped;
         }
 
         /// <inheritdoc/>
@@ -192,6 +211,38 @@ namespace BansheeEditor
         /// <param name="type">Type of the message.</param>
         /// <param name="message">Message string.</param>
         private void OnEntryAdded(DebugMessageType type, string message)
+        {
+            AddEntry(type, message, 1);
+        }
+
+        /// <summary>
+        /// Triggered when the same entry is added in the debug log multiple times in succession.
+        /// </summary>
+        /// <param name="type">Type of the message.</param>
+        /// <param name="message">Message string.</param>
+        /// <param name="count">Number of times the message was added.</param>
+        private void OnEntryRepeated(DebugMessageType type, string message, int count)
+        {
+            AddEntry(type, message, count);
+        }
+
+        /// <summary>
+        /// Triggered when entries were added to the debug log faster than they could be reported.
+        /// </summary>
+        /// <param name="count">Number of entries that were not reported.</param>
+        private void OnEntriesDropped(int count)
+        {
+            AddEntry(DebugMessageType.Warning, count + " log messages were not displayed. Refresh the log to view them.",
+                1);
+        }
+
+        /// <summary>
+        /// Parses a debug log message and adds it to the entry list.
+        /// </summary>
+        /// <param name="type">Type of the message.</param>
+        /// <param name="message">Message string.</param>
+        /// <param name="count">Number of times the message was repeated in succession.</param>
+        private void AddEntry(DebugMessageType type, string message, int count)
         {
             // Check if compiler message or reported exception, otherwise parse it as a normal log message
             ParsedLogEntry logEntry = ScriptCodeManager.ParseCompilerMessage(message);
@@ -206,6 +257,9 @@ namespace BansheeEditor
             newEntry.callstack = logEntry.callstack;
             newEntry.message = logEntry.message;
 
+            if (count > 1)
+                newEntry.message = "(" + count + "x) " + newEntry.message;
+
             entries.Add(newEntry);
             
             if (DoesFilterMatch(type))
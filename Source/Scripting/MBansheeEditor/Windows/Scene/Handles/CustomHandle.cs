@@ -16,6 +16,9 @@ namespace BansheeEditor
     /// Implementation must contain a constructor accepting the object for the type the handle is shown for, otherwise
     /// it will not be recognized by the system. If handle is not shown for any specific type, the constructor should not
     /// accept any parameters.
+    ///
+    /// A separate handle is created for each selected component of the specified type. The handle is kept alive for as
+    /// long as its component remains selected, and is destroyed once the component is deselected.
     /// </summary>
     [AttributeUsage(AttributeTargets.Class)]
     public sealed class CustomHandle : Attribute
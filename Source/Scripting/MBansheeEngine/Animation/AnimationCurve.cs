@@ -0,0 +1,153 @@
+﻿//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+using System;
+
+namespace BansheeEngine
+{
+    /** @addtogroup Animation
+     *  @{
+     */
+
+    public partial class AnimationCurve
+    {
+        /// <summary>
+        /// Evaluates the curve at evenly spaced points, one for each element of the output array. Considerably faster than
+        /// calling <see cref="Evaluate"/> for each point, as all points are evaluated in a single native call and
+        /// keyframes are only searched for when sampling moves to a different curve segment.
+        /// </summary>
+        /// <param name="startTime">%Time of the first sample.</param>
+        /// <param name="timeStep">%Time between two consecutive samples.</param>
+        /// <param name="output">Array to write the evaluated values to. Its length determines the number of samples.
+        ///                      </param>
+        /// <param name="loop">
+        /// If true the curve will loop when it goes past the end or beggining. Otherwise the curve value will be clamped.
+        /// </param>
+        public void EvaluateRange(float startTime, float timeStep, float[] output, bool loop = true)
+        {
+            if (output == null)
+                throw new ArgumentNullException("output");
+
+            AnimationCurveSampling.Internal_EvaluateRangeFloat(mCachedPtr, startTime, timeStep, loop, output);
+        }
+
+        /// <summary>
+        /// Evaluates the curve at each of the provided times. All points are evaluated in a single native call, and
+        /// keyframe search is skipped for consecutive times in the same curve segment, so sorted times are the fastest.
+        /// </summary>
+        /// <param name="times">Times to evaluate the curve at.</param>
+        /// <param name="output">Array to write the evaluated values to. Must be at least as long as
+        ///                      <paramref name="times"/>.</param>
+        /// <param name="loop">
+        /// If true the curve will loop when it goes past the end or beggining. Otherwise the curve value will be clamped.
+        /// </param>
+        public void EvaluateMany(float[] times, float[] output, bool loop = true)
+        {
+            if (times == null)
+                throw new ArgumentNullException("times");
+
+            if (output == null)
+                throw new ArgumentNullException("output");
+
+            if (output.Length < times.Length)
+                throw new ArgumentException("Output array must be at least as long as the times array.", "output");
+
+            AnimationCurveSampling.Internal_EvaluateManyFloat(mCachedPtr, times, loop, output);
+        }
+    }
+
+    public partial class Vector3Curve
+    {
+        /// <summary>
+        /// Evaluates the curve at evenly spaced points, one for each element of the output array. Considerably faster than
+        /// calling <see cref="Evaluate"/> for each point, as all points are evaluated in a single native call and
+        /// keyframes are only searched for when sampling moves to a different curve segment.
+        /// </summary>
+        /// <param name="startTime">%Time of the first sample.</param>
+        /// <param name="timeStep">%Time between two consecutive samples.</param>
+        /// <param name="output">Array to write the evaluated values to. Its length determines the number of samples.
+        ///                      </param>
+        /// <param name="loop">
+        /// If true the curve will loop when it goes past the end or beggining. Otherwise the curve value will be clamped.
+        /// </param>
+        public void EvaluateRange(float startTime, float timeStep, Vector3[] output, bool loop = true)
+        {
+            if (output == null)
+                throw new ArgumentNullException("output");
+
+            AnimationCurveSampling.Internal_EvaluateRangeVector3(mCachedPtr, startTime, timeStep, loop, output);
+        }
+
+        /// <summary>
+        /// Evaluates the curve at each of the provided times. All points are evaluated in a single native call, and
+        /// keyframe search is skipped for consecutive times in the same curve segment, so sorted times are the fastest.
+        /// </summary>
+        /// <param name="times">Times to evaluate the curve at.</param>
+        /// <param name="output">Array to write the evaluated values to. Must be at least as long as
+        ///                      <paramref name="times"/>.</param>
+        /// <param name="loop">
+        /// If true the curve will loop when it goes past the end or beggining. Otherwise the curve value will be clamped.
+        /// </param>
+        public void EvaluateMany(float[] times, Vector3[] output, bool loop = true)
+        {
+            if (times == null)
+                throw new ArgumentNullException("times");
+
+            if (output == null)
+                throw new ArgumentNullException("output");
+
+            if (output.Length < times.Length)
+                throw new ArgumentException("Output array must be at least as long as the times array.", "output");
+
+            AnimationCurveSampling.Internal_EvaluateManyVector3(mCachedPtr, times, loop, output);
+        }
+    }
+
+    public partial class QuaternionCurve
+    {
+        /// <summary>
+        /// Evaluates the curve at evenly spaced points, one for each element of the output array. Considerably faster than
+        /// calling <see cref="Evaluate"/> for each point, as all points are evaluated in a single native call and
+        /// keyframes are only searched for when sampling moves to a different curve segment.
+        /// </summary>
+        /// <param name="startTime">%Time of the first sample.</param>
+        /// <param name="timeStep">%Time between two consecutive samples.</param>
+        /// <param name="output">Array to write the evaluated values to. Its length determines the number of samples.
+        ///                      </param>
+        /// <param name="loop">
+        /// If true the curve will loop when it goes past the end or beggining. Otherwise the curve value will be clamped.
+        /// </param>
+        public void EvaluateRange(float startTime, float timeStep, Quaternion[] output, bool loop = true)
+        {
+            if (output == null)
+                throw new ArgumentNullException("output");
+
+            AnimationCurveSampling.Internal_EvaluateRangeQuaternion(mCachedPtr, startTime, timeStep, loop, output);
+        }
+
+        /// <summary>
+        /// Evaluates the curve at each of the provided times. All points are evaluated in a single native call, and
+        /// keyframe search is skipped for consecutive times in the same curve segment, so sorted times are the fastest.
+        /// </summary>
+        /// <param name="times">Times to evaluate the curve at.</param>
+        /// <param name="output">Array to write the evaluated values to. Must be at least as long as
+        ///                      <paramref name="times"/>.</param>
+        /// <param name="loop">
+        /// If true the curve will loop when it goes past the end or beggining. Otherwise the curve value will be clamped.
+        /// </param>
+        public void EvaluateMany(float[] times, Quaternion[] output, bool loop = true)
+        {
+            if (times == null)
+                throw new ArgumentNullException("times");
+
+            if (output == null)
+                throw new ArgumentNullException("output");
+
+            if (output.Length < times.Length)
+                throw new ArgumentException("Output array must be at least as long as the times array.", "output");
+
+            AnimationCurveSampling.Internal_EvaluateManyQuaternion(mCachedPtr, times, loop, output);
+        }
+    }
+
+    /** @} */
+}
@@ -0,0 +1,41 @@
+﻿//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+using System;
+using System.Runtime.CompilerServices;
+
+namespace BansheeEngine
+{
+    /** @cond INTEROP */
+
+    /// <summary>
+    /// Evaluates native animation curves at many points in a single call. Results are written straight into the provided
+    /// managed arrays, avoiding a native call and a marshalled return value per sample.
+    /// </summary>
+    internal static class AnimationCurveSampling
+    {
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        internal static extern bool Internal_EvaluateRangeFloat(IntPtr thisPtr, float start, float step, bool loop,
+            float[] output);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        internal static extern bool Internal_EvaluateRangeVector3(IntPtr thisPtr, float start, float step, bool loop,
+            Vector3[] output);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        internal static extern bool Internal_EvaluateRangeQuaternion(IntPtr thisPtr, float start, float step, bool loop,
+            Quaternion[] output);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        internal static extern bool Internal_EvaluateManyFloat(IntPtr thisPtr, float[] times, bool loop, float[] output);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        internal static extern bool Internal_EvaluateManyVector3(IntPtr thisPtr, float[] times, bool loop,
+            Vector3[] output);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        internal static extern bool Internal_EvaluateManyQuaternion(IntPtr thisPtr, float[] times, bool loop,
+            Quaternion[] output);
+    }
+
+    /** @endcond */
+}
@@ -0,0 +1,42 @@
+﻿//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+using System;
+using System.Runtime.CompilerServices;
+
+namespace BansheeEngine
+{
+    /** @cond INTEROP */
+
+    /// <summary>
+    /// Provides direct access to native <see cref="MeshData"/> vertex and index streams. Data is copied straight from/to
+    /// the provided managed arrays without any intermediate allocations.
+    /// </summary>
+    internal static class MeshDataStreams
+    {
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        internal static extern bool Internal_ReadElements(IntPtr thisPtr, VertexLayout type, Array buffer);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        internal static extern bool Internal_WriteElements(IntPtr thisPtr, VertexLayout type, Array buffer);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        internal static extern bool Internal_ReadIndices(IntPtr thisPtr, uint[] buffer);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        internal static extern bool Internal_WriteIndices(IntPtr thisPtr, uint[] buffer);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        internal static extern bool Internal_ReadVertexStream(IntPtr thisPtr, byte[] buffer);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        internal static extern bool Internal_WriteVertexStream(IntPtr thisPtr, byte[] buffer);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        internal static extern int Internal_GetVertexStride(IntPtr thisPtr);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        internal static extern int Internal_GetElementOffset(IntPtr thisPtr, VertexLayout type);
+    }
+
+    /** @endcond */
+}
@@ -0,0 +1,64 @@
+﻿//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+using System;
+using System.Runtime.CompilerServices;
+
+namespace BansheeEngine
+{
+    /** @cond INTEROP */
+
+    /// <summary>
+    /// Provides direct access to native <see cref="PixelData"/> and <see cref="Texture"/> pixels. Data is copied straight
+    /// from/to the provided managed arrays without any intermediate allocations.
+    /// </summary>
+    internal static class PixelDataAccess
+    {
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        internal static extern bool Internal_ReadRawPixels(IntPtr thisPtr, byte[] buffer);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        internal static extern bool Internal_WriteRawPixels(IntPtr thisPtr, byte[] buffer);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        internal static extern bool Internal_ReadColors(IntPtr thisPtr, Color[] buffer);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        internal static extern bool Internal_WriteColors(IntPtr thisPtr, Color[] buffer);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        internal static extern int Internal_GetRowSize(IntPtr thisPtr);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        internal static extern bool Internal_Lock(IntPtr thisPtr);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        internal static extern void Internal_Unlock(IntPtr thisPtr);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        internal static extern IntPtr Internal_GetLockedRowData(IntPtr thisPtr, int y, int z);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        internal static extern bool Internal_ReadRow(IntPtr thisPtr, int y, int z, byte[] buffer);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        internal static extern bool Internal_WriteRow(IntPtr thisPtr, int y, int z, byte[] buffer);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        internal static extern bool Internal_ReadRowColors(IntPtr thisPtr, int y, int z, Color[] buffer);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        internal static extern bool Internal_WriteRowColors(IntPtr thisPtr, int y, int z, Color[] buffer);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        internal static extern bool Internal_ReadTextureCachedPixels(IntPtr thisPtr, byte[] buffer, uint face, 
+            uint mipLevel);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        internal static extern bool Internal_WriteTextureRawPixels(IntPtr thisPtr, byte[] buffer, uint face, uint mipLevel);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        internal static extern bool Internal_WriteTextureColors(IntPtr thisPtr, Color[] buffer, uint face, uint mipLevel);
+    }
+
+    /** @endcond */
+}
@@ -0,0 +1,247 @@
+﻿//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+using System;
+
+namespace BansheeEngine
+{
+    /** @addtogroup Rendering
+     *  @{
+     */
+
+    public partial class MeshData
+    {
+        /// <summary>
+        /// Size of a single vertex in the interleaved vertex stream, in bytes. See <see cref="GetVertexData"/>.
+        /// </summary>
+        public int VertexStride
+        {
+            get { return MeshDataStreams.Internal_GetVertexStride(mCachedPtr); }
+        }
+
+        /// <summary>
+        /// Returns the offset of a vertex element from the start of a vertex in the interleaved vertex stream. See
+        /// <see cref="GetVertexData"/>.
+        /// </summary>
+        /// <param name="type">Type of the element to look up. Must be a single element type (not a combination).</param>
+        /// <returns>Offset in bytes, or -1 if the vertex layout doesn't contain the element. For bone weights this is
+        ///          the offset of the bone indices, followed by the weights.</returns>
+        public int GetElementOffset(VertexLayout type)
+        {
+            return MeshDataStreams.Internal_GetElementOffset(mCachedPtr, type);
+        }
+
+        /// <summary>
+        /// Copies all vertex positions into the provided buffer. Unlike <see cref="Positions"/> this doesn't allocate,
+        /// allowing the same buffer to be re-used.
+        /// </summary>
+        /// <param name="buffer">Buffer to receive the data. Must be able to hold <see cref="VertexCount"/> elements.
+        ///                      </param>
+        /// <returns>True if the data was copied, false if the layout doesn't contain positions or the buffer is too
+        ///          small.</returns>
+        public bool GetPositions(Vector3[] buffer)
+        {
+            return MeshDataStreams.Internal_ReadElements(mCachedPtr, VertexLayout.Position, buffer);
+        }
+
+        /// <summary>
+        /// Copies vertex positions from the provided buffer. Unlike <see cref="Positions"/> this doesn't allocate.
+        /// </summary>
+        /// <param name="buffer">Buffer containing at least <see cref="VertexCount"/> elements.</param>
+        /// <returns>True if the data was copied, false if the layout doesn't contain positions or the buffer is too
+        ///          small.</returns>
+        public bool SetPositions(Vector3[] buffer)
+        {
+            return MeshDataStreams.Internal_WriteElements(mCachedPtr, VertexLayout.Position, buffer);
+        }
+
+        /// <summary>
+        /// Copies all vertex normals into the provided buffer. Unlike <see cref="Normals"/> this doesn't allocate.
+        /// </summary>
+        /// <param name="buffer">Buffer to receive the data. Must be able to hold <see cref="VertexCount"/> elements.
+        ///                      </param>
+        /// <returns>True if the data was copied, false if the layout doesn't contain normals or the buffer is too
+        ///          small.</returns>
+        public bool GetNormals(Vector3[] buffer)
+        {
+            return MeshDataStreams.Internal_ReadElements(mCachedPtr, VertexLayout.Normal, buffer);
+        }
+
+        /// <summary>
+        /// Copies vertex normals from the provided buffer. Unlike <see cref="Normals"/> this doesn't allocate.
+        /// </summary>
+        /// <param name="buffer">Buffer containing at least <see cref="VertexCount"/> elements.</param>
+        /// <returns>True if the data was copied, false if the layout doesn't contain normals or the buffer is too
+        ///          small.</returns>
+        public bool SetNormals(Vector3[] buffer)
+        {
+            return MeshDataStreams.Internal_WriteElements(mCachedPtr, VertexLayout.Normal, buffer);
+        }
+
+        /// <summary>
+        /// Copies all vertex tangents into the provided buffer. Unlike <see cref="Tangents"/> this doesn't allocate.
+        /// </summary>
+        /// <param name="buffer">Buffer to receive the data. Must be able to hold <see cref="VertexCount"/> elements.
+        ///                      </param>
+        /// <returns>True if the data was copied, false if the layout doesn't contain tangents or the buffer is too
+        ///          small.</returns>
+        public bool GetTangents(Vector4[] buffer)
+        {
+            return MeshDataStreams.Internal_ReadElements(mCachedPtr, VertexLayout.Tangent, buffer);
+        }
+
+        /// <summary>
+        /// Copies vertex tangents from the provided buffer. Unlike <see cref="Tangents"/> this doesn't allocate.
+        /// </summary>
+        /// <param name="buffer">Buffer containing at least <see cref="VertexCount"/> elements.</param>
+        /// <returns>True if the data was copied, false if the layout doesn't contain tangents or the buffer is too
+        ///          small.</returns>
+        public bool SetTangents(Vector4[] buffer)
+        {
+            return MeshDataStreams.Internal_WriteElements(mCachedPtr, VertexLayout.Tangent, buffer);
+        }
+
+        /// <summary>
+        /// Copies all vertex colors into the provided buffer. Unlike <see cref="Colors"/> this doesn't allocate.
+        /// </summary>
+        /// <param name="buffer">Buffer to receive the data. Must be able to hold <see cref="VertexCount"/> elements.
+        ///                      </param>
+        /// <returns>True if the data was copied, false if the layout doesn't contain colors or the buffer is too
+        ///          small.</returns>
+        public bool GetColors(Color[] buffer)
+        {
+            return MeshDataStreams.Internal_ReadElements(mCachedPtr, VertexLayout.Color, buffer);
+        }
+
+        /// <summary>
+        /// Copies vertex colors from the provided buffer. Unlike <see cref="Colors"/> this doesn't allocate.
+        /// </summary>
+        /// <param name="buffer">Buffer containing at least <see cref="VertexCount"/> elements.</param>
+        /// <returns>True if the data was copied, false if the layout doesn't contain colors or the buffer is too
+        ///          small.</returns>
+        public bool SetColors(Color[] buffer)
+        {
+            return MeshDataStreams.Internal_WriteElements(mCachedPtr, VertexLayout.Color, buffer);
+        }
+
+        /// <summary>
+        /// Copies all texture coordinates in the UV0 channel into the provided buffer. Unlike <see cref="UV0"/> this
+        /// doesn't allocate.
+        /// </summary>
+        /// <param name="buffer">Buffer to receive the data. Must be able to hold <see cref="VertexCount"/> elements.
+        ///                      </param>
+        /// <returns>True if the data was copied, false if the layout doesn't contain UV0 coordinates or the buffer is
+        ///          too small.</returns>
+        public bool GetUV0(Vector2[] buffer)
+        {
+            return MeshDataStreams.Internal_ReadElements(mCachedPtr, VertexLayout.UV0, buffer);
+        }
+
+        /// <summary>
+        /// Copies texture coordinates in the UV0 channel from the provided buffer. Unlike <see cref="UV0"/> this doesn't
+        /// allocate.
+        /// </summary>
+        /// <param name="buffer">Buffer containing at least <see cref="VertexCount"/> elements.</param>
+        /// <returns>True if the data was copied, false if the layout doesn't contain UV0 coordinates or the buffer is
+        ///          too small.</returns>
+        public bool SetUV0(Vector2[] buffer)
+        {
+            return MeshDataStreams.Internal_WriteElements(mCachedPtr, VertexLayout.UV0, buffer);
+        }
+
+        /// <summary>
+        /// Copies all texture coordinates in the UV1 channel into the provided buffer. Unlike <see cref="UV1"/> this
+        /// doesn't allocate.
+        /// </summary>
+        /// <param name="buffer">Buffer to receive the data. Must be able to hold <see cref="VertexCount"/> elements.
+        ///                      </param>
+        /// <returns>True if the data was copied, false if the layout doesn't contain UV1 coordinates or the buffer is
+        ///          too small.</returns>
+        public bool GetUV1(Vector2[] buffer)
+        {
+            return MeshDataStreams.Internal_ReadElements(mCachedPtr, VertexLayout.UV1, buffer);
+        }
+
+        /// <summary>
+        /// Copies texture coordinates in the UV1 channel from the provided buffer. Unlike <see cref="UV1"/> this doesn't
+        /// allocate.
+        /// </summary>
+        /// <param name="buffer">Buffer containing at least <see cref="VertexCount"/> elements.</param>
+        /// <returns>True if the data was copied, false if the layout doesn't contain UV1 coordinates or the buffer is
+        ///          too small.</returns>
+        public bool SetUV1(Vector2[] buffer)
+        {
+            return MeshDataStreams.Internal_WriteElements(mCachedPtr, VertexLayout.UV1, buffer);
+        }
+
+        /// <summary>
+        /// Copies all bone weights into the provided buffer. Unlike <see cref="BoneWeights"/> this doesn't allocate.
+        /// </summary>
+        /// <param name="buffer">Buffer to receive the data. Must be able to hold <see cref="VertexCount"/> elements.
+        ///                      </param>
+        /// <returns>True if the data was copied, false if the layout doesn't contain bone weights or the buffer is too
+        ///          small.</returns>
+        public bool GetBoneWeights(BoneWeight[] buffer)
+        {
+            return MeshDataStreams.Internal_ReadElements(mCachedPtr, VertexLayout.BoneWeights, buffer);
+        }
+
+        /// <summary>
+        /// Copies bone weights from the provided buffer. Unlike <see cref="BoneWeights"/> this doesn't allocate.
+        /// </summary>
+        /// <param name="buffer">Buffer containing at least <see cref="VertexCount"/> elements.</param>
+        /// <returns>True if the data was copied, false if the layout doesn't contain bone weights or the buffer is too
+        ///          small.</returns>
+        public bool SetBoneWeights(BoneWeight[] buffer)
+        {
+            return MeshDataStreams.Internal_WriteElements(mCachedPtr, VertexLayout.BoneWeights, buffer);
+        }
+
+        /// <summary>
+        /// Copies all indices into the provided buffer. Unlike <see cref="Indices"/> this doesn't allocate.
+        /// </summary>
+        /// <param name="buffer">Buffer to receive the data. Must be able to hold <see cref="IndexCount"/> elements.
+        ///                      </param>
+        /// <returns>True if the data was copied, false if the buffer is too small.</returns>
+        public bool GetIndices(uint[] buffer)
+        {
+            return MeshDataStreams.Internal_ReadIndices(mCachedPtr, buffer);
+        }
+
+        /// <summary>
+        /// Copies indices from the provided buffer. Unlike <see cref="Indices"/> this doesn't allocate.
+        /// </summary>
+        /// <param name="buffer">Buffer containing at least <see cref="IndexCount"/> elements.</param>
+        /// <returns>True if the data was copied, false if the buffer is too small.</returns>
+        public bool SetIndices(uint[] buffer)
+        {
+            return MeshDataStreams.Internal_WriteIndices(mCachedPtr, buffer);
+        }
+
+        /// <summary>
+        /// Copies the entire interleaved vertex stream into the provided buffer using a single copy. Each vertex
+        /// occupies <see cref="VertexStride"/> bytes, and individual elements are located using 
+        /// <see cref="GetElementOffset"/>. Colors are stored as 32-bit RGBA values.
+        /// </summary>
+        /// <param name="buffer">Buffer to receive the data. Must be able to hold <see cref="VertexCount"/> * 
+        ///                      <see cref="VertexStride"/> bytes.</param>
+        /// <returns>True if the data was copied, false if the buffer is too small.</returns>
+        public bool GetVertexData(byte[] buffer)
+        {
+            return MeshDataStreams.Internal_ReadVertexStream(mCachedPtr, buffer);
+        }
+
+        /// <summary>
+        /// Copies the entire interleaved vertex stream from the provided buffer using a single copy. Data must be laid
+        /// out as described in <see cref="GetVertexData"/>.
+        /// </summary>
+        /// <param name="buffer">Buffer containing at least <see cref="VertexCount"/> * <see cref="VertexStride"/> 
+        ///                      bytes.</param>
+        /// <returns>True if the data was copied, false if the buffer is too small.</returns>
+        public bool SetVertexData(byte[] buffer)
+        {
+            return MeshDataStreams.Internal_WriteVertexStream(mCachedPtr, buffer);
+        }
+    }
+
+    /** @} */
+}
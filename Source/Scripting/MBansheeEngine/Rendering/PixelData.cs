@@ -0,0 +1,216 @@
+﻿//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+using System;
+
+namespace BansheeEngine
+{
+    /** @addtogroup Rendering
+     *  @{
+     */
+
+    public partial class PixelData
+    {
+        /// <summary>
+        /// True while a <see cref="PixelDataLock"/> created through <see cref="Lock"/> is held on the pixel data.
+        /// </summary>
+        internal bool isLocked;
+
+        /// <summary>
+        /// Releases a lock that was never disposed, so the native pixel data doesn't remain locked for other objects
+        /// sharing it.
+        /// </summary>
+        ~PixelData()
+        {
+            if (!isLocked)
+                return;
+
+            Debug.LogError("Pixel data is being destroyed while locked. Dispose of the lock returned by " +
+                "PixelData.Lock() once done with it.");
+
+            PixelDataAccess.Internal_Unlock(mCachedPtr);
+        }
+
+        /// <summary>
+        /// Size of a single row of pixels in bytes, without any padding. Zero for compressed pixel formats.
+        /// </summary>
+        public int RowSize
+        {
+            get { return PixelDataAccess.Internal_GetRowSize(mCachedPtr); }
+        }
+
+        /// <summary>
+        /// Copies all pixels into the provided buffer, converting them to colors. Unlike <see cref="GetPixels()"/> this
+        /// doesn't allocate, allowing the same buffer to be re-used. 8-bit RGBA and BGRA formats use a fast conversion
+        /// path.
+        /// </summary>
+        /// <param name="buffer">Buffer to receive the pixels. Must be able to hold width * height * depth elements.
+        ///                      Pixels are stored as a succession of "depth" slices, each containing "height" rows of
+        ///                      "width" pixels.</param>
+        /// <returns>True if the data was copied, false if the buffer is too small, the format is compressed or the
+        ///          pixel data is locked.</returns>
+        public bool ReadPixels(Color[] buffer)
+        {
+            return PixelDataAccess.Internal_ReadColors(mCachedPtr, buffer);
+        }
+
+        /// <summary>
+        /// Sets all pixels from the provided buffer, converting them to the pixel format. Unlike 
+        /// <see cref="SetPixels"/> this doesn't make an intermediate copy of the colors.
+        /// </summary>
+        /// <param name="buffer">Buffer containing at least width * height * depth elements, laid out the same as in
+        ///                      <see cref="ReadPixels"/>.</param>
+        /// <returns>True if the data was copied, false if the buffer is too small, the format is compressed or the
+        ///          pixel data is locked.</returns>
+        public bool WritePixels(Color[] buffer)
+        {
+            return PixelDataAccess.Internal_WriteColors(mCachedPtr, buffer);
+        }
+
+        /// <summary>
+        /// Copies the raw pixel buffer into the provided array, using a single copy. It is up to the caller to interpret
+        /// the pixel format and account for the row and slice pitch.
+        /// </summary>
+        /// <param name="buffer">Buffer to receive the data. Must be able to hold <see cref="RawSize"/> bytes.</param>
+        /// <returns>True if the data was copied, false if the buffer is too small or the pixel data is locked.</returns>
+        public bool ReadRawPixels(byte[] buffer)
+        {
+            return PixelDataAccess.Internal_ReadRawPixels(mCachedPtr, buffer);
+        }
+
+        /// <summary>
+        /// Copies the raw pixel buffer from the provided array, using a single copy.
+        /// </summary>
+        /// <param name="buffer">Buffer containing at least <see cref="RawSize"/> bytes, in the same layout as returned
+        ///                      by <see cref="ReadRawPixels"/>.</param>
+        /// <returns>True if the data was copied, false if the buffer is too small or the pixel data is locked.</returns>
+        public bool WriteRawPixels(byte[] buffer)
+        {
+            return PixelDataAccess.Internal_WriteRawPixels(mCachedPtr, buffer);
+        }
+
+        /// <summary>
+        /// Copies a single row of raw pixels into the provided array.
+        /// </summary>
+        /// <param name="y">Index of the row.</param>
+        /// <param name="z">Index of the depth slice containing the row.</param>
+        /// <param name="buffer">Buffer to receive the data. Must be able to hold <see cref="RowSize"/> bytes.</param>
+        /// <returns>True if the data was copied, false if the row is out of range, the buffer is too small, the format
+        ///          is compressed or the pixel data is locked.</returns>
+        public bool ReadRow(int y, int z, byte[] buffer)
+        {
+            return PixelDataAccess.Internal_ReadRow(mCachedPtr, y, z, buffer);
+        }
+
+        /// <summary>
+        /// Copies a single row of raw pixels from the provided array.
+        /// </summary>
+        /// <param name="y">Index of the row.</param>
+        /// <param name="z">Index of the depth slice containing the row.</param>
+        /// <param name="buffer">Buffer containing at least <see cref="RowSize"/> bytes.</param>
+        /// <returns>True if the data was copied, false if the row is out of range, the buffer is too small, the format
+        ///          is compressed or the pixel data is locked.</returns>
+        public bool WriteRow(int y, int z, byte[] buffer)
+        {
+            return PixelDataAccess.Internal_WriteRow(mCachedPtr, y, z, buffer);
+        }
+
+        /// <summary>
+        /// Copies a single row of pixels into the provided array, converting them to colors.
+        /// </summary>
+        /// <param name="y">Index of the row.</param>
+        /// <param name="z">Index of the depth slice containing the row.</param>
+        /// <param name="buffer">Buffer to receive the pixels. Must be able to hold a row of pixels.</param>
+        /// <returns>True if the data was copied, false if the row is out of range, the buffer is too small, the format
+        ///          is compressed or the pixel data is locked.</returns>
+        public bool ReadRow(int y, int z, Color[] buffer)
+        {
+            return PixelDataAccess.Internal_ReadRowColors(mCachedPtr, y, z, buffer);
+        }
+
+        /// <summary>
+        /// Sets a single row of pixels from the provided array, converting them to the pixel format.
+        /// </summary>
+        /// <param name="y">Index of the row.</param>
+        /// <param name="z">Index of the depth slice containing the row.</param>
+        /// <param name="buffer">Buffer containing at least a row of pixels.</param>
+        /// <returns>True if the data was copied, false if the row is out of range, the buffer is too small, the format
+        ///          is compressed or the pixel data is locked.</returns>
+        public bool WriteRow(int y, int z, Color[] buffer)
+        {
+            return PixelDataAccess.Internal_WriteRowColors(mCachedPtr, y, z, buffer);
+        }
+
+        /// <summary>
+        /// Locks the pixel data and provides direct access to its native memory, without copying. While the lock is held
+        /// all other reads and writes of the pixel data fail, including those performed by texture operations. The lock
+        /// must be disposed in order to release it.
+        /// </summary>
+        /// <returns>Object providing pointers to individual rows of the pixel buffer.</returns>
+        /// <exception cref="InvalidOperationException">Thrown if the pixel data is already locked.</exception>
+        public PixelDataLock Lock()
+        {
+            return new PixelDataLock(this);
+        }
+    }
+
+    /// <summary>
+    /// Holds a lock on a <see cref="PixelData"/> object and provides direct access to its native memory. Row pointers can
+    /// be used with <see cref="System.Runtime.InteropServices.Marshal"/> to read and write pixels without intermediate
+    /// copies. Returned pointers are only valid until the lock is disposed. A lock that is never disposed is only
+    /// released, with an error, once its pixel data is destroyed.
+    /// </summary>
+    public sealed class PixelDataLock : IDisposable
+    {
+        private PixelData pixelData;
+
+        /// <summary>
+        /// Size of a single row of pixels in bytes, without any padding.
+        /// </summary>
+        public int RowSize { get; private set; }
+
+        /// <summary>
+        /// Locks the provided pixel data.
+        /// </summary>
+        /// <param name="pixelData">Pixel data to lock.</param>
+        internal PixelDataLock(PixelData pixelData)
+        {
+            RowSize = pixelData.RowSize;
+
+            if (!PixelDataAccess.Internal_Lock(pixelData.mCachedPtr))
+                throw new InvalidOperationException("Pixel data is already locked.");
+
+            pixelData.isLocked = true;
+            this.pixelData = pixelData;
+        }
+
+        /// <summary>
+        /// Returns a pointer to the first pixel of the specified row. The row contains <see cref="RowSize"/> bytes in
+        /// the format of the pixel data.
+        /// </summary>
+        /// <param name="y">Index of the row.</param>
+        /// <param name="z">Index of the depth slice containing the row.</param>
+        /// <returns>Pointer to the row, or zero if the row is out of range or the format is compressed.</returns>
+        public IntPtr GetRow(int y, int z = 0)
+        {
+            if (pixelData == null)
+                throw new ObjectDisposedException("PixelDataLock");
+
+            return PixelDataAccess.Internal_GetLockedRowData(pixelData.mCachedPtr, y, z);
+        }
+
+        /// <summary>
+        /// Releases the lock. Any pointers previously returned by <see cref="GetRow"/> are no longer valid.
+        /// </summary>
+        public void Dispose()
+        {
+            if (pixelData == null)
+                return;
+
+            PixelDataAccess.Internal_Unlock(pixelData.mCachedPtr);
+            pixelData.isLocked = false;
+            pixelData = null;
+        }
+    }
+
+    /** @} */
+}
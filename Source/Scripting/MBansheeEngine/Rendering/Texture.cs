@@ -75,6 +75,52 @@ namespace BansheeEngine
 
             return texture;
         }
+
+        /// <summary>
+        /// Reads the CPU cached pixels of the specified mip level and face straight into the provided buffer, without
+        /// allocating a <see cref="PixelData"/> object. The texture has to be created with 
+        /// <see cref="TextureUsage.CPUCached"/>.
+        /// </summary>
+        /// <param name="buffer">Buffer to receive the raw pixels in the texture pixel format. Rows and slices are stored
+        ///                      consecutively, without padding.</param>
+        /// <param name="face">Face to read the pixels from.</param>
+        /// <param name="mipLevel">Mip level to read the pixels from. Top level (0) is the highest quality.</param>
+        /// <returns>True if the data was copied, false if the buffer is too small or the texture isn't CPU cached.
+        ///          </returns>
+        public bool ReadCachedPixels(byte[] buffer, uint face = 0, uint mipLevel = 0)
+        {
+            return PixelDataAccess.Internal_ReadTextureCachedPixels(mCachedPtr, buffer, face, mipLevel);
+        }
+
+        /// <summary>
+        /// Sets raw pixels for the specified mip level and face. The data is copied once, into the buffer used for the
+        /// GPU upload.
+        /// </summary>
+        /// <param name="buffer">Raw pixels in the texture pixel format. Rows and slices must be stored consecutively,
+        ///                      without padding.</param>
+        /// <param name="face">Face to write the pixels to.</param>
+        /// <param name="mipLevel">Mip level to write the pixels to. Top level (0) is the highest quality.</param>
+        /// <returns>True if the data was written, false if the buffer is too small for the mip level.</returns>
+        public bool WriteRawPixels(byte[] buffer, uint face = 0, uint mipLevel = 0)
+        {
+            return PixelDataAccess.Internal_WriteTextureRawPixels(mCachedPtr, buffer, face, mipLevel);
+        }
+
+        /// <summary>
+        /// Sets pixels for the specified mip level and face, converting the colors directly into the texture pixel 
+        /// format. Unlike <see cref="SetPixels(Color[], uint, uint)"/> the colors aren't copied into an intermediate
+        /// array first.
+        /// </summary>
+        /// <param name="colors">Pixels to write, laid out row by row. Must contain at least as many pixels as the mip
+        ///                      level.</param>
+        /// <param name="face">Face to write the pixels to.</param>
+        /// <param name="mipLevel">Mip level to write the pixels to. Top level (0) is the highest quality.</param>
+        /// <returns>True if the data was written, false if there are not enough colors for the mip level, or the pixel
+        ///          format is compressed.</returns>
+        public bool WritePixels(Color[] colors, uint face = 0, uint mipLevel = 0)
+        {
+            return PixelDataAccess.Internal_WriteTextureColors(mCachedPtr, colors, face, mipLevel);
+        }
     }
 
     /// <summary>
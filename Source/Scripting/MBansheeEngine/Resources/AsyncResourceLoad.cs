@@ -0,0 +1,125 @@
+﻿//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+using System;
+using System.Collections.Generic;
+using System.Runtime.CompilerServices;
+
+namespace BansheeEngine
+{
+    /** @addtogroup Resources
+     *  @{
+     */
+
+    /// <summary>
+    /// Represents a batch of resources being loaded asynchronously, started by
+    /// <see cref="Resources.LoadAsync(ResourceRef[], bool)"/>. Resources are loaded on worker threads, while completion
+    /// is always reported on the main thread, either by polling <see cref="IsComplete"/> or through the
+    /// <see cref="OnCompleted"/> event.
+    ///
+    /// Resources loaded without the "keepLoaded" parameter stay loaded at least as long as this object is referenced.
+    /// </summary>
+    public sealed class AsyncResourceLoad : ScriptObject
+    {
+        /// <summary>
+        /// Keeps loads in progress from being collected before their completion event triggers.
+        /// </summary>
+        private static HashSet<AsyncResourceLoad> pendingLoads = new HashSet<AsyncResourceLoad>();
+
+        /// <summary>
+        /// Triggered on the main thread once all the resources in the batch have finished loading. Triggered only once.
+        /// </summary>
+        public event Action<AsyncResourceLoad> OnCompleted;
+
+        /// <summary>
+        /// Starts loading the resources referenced by the provided references.
+        /// </summary>
+        /// <param name="references">References to the resources to load. Null entries are allowed.</param>
+        /// <param name="keepLoaded">If true the system will keep the resources loaded even when they go out of scope.
+        ///                          </param>
+        internal AsyncResourceLoad(ResourceRef[] references, bool keepLoaded)
+        {
+            Internal_CreateInstance(this, references, keepLoaded);
+            pendingLoads.Add(this);
+        }
+
+        /// <summary>
+        /// Checks have all the resources finished loading, and the completion event been triggered.
+        /// </summary>
+        public bool IsComplete
+        {
+            get { return Internal_IsComplete(mCachedPtr); }
+        }
+
+        /// <summary>
+        /// Percentage of the resources that have finished loading, in [0, 1] range.
+        /// </summary>
+        public float Progress
+        {
+            get { return Internal_GetProgress(mCachedPtr); }
+        }
+
+        /// <summary>
+        /// Number of resources in the batch.
+        /// </summary>
+        public int Count
+        {
+            get { return (int)Internal_GetCount(mCachedPtr); }
+        }
+
+        /// <summary>
+        /// Returns one of the loaded resources.
+        /// </summary>
+        /// <typeparam name="T">Type of the resource.</typeparam>
+        /// <param name="index">Index of the resource, in the same order as the references provided when starting the
+        ///                     load.</param>
+        /// <returns>Loaded resource, or null if the resource hasn't finished loading or cannot be found.</returns>
+        public T GetResource<T>(int index) where T : Resource
+        {
+            if (index < 0)
+                return null;
+
+            return Internal_GetResource(mCachedPtr, (uint)index) as T;
+        }
+
+        /// <summary>
+        /// Blocks the calling thread until all the resources have finished loading. The completion event is triggered
+        /// before this method returns, if it wasn't triggered already.
+        /// </summary>
+        public void BlockUntilComplete()
+        {
+            Internal_BlockUntilComplete(mCachedPtr);
+        }
+
+        /// <summary>
+        /// Triggered by the runtime when all the resources have finished loading.
+        /// </summary>
+        private void Internal_OnCompleted()
+        {
+            pendingLoads.Remove(this);
+
+            if (OnCompleted != null)
+                OnCompleted(this);
+        }
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_CreateInstance(AsyncResourceLoad instance, ResourceRef[] references,
+            bool keepLoaded);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern bool Internal_IsComplete(IntPtr thisPtr);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern float Internal_GetProgress(IntPtr thisPtr);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern uint Internal_GetCount(IntPtr thisPtr);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern Resource Internal_GetResource(IntPtr thisPtr, uint index);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_BlockUntilComplete(IntPtr thisPtr);
+    }
+
+    /** @} */
+}
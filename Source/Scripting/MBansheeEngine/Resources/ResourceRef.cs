@@ -28,6 +28,74 @@ namespace BansheeEngine
             get { return Internal_IsLoaded(mCachedPtr); }
         }
 
+        /// <summary>
+        /// Approximate amount of memory used by the referenced resource, in bytes. Only textures and meshes are
+        /// accounted for. Zero if the resource isn't loaded.
+        /// </summary>
+        public long MemoryUsage
+        {
+            get { return (long)Internal_GetMemoryUsage(mCachedPtr); }
+        }
+
+        /// <summary>
+        /// Checks has the referenced resource been pinned using <see cref="Pin"/>.
+        /// </summary>
+        public bool IsPinned
+        {
+            get { return Internal_IsPinned(mCachedPtr); }
+        }
+
+        /// <summary>
+        /// Keeps the referenced resource loaded until <see cref="Unpin"/> is called with the same reason. If the
+        /// resource isn't loaded, a load is started in the background, allowing resources to be preloaded before they
+        /// are needed. A resource can be pinned multiple times with different reasons, and stays loaded until all the
+        /// pins are removed. All pins are removed when the script assemblies are reloaded.
+        /// </summary>
+        /// <param name="reason">Description of why the resource needs to stay loaded. Displayed in the report returned
+        ///                      by <see cref="GetResidencyReport"/>.</param>
+        public void Pin(string reason)
+        {
+            Internal_Pin(mCachedPtr, reason);
+        }
+
+        /// <summary>
+        /// Removes a pin added by <see cref="Pin"/>. The resource can be unloaded once all its pins are removed and
+        /// nothing else references it.
+        /// </summary>
+        /// <param name="reason">Reason provided when pinning the resource.</param>
+        public void Unpin(string reason)
+        {
+            Internal_Unpin(mCachedPtr, reason);
+        }
+
+        /// <summary>
+        /// Reports how many of the referenced resources are loaded and pinned, and how much memory they use. Resources
+        /// referenced multiple times are only counted once.
+        /// </summary>
+        /// <param name="references">References to the resources to check.</param>
+        /// <returns>Residency information about the referenced resources.</returns>
+        public static ResourceResidency GetResidency(ResourceRef[] references)
+        {
+            ResourceResidency output = new ResourceResidency();
+            output.NumReferences = references != null ? references.Length : 0;
+
+            ulong memoryUsage;
+            Internal_GetResidency(references, out output.NumLoaded, out output.NumPinned, out memoryUsage);
+            output.MemoryUsage = (long)memoryUsage;
+
+            return output;
+        }
+
+        /// <summary>
+        /// Returns a human readable report listing every resource that is either pinned or referenced from managed
+        /// code, along with its load state, approximate memory usage and the reason it is resident.
+        /// </summary>
+        /// <returns>Multi-line report, suitable for logging.</returns>
+        public static string GetResidencyReport()
+        {
+            return Internal_GetResidencyReport();
+        }
+
         /// <inheritdoc/>
         public override bool Equals(object other)
         {
@@ -60,6 +128,51 @@ namespace BansheeEngine
 
         [MethodImpl(MethodImplOptions.InternalCall)]
         private static extern void Internal_GetUUID(IntPtr thisPtr, out UUID uuid);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern ulong Internal_GetMemoryUsage(IntPtr thisPtr);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern bool Internal_IsPinned(IntPtr thisPtr);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_Pin(IntPtr thisPtr, string reason);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_Unpin(IntPtr thisPtr, string reason);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_GetResidency(ResourceRef[] references, out int numLoaded,
+            out int numPinned, out ulong memoryUsage);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern string Internal_GetResidencyReport();
+    }
+
+    /// <summary>
+    /// Information about how many resources out of a set of references are kept in memory.
+    /// </summary>
+    public struct ResourceResidency
+    {
+        /// <summary>
+        /// Number of references the information was gathered for.
+        /// </summary>
+        public int NumReferences;
+
+        /// <summary>
+        /// Number of unique referenced resources that are currently loaded.
+        /// </summary>
+        public int NumLoaded;
+
+        /// <summary>
+        /// Number of unique referenced resources that are pinned.
+        /// </summary>
+        public int NumPinned;
+
+        /// <summary>
+        /// Approximate amount of memory used by the loaded resources, in bytes.
+        /// </summary>
+        public long MemoryUsage;
     }
 
     /** @} */
@@ -55,6 +55,36 @@ namespace BansheeEngine
             return (T)Internal_LoadRef(reference, keepLoaded);
         }
 
+        /// <summary>
+        /// Starts loading the resource referenced by the provided reference on a worker thread, without blocking the
+        /// caller. Completion is reported on the main thread through the returned object.
+        /// </summary>
+        /// <param name="reference">Reference to the resource to load.</param>
+        /// <param name="keepLoaded">If true the system will keep the resource loaded even when it goes out of scope.
+        ///                          You must call <see cref="Release(ResourceRef)"/> to allow the resource to be
+        ///                          unloaded (it must be called once for each corresponding load). </param>
+        /// <returns>Object used for checking the load progress and retrieving the loaded resource.</returns>
+        public static AsyncResourceLoad LoadAsync(ResourceRef reference, bool keepLoaded = true)
+        {
+            return new AsyncResourceLoad(new ResourceRef[] { reference }, keepLoaded);
+        }
+
+        /// <summary>
+        /// Starts loading the resources referenced by the provided references on worker threads, without blocking the
+        /// caller. All the loads are started at once, and completion of the entire batch is reported on the main thread
+        /// through the returned object.
+        /// </summary>
+        /// <param name="references">References to the resources to load.</param>
+        /// <param name="keepLoaded">If true the system will keep the resources loaded even when they go out of scope.
+        ///                          You must call <see cref="Release(ResourceRef)"/> to allow the resources to be
+        ///                          unloaded (it must be called once for each corresponding load). </param>
+        /// <returns>Object that can be used for checking the load progress and retrieving the loaded resources, in the
+        ///          same order as <paramref name="references"/>.</returns>
+        public static AsyncResourceLoad LoadAsync(ResourceRef[] references, bool keepLoaded = true)
+        {
+            return new AsyncResourceLoad(references, keepLoaded);
+        }
+
         /// <summary>
         /// Releases an internal reference to the resource held by the resources system. This allows the resource
         ///	to be unloaded when it goes out of scope, if the resource was loaded with "keepLoaded" parameter.
@@ -1,6 +1,8 @@
 ﻿//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
 //**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
 using System;
+using System.Collections.Generic;
+using System.Reflection;
 using System.Runtime.CompilerServices;
 
 namespace BansheeEngine
@@ -125,17 +127,114 @@ namespace BansheeEngine
     /// </summary>
     public class ManagedComponent : Component
     {
+        private static Dictionary<Type, Action<ManagedComponent>> updateMethods =
+            new Dictionary<Type, Action<ManagedComponent>>();
+
         protected ManagedComponent()
         { }
 
+        /// <summary>
+        /// Determines should OnUpdate callbacks of all components of the same type be triggered together, with a single
+        /// call from the engine per type, instead of one call per component. This reduces the overhead of the update when
+        /// there are many components of the same type, but the callbacks will no longer execute in the same order as
+        /// updates of native components. Disabled by default.
+        /// </summary>
+        public static bool BatchedUpdates
+        {
+            get { return Internal_GetBatchedUpdates(); }
+            set { Internal_SetBatchedUpdates(value); }
+        }
+
         /// <inheritdoc/>
         protected internal override void Invoke(string name)
         {
             Internal_Invoke(mCachedPtr, name);
         }
 
+        /// <summary>
+        /// Triggered by the runtime when batched updates are enabled. Calls OnUpdate on the provided set of components.
+        /// </summary>
+        /// <param name="type">Type of all the components in the <paramref name="components"/> array.</param>
+        /// <param name="components">Components to update. Only the first <paramref name="count"/> entries are valid.
+        ///                          </param>
+        /// <param name="count">Number of components to update.</param>
+        private static void Internal_UpdateBatch(Type type, ManagedComponent[] components, int count)
+        {
+            Action<ManagedComponent> update;
+            if (!updateMethods.TryGetValue(type, out update))
+            {
+                update = CreateUpdateAction(type);
+                updateMethods[type] = update;
+            }
+
+            if (update == null)
+                return;
+
+            for (int i = 0; i < count; i++)
+            {
+                // Don't let a single component prevent the rest of the batch from updating
+                try
+                {
+                    update(components[i]);
+                }
+                catch (Exception e)
+                {
+                    Debug.LogError(e.ToString());
+                }
+            }
+        }
+
+        /// <summary>
+        /// Finds the OnUpdate method on the provided type or its base types, and creates a delegate that can call it on
+        /// any instance of that type.
+        /// </summary>
+        /// <param name="type">Type to create the delegate for.</param>
+        /// <returns>Delegate calling OnUpdate, or null if the type has no such method.</returns>
+        private static Action<ManagedComponent> CreateUpdateAction(Type type)
+        {
+            const BindingFlags flags = BindingFlags.Instance | BindingFlags.Public | BindingFlags.NonPublic |
+                BindingFlags.DeclaredOnly;
+
+            Type currentType = type;
+            while (currentType != null && currentType != typeof(ManagedComponent))
+            {
+                MethodInfo method = currentType.GetMethod("OnUpdate", flags, null, Type.EmptyTypes, null);
+                if (method != null)
+                {
+                    MethodInfo createMethod = typeof(ManagedComponent).GetMethod("CreateUpdateActionTyped",
+                        BindingFlags.Static | BindingFlags.NonPublic);
+
+                    return (Action<ManagedComponent>)createMethod.MakeGenericMethod(currentType)
+                        .Invoke(null, new object[] { method });
+                }
+
+                currentType = currentType.BaseType;
+            }
+
+            return null;
+        }
+
+        /// <summary>
+        /// Creates a delegate for the provided OnUpdate method. Uses an open instance delegate so the method is called
+        /// directly, without going through reflection on every call.
+        /// </summary>
+        /// <typeparam name="T">Type the method is declared on.</typeparam>
+        /// <param name="method">OnUpdate method to call.</param>
+        /// <returns>Delegate calling the method on the provided component.</returns>
+        private static Action<ManagedComponent> CreateUpdateActionTyped<T>(MethodInfo method) where T : ManagedComponent
+        {
+            Action<T> action = (Action<T>)Delegate.CreateDelegate(typeof(Action<T>), method);
+            return x => action((T)x);
+        }
+
         [MethodImpl(MethodImplOptions.InternalCall)]
         internal static extern void Internal_Invoke(IntPtr nativeInstance, string name);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern bool Internal_GetBatchedUpdates();
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_SetBatchedUpdates(bool enabled);
     }
 
     /** @} */
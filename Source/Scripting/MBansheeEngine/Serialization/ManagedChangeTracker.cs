@@ -0,0 +1,47 @@
+﻿//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+using System;
+using System.Runtime.CompilerServices;
+
+namespace BansheeEngine
+{
+    /** @addtogroup Serialization
+     *  @{
+     */
+
+    /// <summary>
+    /// Provides version numbers that change whenever a component is modified through the serialization layer (e.g.
+    /// <see cref="SerializableField"/>), or through an operation like undo/redo. Allows tools to detect modifications
+    /// without reading all the fields of a component.
+    /// </summary>
+    internal static class ManagedChangeTracker
+    {
+        /// <summary>
+        /// Returns the current version of a component. If the version is the same as one returned by an earlier call, the
+        /// component wasn't modified through the serialization layer in the meantime.
+        /// </summary>
+        /// <param name="instanceId">Instance ID of the component.</param>
+        /// <returns>Version of the component.</returns>
+        public static ulong GetVersion(ulong instanceId)
+        {
+            return Internal_GetVersion(instanceId);
+        }
+
+        /// <summary>
+        /// Notifies the tracker that a modification was made which cannot be attributed to a single component, changing
+        /// the versions of all components.
+        /// </summary>
+        public static void NotifyAllModified()
+        {
+            Internal_NotifyAllModified();
+        }
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern ulong Internal_GetVersion(ulong instanceId);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_NotifyAllModified();
+    }
+
+    /** @} */
+}
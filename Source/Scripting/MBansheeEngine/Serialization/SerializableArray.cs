@@ -69,8 +69,11 @@ namespace BansheeEngine
             {
                 Array array = parentProperty.GetValue<Array>();
 
-                if(array != null)
+                if (array != null)
+                {
                     array.SetValue(value, elementIdx);
+                    ManagedChangeTracker.NotifyAllModified();
+                }
             };
 
             SerializableProperty property = Internal_CreateProperty(mCachedPtr);
@@ -110,7 +110,10 @@ namespace BansheeEngine
                     IDictionary dict = parentProperty.GetValue<IDictionary>();
 
                     if (dict != null)
+                    {
                         dict[key] = value;
+                        ManagedChangeTracker.NotifyAllModified();
+                    }
                 };
 
                 valueProperty = Internal_CreateValueProperty(mCachedPtr);
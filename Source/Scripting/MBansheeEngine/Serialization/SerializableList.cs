@@ -71,7 +71,10 @@ namespace BansheeEngine
                 IList list = parentProperty.GetValue<IList>();
 
                 if (list != null)
+                {
                     list[elementIdx] = value;
+                    ManagedChangeTracker.NotifyAllModified();
+                }
             };
 
             SerializableProperty property = Internal_CreateProperty(mCachedPtr);
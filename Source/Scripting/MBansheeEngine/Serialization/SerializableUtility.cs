@@ -1,6 +1,8 @@
 ﻿//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
 //**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
 using System;
+using System.Collections.Generic;
+using System.Reflection;
 using System.Runtime.CompilerServices;
 
 namespace BansheeEngine
@@ -14,6 +16,8 @@ namespace BansheeEngine
     /// </summary>
     public static class SerializableUtility
     {
+        private static Dictionary<Type, MethodInfo> setDictionaryEntriesMethods = new Dictionary<Type, MethodInfo>();
+
         /// <summary>
         /// Clones the specified object. Non-serializable types and fields are ignored in clone. A deep copy is performed
         /// on all serializable elements except for resources or game objects.
@@ -45,6 +49,45 @@ namespace BansheeEngine
             return Internal_Create(type);
         }
 
+        /// <summary>
+        /// Adds arrays of keys and values to a dictionary. Called by the runtime when deserializing a dictionary, so the
+        /// entries can be added in a single call.
+        /// </summary>
+        /// <param name="dictionary">Dictionary to add the entries to.</param>
+        /// <param name="keys">Keys of the entries to add. Must be an array of the dictionary key type.</param>
+        /// <param name="values">Values of the entries to add, in the same order as keys. Must be an array of the
+        ///                      dictionary value type.</param>
+        private static void Internal_SetDictionaryEntries(object dictionary, Array keys, Array values)
+        {
+            // Entries are added through a method specialized for the dictionary type, so they don't need to be boxed
+            Type dictionaryType = dictionary.GetType();
+
+            MethodInfo method;
+            if (!setDictionaryEntriesMethods.TryGetValue(dictionaryType, out method))
+            {
+                method = typeof(SerializableUtility).GetMethod("SetDictionaryEntries",
+                    BindingFlags.NonPublic | BindingFlags.Static);
+                method = method.MakeGenericMethod(dictionaryType.GetGenericArguments());
+
+                setDictionaryEntriesMethods[dictionaryType] = method;
+            }
+
+            method.Invoke(null, new object[] { dictionary, keys, values });
+        }
+
+        /// <summary>
+        /// Adds arrays of keys and values to a dictionary.
+        /// </summary>
+        /// <param name="dictionary">Dictionary to add the entries to.</param>
+        /// <param name="keys">Keys of the entries to add.</param>
+        /// <param name="values">Values of the entries to add, in the same order as keys.</param>
+        private static void SetDictionaryEntries<TKey, TValue>(Dictionary<TKey, TValue> dictionary, TKey[] keys,
+            TValue[] values)
+        {
+            for (int i = 0; i < keys.Length; i++)
+                dictionary.Add(keys[i], values[i]);
+        }
+
         [MethodImpl(MethodImplOptions.InternalCall)]
         private static extern object Internal_Clone(object original);
 
@@ -59,16 +59,62 @@ namespace BansheeEngine
     public sealed class Debug
     {
         /// <summary>
-        /// Triggered when a new message is added to the debug log.
+        /// Triggered when a new message is added to the debug log. Messages are reported in batches once per frame, up to
+        /// <see cref="MaxMessagesPerFrame"/> messages per frame. If the same message was added multiple times in
+        /// succession it is only reported once, through <see cref="OnAddedRepeated"/> if set, or through this event
+        /// otherwise.
         /// </summary>
         public static Action<DebugMessageType, string> OnAdded;
 
         /// <summary>
-        /// Returns a list of all messages in the debug log.
+        /// Triggered when the same message was added to the debug log multiple times in succession. Provides the number of
+        /// times the message was added.
+        /// </summary>
+        public static Action<DebugMessageType, string, int> OnAddedRepeated;
+
+        /// <summary>
+        /// Triggered when messages were added to the debug log faster than they could be reported through
+        /// <see cref="OnAdded"/>. Provides the number of messages that were not reported. Such messages are still present
+        /// in the log and can be retrieved through <see cref="GetMessages"/>.
+        /// </summary>
+        public static Action<int> OnDropped;
+
+        /// <summary>
+        /// Returns a list of all messages in the debug log. Use <see cref="GetMessages"/> to retrieve a subset of the
+        /// messages when the log is large.
         /// </summary>
         public static LogEntry[] Messages
         {
-            get { return Internal_GetMessages(); }
+            get { return Internal_GetMessages(0, int.MaxValue); }
+        }
+
+        /// <summary>
+        /// Returns the number of messages in the debug log.
+        /// </summary>
+        public static int NumMessages
+        {
+            get { return Internal_GetNumMessages(); }
+        }
+
+        /// <summary>
+        /// Maximum number of messages reported through <see cref="OnAdded"/> per frame. Any remaining messages will be
+        /// reported in later frames. Zero or negative means no limit.
+        /// </summary>
+        public static int MaxMessagesPerFrame
+        {
+            get { return Internal_GetMaxMessagesPerFrame(); }
+            set { Internal_SetMaxMessagesPerFrame(Math.Max(value, 0)); }
+        }
+
+        /// <summary>
+        /// Returns a range of messages from the debug log.
+        /// </summary>
+        /// <param name="offset">Index of the first message to return.</param>
+        /// <param name="count">Maximum number of messages to return.</param>
+        /// <returns>Messages in the requested range, in order they were logged.</returns>
+        public static LogEntry[] GetMessages(int offset, int count)
+        {
+            return Internal_GetMessages(offset, count);
         }
 
         /// <summary>
@@ -272,14 +318,26 @@ namespace BansheeEngine
         }
 
         /// <summary>
-        /// Triggered by the runtime when a new message is added to the debug log.
+        /// Triggered by the runtime once per frame, with all the messages added to the debug log since the last call.
         /// </summary>
-        /// <param name="type">Type of the message that was added.</param>
-        /// <param name="message">Text of the message.</param>
-        private static void Internal_OnAdded(DebugMessageType type, string message)
+        /// <param name="types">Types of the added messages.</param>
+        /// <param name="messages">Text of the added messages.</param>
+        /// <param name="counts">Number of times each message was added in succession.</param>
+        /// <param name="numDropped">Number of messages that were added but could not be reported.</param>
+        private static void Internal_OnAddedBatch(int[] types, string[] messages, int[] counts, int numDropped)
         {
-            if (OnAdded != null)
-                OnAdded(type, message);
+            for (int i = 0; i < messages.Length; i++)
+            {
+                DebugMessageType type = (DebugMessageType)types[i];
+
+                if (counts[i] > 1 && OnAddedRepeated != null)
+                    OnAddedRepeated(type, messages[i], counts[i]);
+                else if (OnAdded != null)
+                    OnAdded(type, messages[i]);
+            }
+
+            if (numDropped > 0 && OnDropped != null)
+                OnDropped(numDropped);
         }
 
         [MethodImpl(MethodImplOptions.InternalCall)]
@@ -301,7 +359,16 @@ namespace BansheeEngine
         internal static extern void Internal_ClearType(DebugMessageType type);
 
         [MethodImpl(MethodImplOptions.InternalCall)]
-        internal static extern LogEntry[] Internal_GetMessages();
+        internal static extern int Internal_GetNumMessages();
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        internal static extern LogEntry[] Internal_GetMessages(int offset, int count);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        internal static extern int Internal_GetMaxMessagesPerFrame();
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        internal static extern void Internal_SetMaxMessagesPerFrame(int value);
     }
 
     /** @} */
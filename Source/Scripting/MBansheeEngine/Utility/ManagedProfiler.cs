@@ -0,0 +1,199 @@
+﻿//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+using System;
+using System.Runtime.CompilerServices;
+using System.Runtime.InteropServices;
+
+namespace BansheeEngine
+{
+    /** @addtogroup Utility
+     *  @{
+     */
+
+    /// <summary>
+    /// Contains accumulated profiling information for all callbacks of a single component type, during a single frame.
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential)]
+    public struct ManagedTypeSample // Note: Must match C++ struct ScriptManagedTypeSampleData
+    {
+        /// <summary>Full name of the component type, including the namespace.</summary>
+        public string typeName;
+
+        /// <summary>Number of callbacks executed for components of this type.</summary>
+        public int numCalls;
+
+        /// <summary>Total time spent in the callbacks, including any nested calls, in milliseconds.</summary>
+        public float time;
+
+        /// <summary>
+        /// Approximate number of bytes allocated on the managed heap by the callbacks. Only valid if 
+        /// <see cref="ManagedProfiler.TrackAllocations"/> is enabled.
+        /// </summary>
+        public long gcAllocated;
+    }
+
+    /// <summary>
+    /// Contains accumulated profiling information for all callbacks of a single component instance, during a single 
+    /// frame.
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential)]
+    public struct ManagedInstanceSample // Note: Must match C++ struct ScriptManagedInstanceSampleData
+    {
+        /// <summary>Unique identifier of the component instance. See <see cref="GameObject.InstanceId"/>.</summary>
+        public ulong instanceId;
+
+        /// <summary>Full name of the component type, including the namespace.</summary>
+        public string typeName;
+
+        /// <summary>Number of callbacks executed for the component.</summary>
+        public int numCalls;
+
+        /// <summary>Total time spent in the callbacks, including any nested calls, in milliseconds.</summary>
+        public float time;
+
+        /// <summary>
+        /// Approximate number of bytes allocated on the managed heap by the callbacks. Only valid if 
+        /// <see cref="ManagedProfiler.TrackAllocations"/> is enabled.
+        /// </summary>
+        public long gcAllocated;
+    }
+
+    /// <summary>
+    /// Profiler that measures the cost of component callbacks (e.g. <c>OnUpdate</c>) per component type and per component
+    /// instance. Samples for a number of most recent frames are kept, and can be queried or saved to a trace file.
+    /// </summary>
+    public static class ManagedProfiler
+    {
+        /// <summary>
+        /// Determines is the profiler recording samples. When disabled the profiler has no measurable overhead.
+        /// </summary>
+        public static bool Enabled
+        {
+            get { return Internal_IsEnabled(); }
+            set { Internal_SetEnabled(value); }
+        }
+
+        /// <summary>
+        /// Determines should managed heap allocations be recorded for each callback. This has higher overhead than just
+        /// recording time.
+        /// </summary>
+        public static bool TrackAllocations
+        {
+            get { return Internal_GetTrackAllocations(); }
+            set { Internal_SetTrackAllocations(value); }
+        }
+
+        /// <summary>
+        /// Determines should each individual callback invocation be recorded, in addition to the accumulated samples. 
+        /// This provides a more detailed output from <see cref="SaveTrace"/>.
+        /// </summary>
+        public static bool CaptureEvents
+        {
+            get { return Internal_GetCaptureEvents(); }
+            set { Internal_SetCaptureEvents(value); }
+        }
+
+        /// <summary>
+        /// Returns the number of frames for which samples are available.
+        /// </summary>
+        public static int NumFrames
+        {
+            get { return (int)Internal_GetNumFrames(); }
+        }
+
+        /// <summary>
+        /// Returns information about a recorded frame.
+        /// </summary>
+        /// <param name="frame">Index of the frame, where 0 is the most recent frame.</param>
+        /// <param name="frameIdx">Sequential index of the frame since application start.</param>
+        /// <param name="duration">Duration of the frame, in milliseconds.</param>
+        public static void GetFrameInfo(int frame, out ulong frameIdx, out float duration)
+        {
+            Internal_GetFrameInfo((uint)frame, out frameIdx, out duration);
+        }
+
+        /// <summary>
+        /// Returns samples for each component type that had callbacks executed during a recorded frame.
+        /// </summary>
+        /// <param name="frame">Index of the frame, where 0 is the most recent frame.</param>
+        /// <returns>One sample per component type.</returns>
+        public static ManagedTypeSample[] GetTypeSamples(int frame)
+        {
+            return Internal_GetTypeSamples((uint)frame);
+        }
+
+        /// <summary>
+        /// Returns samples for each component instance that had callbacks executed during a recorded frame.
+        /// </summary>
+        /// <param name="frame">Index of the frame, where 0 is the most recent frame.</param>
+        /// <returns>One sample per component instance.</returns>
+        public static ManagedInstanceSample[] GetInstanceSamples(int frame)
+        {
+            return Internal_GetInstanceSamples((uint)frame);
+        }
+
+        /// <summary>
+        /// Removes all recorded samples.
+        /// </summary>
+        public static void Clear()
+        {
+            Internal_Clear();
+        }
+
+        /// <summary>
+        /// Saves all recorded samples into a file using the Chrome trace event format.
+        /// </summary>
+        /// <param name="path">Absolute path to the file to write.</param>
+        public static void SaveTrace(string path)
+        {
+            Internal_SaveTrace(path);
+        }
+
+        /// <summary>
+        /// Triggered by the runtime when it needs to know the current size of the managed heap.
+        /// </summary>
+        /// <returns>Number of bytes in use by the managed heap.</returns>
+        private static long Internal_GetManagedHeapSize()
+        {
+            return GC.GetTotalMemory(false);
+        }
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_SetEnabled(bool enabled);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern bool Internal_IsEnabled();
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_SetTrackAllocations(bool track);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern bool Internal_GetTrackAllocations();
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_SetCaptureEvents(bool capture);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern bool Internal_GetCaptureEvents();
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern uint Internal_GetNumFrames();
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_GetFrameInfo(uint frame, out ulong frameIdx, out float duration);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern ManagedTypeSample[] Internal_GetTypeSamples(uint frame);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern ManagedInstanceSample[] Internal_GetInstanceSamples(uint frame);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_Clear();
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_SaveTrace(string path);
+    }
+
+    /** @} */
+}
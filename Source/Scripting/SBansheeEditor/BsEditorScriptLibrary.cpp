@@ -44,6 +44,8 @@ namespace bs
 			assemblies.push_back({ ENGINE_ASSEMBLY, engineAssemblyPath });
 			if (gEditorApplication().isProjectLoaded())
 			{
+				addScriptAssemblies(gEditorApplication().getScriptAssemblyFolder(), assemblies);
+
 				if (FileSystem::exists(gameAssemblyPath))
 					assemblies.push_back({ SCRIPT_GAME_ASSEMBLY, gameAssemblyPath });
 			}
@@ -66,21 +68,28 @@ namespace bs
 		else // Otherwise just additively load them
 		{
 			MonoManager::instance().loadAssembly(engineAssemblyPath.toString(), ENGINE_ASSEMBLY);
-			ScriptAssemblyManager::instance().loadAssemblyInfo(ENGINE_ASSEMBLY);
+			ScriptAssemblyManager::instance().loadAssemblyInfo(ENGINE_ASSEMBLY, engineAssemblyPath);
+
+			if (gEditorApplication().isProjectLoaded())
+			{
+				Vector<std::pair<String, Path>> scriptAssemblies;
+				addScriptAssemblies(gEditorApplication().getScriptAssemblyFolder(), scriptAssemblies);
+				loadOtherAssemblies(scriptAssemblies);
+			}
 
 			if (FileSystem::exists(gameAssemblyPath))
 			{
 				MonoManager::instance().loadAssembly(gameAssemblyPath.toString(), SCRIPT_GAME_ASSEMBLY);
-				ScriptAssemblyManager::instance().loadAssemblyInfo(SCRIPT_GAME_ASSEMBLY);
+				ScriptAssemblyManager::instance().loadAssemblyInfo(SCRIPT_GAME_ASSEMBLY, gameAssemblyPath);
 			}
 
 			MonoManager::instance().loadAssembly(editorAssemblyPath.toString(), EDITOR_ASSEMBLY);
-			ScriptAssemblyManager::instance().loadAssemblyInfo(EDITOR_ASSEMBLY);
+			ScriptAssemblyManager::instance().loadAssemblyInfo(EDITOR_ASSEMBLY, editorAssemblyPath);
 
 			if (FileSystem::exists(editorScriptAssemblyPath))
 			{
 				MonoManager::instance().loadAssembly(editorScriptAssemblyPath.toString(), SCRIPT_EDITOR_ASSEMBLY);
-				ScriptAssemblyManager::instance().loadAssemblyInfo(SCRIPT_EDITOR_ASSEMBLY);
+				ScriptAssemblyManager::instance().loadAssemblyInfo(SCRIPT_EDITOR_ASSEMBLY, editorScriptAssemblyPath);
 			}
 
 			if (FileSystem::exists(gameResourcesPath))
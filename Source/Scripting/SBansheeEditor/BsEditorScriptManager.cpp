@@ -12,6 +12,7 @@
 #include "Wrappers/BsScriptHandleSliderManager.h"
 #include "BsScriptDragDropManager.h"
 #include "Wrappers/BsScriptProjectLibrary.h"
+#include "BsScriptAttributeCache.h"
 #include "BsMenuItemManager.h"
 #include "BsToolbarItemManager.h"
 #include "Wrappers/BsScriptFolderMonitor.h"
@@ -26,6 +27,10 @@
 #include "Wrappers/BsScriptEditorInput.h"
 #include "Wrappers/BsScriptEditorVirtualInput.h"
 #include "Wrappers/BsScriptUndoRedo.h"
+#include "Wrappers/BsScriptUnitTests.h"
+#include "Testing/BsEditorBenchmarks.h"
+#include "Wrappers/BsScriptPrefab.h"
+#include "Scene/BsPrefabInstanceRegistry.h"
 
 namespace bs
 {
@@ -38,13 +43,14 @@ namespace bs
 		GameResourceManager::instance().setLoader(resourceLoader);
 
 		loadMonoTypes();
-		ScriptAssemblyManager::instance().loadAssemblyInfo(EDITOR_ASSEMBLY);
+		ScriptAssemblyManager::instance().loadAssemblyInfo(EDITOR_ASSEMBLY, gEditorApplication().getEditorAssemblyPath());
 
 		ScriptUndoRedo::startUp();
 		ScriptEditorInput::startUp();
 		ScriptEditorVirtualInput::startUp();
 		ScriptEditorApplication::startUp();
 		ScriptHandleSliderManager::startUp();
+		ScriptAttributeCache::startUp(ScriptAssemblyManager::instance());
 		ScriptGizmoManager::startUp(ScriptAssemblyManager::instance());
 		HandleManager::startUp<ScriptHandleManager>(ScriptAssemblyManager::instance());
 		ScriptDragDropManager::startUp();
@@ -55,8 +61,13 @@ namespace bs
 		ScriptSelection::startUp();
 		ScriptInspectorUtility::startUp();
 
+		ScriptAttributeCache::instance().logTimings();
+
 		mOnDomainLoadConn = ScriptObjectManager::instance().onRefreshDomainLoaded.connect(std::bind(&EditorScriptManager::loadMonoTypes, this));
 		mOnAssemblyRefreshDoneConn = ScriptObjectManager::instance().onRefreshComplete.connect(std::bind(&EditorScriptManager::onAssemblyRefreshDone, this));
+		mOnBenchmarksRunConn = EditorBenchmarks::onRun.connect(&ScriptUnitTests::runBenchmarks);
+		mOnPrefabInstantiatedConn = ScriptPrefab::onInstantiated.connect(
+			[](const HSceneObject& root) { PrefabInstanceRegistry::instance().registerInstances(root); });
 		triggerOnInitialize();
 
 		// Trigger OnEditorStartUp
@@ -72,6 +83,8 @@ namespace bs
 	{
 		mOnDomainLoadConn.disconnect();
 		mOnAssemblyRefreshDoneConn.disconnect();
+		mOnBenchmarksRunConn.disconnect();
+		mOnPrefabInstantiatedConn.disconnect();
 
 		ScriptInspectorUtility::shutDown();
 		ScriptSelection::shutDown();
@@ -83,6 +96,7 @@ namespace bs
 		ScriptHandleSliderManager::shutDown();
 		HandleManager::shutDown();
 		ScriptGizmoManager::shutDown();
+		ScriptAttributeCache::shutDown();
 		ScriptEditorApplication::shutDown();
 		ScriptEditorVirtualInput::shutDown();
 		ScriptEditorInput::shutDown();
@@ -105,6 +119,7 @@ namespace bs
 		ScriptDragDropManager::instance().update();
 		ScriptFolderMonitorManager::instance().update();
 		ScriptEditorApplication::update();
+		ScriptUnitTests::updateTests();
 	}
 
 	void EditorScriptManager::quitRequested()
@@ -122,6 +137,7 @@ namespace bs
 
 	void EditorScriptManager::onAssemblyRefreshDone()
 	{
+		ScriptAttributeCache::instance().logTimings();
 		triggerOnInitialize();
 	}
 
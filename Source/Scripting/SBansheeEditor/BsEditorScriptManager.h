@@ -52,6 +52,8 @@ namespace bs
 
 		HEvent mOnDomainLoadConn;
 		HEvent mOnAssemblyRefreshDoneConn;
+		HEvent mOnBenchmarksRunConn;
+		HEvent mOnPrefabInstantiatedConn;
 	};
 
 	/** @} */
@@ -2,6 +2,7 @@
 //**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
 #include "BsMenuItemManager.h"
 #include "Serialization/BsScriptAssemblyManager.h"
+#include "BsScriptAttributeCache.h"
 #include "BsMonoAssembly.h"
 #include "BsMonoClass.h"
 #include "BsMonoMethod.h"
@@ -89,41 +90,36 @@ namespace bs
 		Vector<String> scriptAssemblyNames = mScriptObjectManager.getScriptAssemblies();
 		for (auto& assemblyName : scriptAssemblyNames)
 		{
-			MonoAssembly* assembly = MonoManager::instance().getAssembly(assemblyName);
-
 			// Find new menu item methods
-			const Vector<MonoClass*>& allClasses = assembly->getAllClasses();
-			for (auto curClass : allClasses)
+			Vector<MonoMethod*> methods =
+				ScriptAttributeCache::instance().getMethodsWithAttribute(assemblyName, mMenuItemAttribute);
+			for (auto& curMethod : methods)
 			{
-				const Vector<MonoMethod*>& methods = curClass->getAllMethods();
-				for (auto& curMethod : methods)
+				String path;
+				ShortcutKey shortcutKey = ShortcutKey::NONE;
+				INT32 priority = 0;
+				bool separator = false;
+				if (parseMenuItemMethod(curMethod, path, shortcutKey, priority, separator))
 				{
-					String path;
-					ShortcutKey shortcutKey = ShortcutKey::NONE;
-					INT32 priority = 0;
-					bool separator = false;
-					if (parseMenuItemMethod(curMethod, path, shortcutKey, priority, separator))
-					{
-						std::function<void()> callback = std::bind(&MenuItemManager::menuItemCallback, curMethod);
+					std::function<void()> callback = std::bind(&MenuItemManager::menuItemCallback, curMethod);
 
-						if (separator)
+					if (separator)
+					{
+						Vector<String> pathElements = StringUtil::split(path, "/");
+						String separatorPath;
+						if (pathElements.size() > 1)
 						{
-							Vector<String> pathElements = StringUtil::split(path, "/");
-							String separatorPath;
-							if (pathElements.size() > 1)
-							{
-								const String& lastElem = pathElements[pathElements.size() - 1];
-								separatorPath = path;
-								separatorPath.erase(path.size() - lastElem.size() - 1, lastElem.size() + 1);
-							}
-
-							GUIMenuItem* separatorItem = mainWindow->getMenuBar().addMenuItemSeparator(separatorPath, priority);
-							mMenuItems.push_back(separatorItem);
+							const String& lastElem = pathElements[pathElements.size() - 1];
+							separatorPath = path;
+							separatorPath.erase(path.size() - lastElem.size() - 1, lastElem.size() + 1);
 						}
 
-						GUIMenuItem* menuItem = mainWindow->getMenuBar().addMenuItem(path, callback, priority, shortcutKey);
-						mMenuItems.push_back(menuItem);
+						GUIMenuItem* separatorItem = mainWindow->getMenuBar().addMenuItemSeparator(separatorPath, priority);
+						mMenuItems.push_back(separatorItem);
 					}
+
+					GUIMenuItem* menuItem = mainWindow->getMenuBar().addMenuItem(path, callback, priority, shortcutKey);
+					mMenuItems.push_back(menuItem);
 				}
 			}
 		}
@@ -0,0 +1,309 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsScriptAttributeCache.h"
+#include "Serialization/BsScriptAssemblyManager.h"
+#include "BsScriptObjectManager.h"
+#include "BsMonoManager.h"
+#include "BsMonoAssembly.h"
+#include "BsMonoClass.h"
+#include "BsMonoMethod.h"
+#include "FileSystem/BsFileSystem.h"
+#include "FileSystem/BsDataStream.h"
+#include "Utility/BsTimer.h"
+
+namespace bs
+{
+	ScriptAttributeCache::ScriptAttributeCache(ScriptAssemblyManager& scriptObjectManager)
+		:mScriptObjectManager(scriptObjectManager)
+	{
+		mRefreshStartedConn = ScriptObjectManager::instance().onRefreshStarted.connect(
+			std::bind(&ScriptAttributeCache::onRefreshStarted, this));
+
+		// Attributes used by the built-in extension points. Registered here so they're all indexed in the same pass,
+		// regardless of the order their users are started in.
+		registerAttribute("BansheeEditor", "MenuItem", AttributeTarget::Method);
+		registerAttribute("BansheeEditor", "ToolbarItem", AttributeTarget::Method);
+		registerAttribute("BansheeEditor", "DrawGizmo", AttributeTarget::Method);
+		registerAttribute("BansheeEditor", "CustomHandle", AttributeTarget::Class);
+		registerAttribute("BansheeEditor", "CustomInspector", AttributeTarget::Class);
+	}
+
+	ScriptAttributeCache::~ScriptAttributeCache()
+	{
+		mRefreshStartedConn.disconnect();
+	}
+
+	void ScriptAttributeCache::registerAttribute(const String& ns, const String& typeName, AttributeTarget target)
+	{
+		for (auto& entry : mAttributes)
+		{
+			if (entry.ns == ns && entry.typeName == typeName)
+				return;
+		}
+
+		mAttributes.push_back({ ns, typeName, target });
+		mAttributesVersion++;
+	}
+
+	Vector<MonoClass*> ScriptAttributeCache::getClassesWithAttribute(const String& assemblyName, MonoClass* attribute)
+	{
+		if (attribute == nullptr)
+			return Vector<MonoClass*>();
+
+		registerAttribute(attribute->getNamespace(), attribute->getTypeName(), AttributeTarget::Class);
+
+		AssemblyIndex* index = getIndex(assemblyName);
+		if (index == nullptr)
+			return Vector<MonoClass*>();
+
+		auto iterFind = index->classes.find(attribute->getFullName());
+		if (iterFind == index->classes.end())
+			return Vector<MonoClass*>();
+
+		return iterFind->second;
+	}
+
+	Vector<MonoMethod*> ScriptAttributeCache::getMethodsWithAttribute(const String& assemblyName, MonoClass* attribute)
+	{
+		if (attribute == nullptr)
+			return Vector<MonoMethod*>();
+
+		registerAttribute(attribute->getNamespace(), attribute->getTypeName(), AttributeTarget::Method);
+
+		AssemblyIndex* index = getIndex(assemblyName);
+		if (index == nullptr)
+			return Vector<MonoMethod*>();
+
+		auto iterFind = index->methods.find(attribute->getFullName());
+		if (iterFind == index->methods.end())
+			return Vector<MonoMethod*>();
+
+		return iterFind->second;
+	}
+
+	void ScriptAttributeCache::logTimings()
+	{
+		if (mTimings.empty())
+			return;
+
+		float totalMs = 0.0f;
+		String report;
+		for (auto& entry : mTimings)
+		{
+			report += "\n  " + entry.assembly + ": " + toString(entry.timeMs) + "ms, " + toString(entry.numResults) +
+				" found" + (entry.cached ? " (cached)" : "");
+
+			totalMs += entry.timeMs;
+		}
+
+		LOGDBG("Attribute scan timings (" + toString(totalMs) + "ms total):" + report);
+		mTimings.clear();
+	}
+
+	ScriptAttributeCache::AssemblyIndex* ScriptAttributeCache::getIndex(const String& assemblyName)
+	{
+		MonoAssembly* assembly = MonoManager::instance().getAssembly(assemblyName);
+		if (assembly == nullptr)
+			return nullptr;
+
+		AssemblyIndex& index = mIndices[assemblyName];
+		if (index.isLoaded && index.attributesVersion == mAttributesVersion)
+			return &index;
+
+		Timer timer;
+
+		UINT64 assemblyHash = getAssemblyHash(assemblyName);
+
+		bool cached = false;
+		if (assemblyHash != 0 && index.assemblyHash == assemblyHash && index.attributesVersion == mAttributesVersion)
+			cached = loadMembers(*assembly, index);
+
+		if (!cached)
+		{
+			index.assemblyHash = assemblyHash;
+			index.attributesVersion = mAttributesVersion;
+
+			scanAssembly(*assembly, index);
+		}
+
+		index.isLoaded = true;
+
+		UINT32 numResults = 0;
+		for (auto& entry : index.members)
+			numResults += (UINT32)entry.second.size();
+
+		AttributeScanTiming timing;
+		timing.assembly = assemblyName;
+		timing.timeMs = timer.getMicroseconds() / 1000.0f;
+		timing.numResults = numResults;
+		timing.cached = cached;
+
+		mTimings.push_back(timing);
+		return &index;
+	}
+
+	void ScriptAttributeCache::scanAssembly(MonoAssembly& assembly, AssemblyIndex& index)
+	{
+		index.members.clear();
+		index.classes.clear();
+		index.methods.clear();
+
+		Vector<std::pair<String, MonoClass*>> classAttributes;
+		Vector<std::pair<String, MonoClass*>> methodAttributes;
+		for (auto& entry : mAttributes)
+		{
+			// Attribute might be defined in an assembly that isn't loaded
+			MonoClass* attribute = MonoManager::instance().findClass(entry.ns, entry.typeName);
+			if (attribute == nullptr)
+				continue;
+
+			if (entry.target == AttributeTarget::Class)
+				classAttributes.push_back(std::make_pair(attribute->getFullName(), attribute));
+			else
+				methodAttributes.push_back(std::make_pair(attribute->getFullName(), attribute));
+		}
+
+		const Vector<MonoClass*>& allClasses = assembly.getAllClasses();
+		for (auto curClass : allClasses)
+		{
+			for (auto& attribute : classAttributes)
+			{
+				if (!curClass->hasAttribute(attribute.second))
+					continue;
+
+				index.members[attribute.first].push_back({ curClass->getNamespace(), curClass->getTypeName(), "", {} });
+				index.classes[attribute.first].push_back(curClass);
+			}
+
+			if (methodAttributes.empty())
+				continue;
+
+			const Vector<MonoMethod*>& methods = curClass->getAllMethods();
+			for (auto& curMethod : methods)
+			{
+				for (auto& attribute : methodAttributes)
+				{
+					if (!curMethod->hasAttribute(attribute.second))
+						continue;
+
+					index.members[attribute.first].push_back({ curClass->getNamespace(), curClass->getTypeName(),
+						curMethod->getName(), getParameterTypes(curMethod) });
+					index.methods[attribute.first].push_back(curMethod);
+				}
+			}
+		}
+	}
+
+	bool ScriptAttributeCache::loadMembers(MonoAssembly& assembly, AssemblyIndex& index)
+	{
+		index.classes.clear();
+		index.methods.clear();
+
+		for (auto& entry : index.members)
+		{
+			for (auto& member : entry.second)
+			{
+				MonoClass* monoClass = assembly.getClass(member.ns, member.typeName);
+				if (monoClass == nullptr)
+					return false;
+
+				if (member.methodName.empty())
+				{
+					index.classes[entry.first].push_back(monoClass);
+					continue;
+				}
+
+				MonoMethod* monoMethod = findMethod(*monoClass, member);
+				if (monoMethod == nullptr)
+					return false;
+
+				index.methods[entry.first].push_back(monoMethod);
+			}
+		}
+
+		return true;
+	}
+
+	Vector<String> ScriptAttributeCache::getParameterTypes(MonoMethod* method)
+	{
+		UINT32 numParameters = method->getNumParameters();
+
+		Vector<String> parameterTypes(numParameters);
+		for (UINT32 i = 0; i < numParameters; i++)
+		{
+			MonoClass* parameterType = method->getParameterType(i);
+			if (parameterType != nullptr)
+				parameterTypes[i] = parameterType->getFullName();
+		}
+
+		return parameterTypes;
+	}
+
+	MonoMethod* ScriptAttributeCache::findMethod(MonoClass& monoClass, const MemberRef& member)
+	{
+		// Overloads share the name and can share the number of parameters, so match the parameter types as well
+		const Vector<MonoMethod*>& methods = monoClass.getAllMethods();
+		for (auto& method : methods)
+		{
+			if (method->getName() != member.methodName)
+				continue;
+
+			if (method->getNumParameters() != (UINT32)member.parameterTypes.size())
+				continue;
+
+			if (getParameterTypes(method) == member.parameterTypes)
+				return method;
+		}
+
+		return nullptr;
+	}
+
+	UINT64 ScriptAttributeCache::getAssemblyHash(const String& assemblyName)
+	{
+		auto iterFind = mAssemblyHashes.find(assemblyName);
+		if (iterFind != mAssemblyHashes.end())
+			return iterFind->second;
+
+		static constexpr UINT64 FNV_OFFSET = 14695981039346656037ULL;
+		static constexpr UINT64 FNV_PRIME = 1099511628211ULL;
+
+		UINT64 hash = 0;
+
+		Path assemblyPath = mScriptObjectManager.getAssemblyPath(assemblyName);
+		if (!assemblyPath.isEmpty() && FileSystem::isFile(assemblyPath))
+		{
+			SPtr<DataStream> stream = FileSystem::openFile(assemblyPath);
+			if (stream != nullptr)
+			{
+				hash = FNV_OFFSET;
+
+				UINT8 buffer[4096];
+				while (!stream->eof())
+				{
+					size_t numRead = stream->read(buffer, sizeof(buffer));
+					for (size_t i = 0; i < numRead; i++)
+						hash = (hash ^ buffer[i]) * FNV_PRIME;
+				}
+
+				stream->close();
+			}
+		}
+
+		mAssemblyHashes[assemblyName] = hash;
+		return hash;
+	}
+
+	void ScriptAttributeCache::onRefreshStarted()
+	{
+		// Managed types are about to be unloaded, and assemblies might have been recompiled, so indices need to be
+		// validated against the assembly contents again once reloaded
+		mAssemblyHashes.clear();
+
+		for (auto& entry : mIndices)
+		{
+			entry.second.isLoaded = false;
+			entry.second.classes.clear();
+			entry.second.methods.clear();
+		}
+	}
+}
@@ -0,0 +1,160 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsScriptEditorPrerequisites.h"
+#include "Utility/BsModule.h"
+
+namespace bs
+{
+	/** @addtogroup SBansheeEditor
+	 *  @{
+	 */
+
+	/** Determines which kind of members an attribute is searched for on. */
+	enum class AttributeTarget
+	{
+		Class, /**< Attribute is applied to classes or structs. */
+		Method /**< Attribute is applied to methods. */
+	};
+
+	/** Information about indexing of a single assembly. */
+	struct AttributeScanTiming
+	{
+		String assembly; /**< Name of the assembly that was indexed. */
+		float timeMs; /**< Time the indexing took, in milliseconds. */
+		UINT32 numResults; /**< Number of members found to use one of the registered attributes. */
+		bool cached; /**< True if the index from a previous scan was reused, instead of scanning the assembly. */
+	};
+
+	/**
+	 * Finds managed classes and methods marked with attributes used by editor extension points (menu items, toolbar
+	 * items, handles, gizmos, inspectors). Finding them requires going over every method of every type in an assembly,
+	 * so each assembly is scanned once for all registered attributes, and the resulting index is shared by all users.
+	 * The index is reused across assembly reloads for as long as the contents of the assembly file don't change.
+	 */
+	class BS_SCR_BED_EXPORT ScriptAttributeCache : public Module<ScriptAttributeCache>
+	{
+		/** Identifies a managed class or method in a way that remains valid across assembly reloads. */
+		struct MemberRef
+		{
+			String ns;
+			String typeName;
+			String methodName; /**< Empty if referencing a class. */
+			Vector<String> parameterTypes; /**< Full names of the method parameter types, to tell apart overloads. */
+		};
+
+		/** Attribute that assemblies are indexed for. */
+		struct AttributeInfo
+		{
+			String ns;
+			String typeName;
+			AttributeTarget target;
+		};
+
+		/** Members of a single assembly that use one of the registered attributes. */
+		struct AssemblyIndex
+		{
+			UINT64 assemblyHash = 0;
+			UINT32 attributesVersion = 0;
+			UnorderedMap<String, Vector<MemberRef>> members;
+
+			bool isLoaded = false;
+			UnorderedMap<String, Vector<MonoClass*>> classes;
+			UnorderedMap<String, Vector<MonoMethod*>> methods;
+		};
+
+	public:
+		ScriptAttributeCache(ScriptAssemblyManager& scriptObjectManager);
+		~ScriptAttributeCache();
+
+		/**
+		 * Registers an attribute to index assemblies for. All registered attributes are searched for in a single pass
+		 * over an assembly, so attributes should be registered before any lookups are made. Registering an attribute
+		 * after that causes the assemblies to be scanned again on the next lookup.
+		 *
+		 * @param[in]	ns			Namespace of the attribute type.
+		 * @param[in]	typeName	Name of the attribute type.
+		 * @param[in]	target		Kind of members the attribute is applied to.
+		 */
+		void registerAttribute(const String& ns, const String& typeName, AttributeTarget target);
+
+		/**
+		 * Returns all classes in the assembly that are marked with the provided attribute. The attribute must be
+		 * registered with AttributeTarget::Class.
+		 *
+		 * @param[in]	assemblyName	Name of a currently loaded assembly to search.
+		 * @param[in]	attribute		Attribute to search for.
+		 * @return						Classes marked with the attribute, in the order they are defined in.
+		 */
+		Vector<MonoClass*> getClassesWithAttribute(const String& assemblyName, MonoClass* attribute);
+
+		/**
+		 * Returns all methods in the assembly that are marked with the provided attribute. The attribute must be
+		 * registered with AttributeTarget::Method.
+		 *
+		 * @param[in]	assemblyName	Name of a currently loaded assembly to search.
+		 * @param[in]	attribute		Attribute to search for.
+		 * @return						Methods marked with the attribute, in the order they are defined in.
+		 */
+		Vector<MonoMethod*> getMethodsWithAttribute(const String& assemblyName, MonoClass* attribute);
+
+		/** Returns information about all assemblies indexed since the last call to clearTimings(). */
+		const Vector<AttributeScanTiming>& getTimings() const { return mTimings; }
+
+		/** Clears the indexing information returned by getTimings(). */
+		void clearTimings() { mTimings.clear(); }
+
+		/** Logs a report of all assemblies indexed since the last call to clearTimings(), and clears them. */
+		void logTimings();
+
+	private:
+		/**
+		 * Returns the index for the provided assembly, building it if the assembly wasn't indexed since it was last
+		 * loaded. Returns null if the assembly isn't loaded.
+		 */
+		AssemblyIndex* getIndex(const String& assemblyName);
+
+		/** Scans every class and method of the assembly for all registered attributes. */
+		void scanAssembly(MonoAssembly& assembly, AssemblyIndex& index);
+
+		/**
+		 * Looks up the managed members referenced by an index in the currently loaded assembly.
+		 *
+		 * @param[in]	assembly	Assembly to look up the members in.
+		 * @param[in]	index		Index to look up the members for.
+		 * @return					True if all members were found, false otherwise.
+		 */
+		static bool loadMembers(MonoAssembly& assembly, AssemblyIndex& index);
+
+		/** Returns the full names of the parameter types of the provided method. */
+		static Vector<String> getParameterTypes(MonoMethod* method);
+
+		/**
+		 * Finds the method referenced by @p member in the provided class. Returns null if the class has no method with
+		 * the referenced name and parameter types.
+		 */
+		static MonoMethod* findMethod(MonoClass& monoClass, const MemberRef& member);
+
+		/**
+		 * Returns a hash of the contents of the file the assembly was loaded from. Returns zero if the file cannot be
+		 * read, in which case the index of the assembly should not be reused.
+		 */
+		UINT64 getAssemblyHash(const String& assemblyName);
+
+		/** Triggered when the script domain is about to be reloaded. */
+		void onRefreshStarted();
+
+		ScriptAssemblyManager& mScriptObjectManager;
+		HEvent mRefreshStartedConn;
+
+		Vector<AttributeInfo> mAttributes;
+		UINT32 mAttributesVersion = 0;
+
+		UnorderedMap<String, AssemblyIndex> mIndices;
+		UnorderedMap<String, UINT64> mAssemblyHashes;
+		Vector<AttributeScanTiming> mTimings;
+	};
+
+	/** @} */
+}
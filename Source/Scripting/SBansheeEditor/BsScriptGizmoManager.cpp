@@ -2,6 +2,7 @@
 //**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
 #include "BsScriptGizmoManager.h"
 #include "Serialization/BsScriptAssemblyManager.h"
+#include "BsScriptAttributeCache.h"
 #include "BsMonoAssembly.h"
 #include "BsMonoClass.h"
 #include "BsMonoMethod.h"
@@ -45,7 +46,7 @@ namespace bs
 		bool isParentSelected = false;
 		UINT32 parentSelectedPopIdx = 0;
 		
-		Vector<HSceneObject> selectedObjects = Selection::instance().getSceneObjects();
+		const Selection& selection = Selection::instance();
 
 		while (!todo.empty())
 		{
@@ -57,7 +58,7 @@ namespace bs
 			HSceneObject curSO = todo.top();
 			todo.pop();
 
-			bool isSelected = std::count(selectedObjects.begin(), selectedObjects.end(), curSO) > 0;
+			bool isSelected = selection.isSelected(curSO);
 			if (isSelected && !isParentSelected)
 			{
 				isParentSelected = true;
@@ -141,26 +142,21 @@ namespace bs
 		Vector<String> scriptAssemblyNames = mScriptObjectManager.getScriptAssemblies();
 		for (auto& assemblyName : scriptAssemblyNames)
 		{
-			MonoAssembly* assembly = MonoManager::instance().getAssembly(assemblyName);
-
 			// Find new gizmo drawer methods
-			const Vector<MonoClass*>& allClasses = assembly->getAllClasses();
-			for (auto curClass : allClasses)
+			Vector<MonoMethod*> methods =
+				ScriptAttributeCache::instance().getMethodsWithAttribute(assemblyName, mDrawGizmoAttribute);
+			for (auto& curMethod : methods)
 			{
-				const Vector<MonoMethod*>& methods = curClass->getAllMethods();
-				for (auto& curMethod : methods)
+				UINT32 drawGizmoFlags = 0;
+				MonoClass* componentType = nullptr;
+				if (isValidDrawGizmoMethod(curMethod, componentType, drawGizmoFlags))
 				{
-					UINT32 drawGizmoFlags = 0;
-					MonoClass* componentType = nullptr;
-					if (isValidDrawGizmoMethod(curMethod, componentType, drawGizmoFlags))
-					{
-						String fullComponentName = componentType->getFullName();
-						GizmoData& newGizmoData = mGizmoDrawers[fullComponentName];
+					String fullComponentName = componentType->getFullName();
+					GizmoData& newGizmoData = mGizmoDrawers[fullComponentName];
 
-						newGizmoData.componentType = componentType;
-						newGizmoData.drawGizmosMethod = curMethod;
-						newGizmoData.flags = drawGizmoFlags;
-					}
+					newGizmoData.componentType = componentType;
+					newGizmoData.drawGizmosMethod = curMethod;
+					newGizmoData.flags = drawGizmoFlags;
 				}
 			}
 		}
@@ -2,6 +2,7 @@
 //**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
 #include "BsScriptHandleManager.h"
 #include "Serialization/BsScriptAssemblyManager.h"
+#include "BsScriptAttributeCache.h"
 #include "BsMonoManager.h"
 #include "BsMonoAssembly.h"
 #include "BsMonoClass.h"
@@ -50,56 +51,7 @@ namespace bs
 		mGlobalHandlesToCreate.clear();
 
 		// Activate object-specific handles
-		const Vector<HSceneObject>& selectedSOs = Selection::instance().getSceneObjects();
-
-		HSceneObject newSelectedObject;
-		if (selectedSOs.size() > 0)
-		{
-			// We only consider the first selected object for custom handles, multiple selection is not supported
-			newSelectedObject = selectedSOs[0]; 
-		}
-
-		if (newSelectedObject != mActiveHandleData.selectedObject)
-		{
-			for (auto& handle : mActiveHandleData.handles)
-			{
-				callDestroy(handle.object);
-				MonoUtil::freeGCHandle(handle.gcHandle);
-			}
-
-			mActiveHandleData.selectedObject = newSelectedObject;
-			mActiveHandleData.handles.clear();
-
-			if (newSelectedObject)
-			{
-				const Vector<HComponent>& components = newSelectedObject->getComponents();
-
-				for (auto& component : components)
-				{
-					if (!rtti_is_of_type<ManagedComponent>(component.getInternalPtr()))
-						continue;
-
-					HManagedComponent mc = static_object_cast<ManagedComponent>(component);
-					const String& componentTypeName = mc->getManagedFullTypeName();
-
-					auto iterFind = mHandles.find(componentTypeName);
-					if (iterFind == mHandles.end())
-						continue;
-
-					CustomHandleData& handleData = iterFind->second;
-					MonoObject* newHandleInstance = handleData.handleType->createInstance(false);
-
-					void* params[1] = { mc->getManagedInstance() };
-					handleData.ctor->invoke(newHandleInstance, params);
-
-					ActiveCustomHandleData data;
-					data.gcHandle = MonoUtil::newGCHandle(newHandleInstance);
-					data.object = MonoUtil::getObjectFromGCHandle(data.gcHandle);
-
-					mActiveHandleData.handles.push_back(data);
-				}
-			}
-		}
+		updateComponentHandles();
 
 		if (mDefaultHandleManager == nullptr)
 		{
@@ -114,8 +66,8 @@ namespace bs
 		for (auto& handle : mActiveGlobalHandles)
 			callPreInput(handle.object);
 
-		for (auto& handle : mActiveHandleData.handles)
-			callPreInput(handle.object);
+		for (auto& entry : mActiveComponentHandles)
+			callPreInput(entry.handle.object);
 	}
 
 	void ScriptHandleManager::triggerPostInput()
@@ -125,8 +77,8 @@ namespace bs
 		for (auto& handle : mActiveGlobalHandles)
 			callPostInput(handle.object);
 
-		for (auto& handle : mActiveHandleData.handles)
-			callPostInput(handle.object);
+		for (auto& entry : mActiveComponentHandles)
+			callPostInput(entry.handle.object);
 	}
 
 	void ScriptHandleManager::queueDrawCommands()
@@ -136,8 +88,84 @@ namespace bs
 		for (auto& handle : mActiveGlobalHandles)
 			callDraw(handle.object);
 
-		for (auto& handle : mActiveHandleData.handles)
-			callDraw(handle.object);
+		for (auto& entry : mActiveComponentHandles)
+			callDraw(entry.handle.object);
+	}
+
+	void ScriptHandleManager::updateComponentHandles()
+	{
+		// Components can be added to or removed from the selected objects without the selection itself changing, so
+		// compare the selected managed components rather than the selected objects
+		Vector<HManagedComponent> selectedComponents;
+		for (auto& selectedSO : Selection::instance().getSceneObjects())
+		{
+			if (selectedSO.isDestroyed())
+				continue;
+
+			const Vector<HComponent>& components = selectedSO->getComponents();
+			for (auto& component : components)
+			{
+				if (rtti_is_of_type<ManagedComponent>(component.getInternalPtr()))
+					selectedComponents.push_back(static_object_cast<ManagedComponent>(component));
+			}
+		}
+
+		bool selectionChanged = selectedComponents.size() != mSelectedComponentIds.size();
+		for (UINT32 i = 0; !selectionChanged && i < (UINT32)selectedComponents.size(); i++)
+			selectionChanged = selectedComponents[i]->getInstanceId() != mSelectedComponentIds[i];
+
+		if (!selectionChanged)
+			return;
+
+		mSelectedComponentIds.resize(selectedComponents.size());
+		for (UINT32 i = 0; i < (UINT32)selectedComponents.size(); i++)
+			mSelectedComponentIds[i] = selectedComponents[i]->getInstanceId();
+
+		UnorderedMap<UINT64, ActiveCustomHandleData> previousHandles;
+		for (auto& entry : mActiveComponentHandles)
+			previousHandles[entry.componentId] = entry.handle;
+
+		mActiveComponentHandles.clear();
+
+		for (auto& mc : selectedComponents)
+		{
+			UINT64 componentId = mc->getInstanceId();
+
+			// Keep the existing handle if the component was already selected
+			auto iterPrevious = previousHandles.find(componentId);
+			if (iterPrevious != previousHandles.end())
+			{
+				mActiveComponentHandles.push_back({ componentId, iterPrevious->second });
+				previousHandles.erase(iterPrevious);
+
+				continue;
+			}
+
+			const String& componentTypeName = mc->getManagedFullTypeName();
+
+			auto iterFind = mHandles.find(componentTypeName);
+			if (iterFind == mHandles.end())
+				continue;
+
+			CustomHandleData& handleData = iterFind->second;
+			MonoObject* newHandleInstance = handleData.handleType->createInstance(false);
+
+			void* params[1] = { mc->getManagedInstance() };
+			handleData.ctor->invoke(newHandleInstance, params);
+
+			ActiveCustomHandleData data;
+			data.gcHandle = MonoUtil::newGCHandle(newHandleInstance);
+			data.object = MonoUtil::getObjectFromGCHandle(data.gcHandle);
+
+			mActiveComponentHandles.push_back({ componentId, data });
+		}
+
+		// Whatever remains belongs to components that are no longer selected
+		for (auto& entry : previousHandles)
+		{
+			callDestroy(entry.second.object);
+			MonoUtil::freeGCHandle(entry.second.gcHandle);
+		}
 	}
 
 	void ScriptHandleManager::clearAssemblyData()
@@ -152,14 +180,14 @@ namespace bs
 
 		mActiveGlobalHandles.clear();
 
-		for (auto& handle : mActiveHandleData.handles)
+		for (auto& entry : mActiveComponentHandles)
 		{
-			callDestroy(handle.object);
-			MonoUtil::freeGCHandle(handle.gcHandle);
+			callDestroy(entry.handle.object);
+			MonoUtil::freeGCHandle(entry.handle.gcHandle);
 		}
 
-		mActiveHandleData.selectedObject = HSceneObject();
-		mActiveHandleData.handles.clear();
+		mSelectedComponentIds.clear();
+		mActiveComponentHandles.clear();
 
 		if (mDefaultHandleManager != nullptr)
 		{
@@ -196,11 +224,10 @@ namespace bs
 		Vector<String> scriptAssemblyNames = mScriptObjectManager.getScriptAssemblies();
 		for (auto& assemblyName : scriptAssemblyNames)
 		{
-			MonoAssembly* assembly = MonoManager::instance().getAssembly(assemblyName);
-
 			// Find new custom handle types
-			const Vector<MonoClass*>& allClasses = assembly->getAllClasses();
-			for (auto curClass : allClasses)
+			Vector<MonoClass*> handleClasses =
+				ScriptAttributeCache::instance().getClassesWithAttribute(assemblyName, mCustomHandleAttribute);
+			for (auto curClass : handleClasses)
 			{
 				MonoClass* componentType = nullptr;
 				MonoMethod* ctor = nullptr;
@@ -36,13 +36,14 @@ namespace bs
 		};
 
 		/**
-		 * Data about all active managed custom handle objects for a specific scene object. Active handle means its 
-		 * scene object is currently selected and the handle is displayed and can be interacted with.
+		 * Data about an active managed custom handle object for a specific component. The handle remains active for as
+		 * long as the component's scene object is selected, even as other objects are added to or removed from the
+		 * selection.
 		 */
-		struct ActiveCustomHandles
+		struct ActiveComponentHandle
 		{
-			HSceneObject selectedObject;
-			Vector<ActiveCustomHandleData> handles;
+			UINT64 componentId;
+			ActiveCustomHandleData handle;
 		};
 
 	public:
@@ -71,6 +72,14 @@ namespace bs
 		 */
 		void loadAssemblyData();
 
+		/**
+		 * Updates the set of active component-specific handles if the managed components of the selected objects changed
+		 * since the last call, either due to a selection change or due to components being added or removed. Handles for
+		 * components that remain selected are kept as is, handles are only created for newly selected components and only
+		 * destroyed for deselected ones.
+		 */
+		void updateComponentHandles();
+
 		/**
 		 * Checks is the provided type a valid custom handle class. Custom handles must have a [CustomHandle] attribute and
 		 * must implement BansheeEditor.Handle.
@@ -114,7 +123,8 @@ namespace bs
 
 		Map<String, CustomHandleData> mHandles;
 
-		ActiveCustomHandles mActiveHandleData;
+		Vector<UINT64> mSelectedComponentIds;
+		Vector<ActiveComponentHandle> mActiveComponentHandles;
 		Vector<MonoClass*> mGlobalHandlesToCreate;
 		Vector<ActiveCustomHandleData> mActiveGlobalHandles;
 
@@ -2,6 +2,7 @@
 //**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
 #include "BsToolbarItemManager.h"
 #include "Serialization/BsScriptAssemblyManager.h"
+#include "BsScriptAttributeCache.h"
 #include "BsMonoAssembly.h"
 #include "BsMonoClass.h"
 #include "BsMonoMethod.h"
@@ -65,36 +66,31 @@ namespace bs
 		Vector<String> scriptAssemblyNames = mScriptObjectManager.getScriptAssemblies();
 		for (auto& assemblyName : scriptAssemblyNames)
 		{
-			MonoAssembly* assembly = MonoManager::instance().getAssembly(assemblyName);
-
-			// Find new menu item methods
-			const Vector<MonoClass*>& allClasses = assembly->getAllClasses();
-			for (auto curClass : allClasses)
+			// Find new toolbar item methods
+			Vector<MonoMethod*> methods =
+				ScriptAttributeCache::instance().getMethodsWithAttribute(assemblyName, mToolbarItemAttribute);
+			for (auto& curMethod : methods)
 			{
-				const Vector<MonoMethod*>& methods = curClass->getAllMethods();
-				for (auto& curMethod : methods)
+				String name;
+				HSpriteTexture icon;
+				HString tooltip;
+				INT32 priority = 0;
+				bool separator = false;
+				if (parseToolbarItemMethod(curMethod, name, icon, tooltip, priority, separator))
 				{
-					String name;
-					HSpriteTexture icon;
-					HString tooltip;
-					INT32 priority = 0;
-					bool separator = false;
-					if (parseToolbarItemMethod(curMethod, name, icon, tooltip, priority, separator))
-					{
-						std::function<void()> callback = std::bind(&ToolbarItemManager::toolbarItemCallback, curMethod);
-
-						if (separator)
-						{
-							String sepName = "s__" + name;
+					std::function<void()> callback = std::bind(&ToolbarItemManager::toolbarItemCallback, curMethod);
 
-							mainWindow->getMenuBar().addToolBarSeparator(sepName, priority);
-							mToolbarItems.push_back(sepName);
-						}
+					if (separator)
+					{
+						String sepName = "s__" + name;
 
-						GUIContent content(icon, tooltip);
-						mainWindow->getMenuBar().addToolBarButton(name, content, callback, priority);
-						mToolbarItems.push_back(name);
+						mainWindow->getMenuBar().addToolBarSeparator(sepName, priority);
+						mToolbarItems.push_back(sepName);
 					}
+
+					GUIContent content(icon, tooltip);
+					mainWindow->getMenuBar().addToolBarButton(name, content, callback, priority);
+					mToolbarItems.push_back(name);
 				}
 			}
 		}
@@ -12,6 +12,7 @@ set(BS_SBANSHEEEDITOR_INC_NOFILTER
 	"BsToolbarItemManager.h"
 	"BsScriptGizmoManager.h"
 	"BsManagedEditorCommand.h"
+	"BsScriptAttributeCache.h"
 )
 
 set(BS_SBANSHEEEDITOR_SRC_WRAPPERS_GUI
@@ -89,6 +90,7 @@ set(BS_SBANSHEEEDITOR_SRC_NOFILTER
 	"BsEditorScriptLibrary.cpp"
 	"BsToolbarItemManager.cpp"
 	"BsManagedEditorCommand.cpp"
+	"BsScriptAttributeCache.cpp"
 )
 
 set(BS_SBANSHEEEDITOR_INC_WRAPPERS
@@ -7,6 +7,7 @@
 #include "BsMonoUtil.h"
 #include "Wrappers/BsScriptPlatformInfo.h"
 #include "FileSystem/BsFileSystem.h"
+#include "FileSystem/BsDataStream.h"
 #include "Utility/BsIconUtility.h"
 #include "CoreThread/BsCoreThread.h"
 #include "Utility/BsGameSettings.h"
@@ -410,6 +411,38 @@ namespace bs
 
 		FileEncoder fe(mappingPath);
 		fe.encode(resourceMap.get());
+
+		// Save the dependency closure of the main scene, so the game can load all of it in parallel before instantiating
+		if (platformInfo != nullptr && !platformInfo->mainScene.getUUID().empty())
+		{
+			Vector<UUID> preloadList = { platformInfo->mainScene.getUUID() };
+			UnorderedSet<UUID> visited = { platformInfo->mainScene.getUUID() };
+
+			for (UINT32 i = 0; i < (UINT32)preloadList.size(); i++)
+			{
+				Path resourcePath;
+				if (!gResources().getFilePathFromUUID(preloadList[i], resourcePath))
+					continue;
+
+				Vector<UUID> dependencies = gResources().getDependencies(resourcePath);
+				for (auto& entry : dependencies)
+				{
+					if (visited.insert(entry).second)
+						preloadList.push_back(entry);
+				}
+			}
+
+			String preloadListContents;
+			for (auto& entry : preloadList)
+				preloadListContents += entry.toString() + "\n";
+
+			Path preloadListPath = outputPath;
+			preloadListPath.append(BuildManager::PRELOAD_LIST_NAME);
+
+			SPtr<DataStream> stream = FileSystem::createAndOpenFile(preloadListPath);
+			stream->write(preloadListContents.data(), preloadListContents.size());
+			stream->close();
+		}
 	}
 
 	void ScriptBuildManager::internal_CreateStartupSettings(MonoString* buildFolder, ScriptPlatformInfo* info)
@@ -7,6 +7,7 @@
 #include "BsMonoMethod.h"
 #include "BsMonoManager.h"
 #include "BsMonoUtil.h"
+#include "BsMonoArray.h"
 #include "CodeEditor/BsCodeEditor.h"
 
 using namespace std::placeholders;
@@ -58,8 +59,30 @@ namespace bs
 		CodeEditorManager::instance().openFile(filePath, line);
 	}
 
-	void ScriptCodeEditor::internal_SyncSolution()
+	void ScriptCodeEditor::internal_SyncSolution(MonoArray* names, MonoArray* folders, MonoArray* numReferences,
+		MonoArray* references)
 	{
-		CodeEditorManager::instance().syncSolution();
+		ScriptArray namesArray(names);
+		ScriptArray foldersArray(folders);
+		ScriptArray numReferencesArray(numReferences);
+		ScriptArray referencesArray(references);
+
+		// References of all definitions are provided in a single array, in the same order as the definitions
+		UINT32 numDefinitions = namesArray.size();
+		Vector<CodeAssemblyDefinition> definitions(numDefinitions);
+
+		UINT32 referenceIdx = 0;
+		for (UINT32 i = 0; i < numDefinitions; i++)
+		{
+			CodeAssemblyDefinition& definition = definitions[i];
+			definition.name = namesArray.get<String>(i);
+			definition.folder = foldersArray.get<String>(i);
+
+			UINT32 count = numReferencesArray.get<UINT32>(i);
+			for (UINT32 j = 0; j < count; j++)
+				definition.references.push_back(referencesArray.get<String>(referenceIdx++));
+		}
+
+		CodeEditorManager::instance().syncSolution(definitions);
 	}
 }
\ No newline at end of file
@@ -27,7 +27,8 @@ namespace bs
 		static CodeEditorType internal_GetActiveEditor();
 		static MonoArray* internal_GetAvailableEditors();
 		static void internal_OpenFile(MonoString* path, UINT32 line);
-		static void internal_SyncSolution();
+		static void internal_SyncSolution(MonoArray* names, MonoArray* folders, MonoArray* numReferences,
+			MonoArray* references);
 	};
 
 	/** @} */
@@ -8,6 +8,8 @@
 #include "BsEditorApplication.h"
 #include "Library/BsProjectLibrary.h"
 #include "Library/BsProjectResourceMeta.h"
+#include "Library/BsChunkedScene.h"
+#include "Scene/BsPrefabInstanceRegistry.h"
 #include "Scene/BsPrefab.h"
 #include "Scene/BsSceneManager.h"
 #include "EditorWindow/BsEditorWindowManager.h"
@@ -20,6 +22,7 @@
 #include "BsPlayInEditorManager.h"
 #include "Platform/BsPlatform.h"
 #include "BsScriptResourceManager.h"
+#include "BsManagedChangeTracker.h"
 #include "FileSystem/BsFileSystem.h"
 #include "Wrappers/BsScriptPrefab.h"
 
@@ -31,6 +34,8 @@ namespace bs
 	bool ScriptEditorApplication::mRequestAssemblyReload = false;
 	Path ScriptEditorApplication::mProjectLoadPath;
 	HEvent ScriptEditorApplication::OnStatusBarClickedConn;
+	SPtr<ChunkedScene> ScriptEditorApplication::mChunkedScene;
+	bool ScriptEditorApplication::mWasUpdatingPrefabs = false;
 
 	ScriptEditorApplication::OnProjectLoadedThunkDef ScriptEditorApplication::onProjectLoadedThunk;
 	ScriptEditorApplication::OnStatusBarClickedThunkDef ScriptEditorApplication::onStatusBarClickedThunk;
@@ -59,6 +64,9 @@ namespace bs
 		metaData.scriptClass->addInternalCall("Internal_GetScriptGameAssemblyName", (void*)&ScriptEditorApplication::internal_GetScriptGameAssemblyName);
 		metaData.scriptClass->addInternalCall("Internal_GetScriptEditorAssemblyName", (void*)&ScriptEditorApplication::internal_GetScriptEditorAssemblyName);
 		metaData.scriptClass->addInternalCall("Internal_SaveScene", (void*)&ScriptEditorApplication::internal_SaveScene);
+		metaData.scriptClass->addInternalCall("Internal_SaveChunkedScene", (void*)&ScriptEditorApplication::internal_SaveChunkedScene);
+		metaData.scriptClass->addInternalCall("Internal_LoadChunkedScene", (void*)&ScriptEditorApplication::internal_LoadChunkedScene);
+		metaData.scriptClass->addInternalCall("Internal_GetChunkedSceneLoadProgress", (void*)&ScriptEditorApplication::internal_GetChunkedSceneLoadProgress);
 		metaData.scriptClass->addInternalCall("Internal_IsValidProject", (void*)&ScriptEditorApplication::internal_IsValidProject);
 		metaData.scriptClass->addInternalCall("Internal_SaveProject", (void*)&ScriptEditorApplication::internal_SaveProject);
 		metaData.scriptClass->addInternalCall("Internal_LoadProject", (void*)&ScriptEditorApplication::internal_LoadProject);
@@ -90,6 +98,7 @@ namespace bs
 	void ScriptEditorApplication::shutDown()
 	{
 		OnStatusBarClickedConn.disconnect();
+		mChunkedScene = nullptr;
 	}
 
 	void ScriptEditorApplication::update()
@@ -110,6 +119,16 @@ namespace bs
 			ScriptManager::instance().reload();
 			mRequestAssemblyReload = false;
 		}
+
+		if (mChunkedScene != nullptr && mChunkedScene->isLoading())
+			mChunkedScene->loadStep(CHUNKED_SCENE_LOAD_BUDGET_MS);
+
+		// Prefab instances are updated natively over multiple frames, including the frame the queue empties on
+		bool isUpdatingPrefabs = PrefabInstanceRegistry::instance().isUpdating();
+		if (isUpdatingPrefabs || mWasUpdatingPrefabs)
+			ManagedChangeTracker::notifyAllModified();
+
+		mWasUpdatingPrefabs = isUpdatingPrefabs;
 	}
 
 	void ScriptEditorApplication::onStatusBarClicked()
@@ -232,6 +251,9 @@ namespace bs
 	{
 		Path nativePath = MonoUtil::monoToString(path);
 		HSceneObject sceneRoot = gSceneManager().getRootNode();
+
+		// Prefab instances queued for update would otherwise be saved with old prefab data
+		PrefabInstanceRegistry::instance().completeUpdates();
 		
 		SPtr<ProjectResourceMeta> resMeta = gProjectLibrary().findResourceMeta(nativePath);
 		HPrefab scene;
@@ -255,6 +277,39 @@ namespace bs
 		return scriptPrefab->getManagedInstance();
 	}
 
+	UINT32 ScriptEditorApplication::internal_SaveChunkedScene(MonoString* path)
+	{
+		Path nativePath = MonoUtil::monoToString(path);
+		nativePath.makeAbsolute(FileSystem::getWorkingDirectoryPath());
+
+		// Keep the chunked scene the current scene was loaded from, as it knows which chunks belong to which objects
+		if (mChunkedScene == nullptr || mChunkedScene->getFolder() != nativePath)
+			mChunkedScene = bs_shared_ptr_new<ChunkedScene>(nativePath);
+		else if (mChunkedScene->isLoading())
+			mChunkedScene->loadAll();
+
+		PrefabInstanceRegistry::instance().completeUpdates();
+
+		ChunkedSceneSaveStats stats = mChunkedScene->save(gSceneManager().getRootNode());
+		return stats.numChunksWritten;
+	}
+
+	void ScriptEditorApplication::internal_LoadChunkedScene(MonoString* path)
+	{
+		Path nativePath = MonoUtil::monoToString(path);
+
+		mChunkedScene = bs_shared_ptr_new<ChunkedScene>(nativePath);
+		mChunkedScene->beginLoad(gSceneManager().getRootNode());
+	}
+
+	float ScriptEditorApplication::internal_GetChunkedSceneLoadProgress()
+	{
+		if (mChunkedScene == nullptr)
+			return 1.0f;
+
+		return mChunkedScene->getLoadProgress();
+	}
+
 	bool ScriptEditorApplication::internal_IsValidProject(MonoString* path)
 	{
 		Path nativePath = MonoUtil::monoToString(path);
@@ -326,7 +381,10 @@ namespace bs
 	void ScriptEditorApplication::internal_SetIsPlaying(bool value)
 	{
 		if (value)
+		{
+			PrefabInstanceRegistry::instance().completeUpdates();
 			PlayInEditorManager::instance().setState(PlayInEditorState::Playing);
+		}
 		else
 			PlayInEditorManager::instance().setState(PlayInEditorState::Stopped);
 	}
@@ -23,7 +23,7 @@ namespace bs
 		/**	Unregisters internal callbacks. Must be called on scripting system shutdown. */
 		static void shutDown();
 
-		/**	Called every frame. Triggers delayed project load. */
+		/**	Called every frame. Triggers delayed project load and loads chunks of a chunked scene. */
 		 static void update();
 
 	private:
@@ -36,6 +36,11 @@ namespace bs
 		static bool mRequestAssemblyReload;
 		static Path mProjectLoadPath;
 		static HEvent OnStatusBarClickedConn;
+		static SPtr<ChunkedScene> mChunkedScene;
+		static bool mWasUpdatingPrefabs;
+
+		/** Maximum amount of time to spend loading chunks of a chunked scene in a single frame, in milliseconds. */
+		static constexpr float CHUNKED_SCENE_LOAD_BUDGET_MS = 8.0f;
 
 		/************************************************************************/
 		/* 								CLR HOOKS						   		*/
@@ -58,6 +63,9 @@ namespace bs
 		static MonoString* internal_GetScriptGameAssemblyName();
 		static MonoString* internal_GetScriptEditorAssemblyName();
 		static MonoObject* internal_SaveScene(MonoString* path);
+		static UINT32 internal_SaveChunkedScene(MonoString* path);
+		static void internal_LoadChunkedScene(MonoString* path);
+		static float internal_GetChunkedSceneLoadProgress();
 		static bool internal_IsValidProject(MonoString* path);
 		static void internal_SaveProject();
 		static void internal_LoadProject(MonoString* path);
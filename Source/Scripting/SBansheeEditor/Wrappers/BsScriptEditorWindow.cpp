@@ -511,6 +511,13 @@ namespace bs
 		}
 	}
 
+	void ScriptEditorWidget::suspendedUpdate()
+	{
+		// Window contents are still expected to be initialized once the window is opened, even if not visible
+		if (!mIsInitialized)
+			triggerOnInitialize();
+	}
+
 	void ScriptEditorWidget::reloadMonoTypes(MonoClass* windowClass)
 	{
 		MonoMethod* updateMethod = windowClass->getMethod("OnEditorUpdate", 0);
@@ -157,6 +157,9 @@ namespace bs
 		/** @copydoc EditorWidgetBase::update  */
 		void update() override;
 
+		/** @copydoc EditorWidgetBase::suspendedUpdate  */
+		void suspendedUpdate() override;
+
 		/**
 		 * Loads all required mono methods, fields and types required for operation of this object. Must be called after
 		 * construction and after assembly refresh.
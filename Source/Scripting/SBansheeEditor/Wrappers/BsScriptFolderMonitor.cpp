@@ -7,6 +7,8 @@
 #include "BsMonoManager.h"
 #include "BsMonoMethod.h"
 #include "BsMonoUtil.h"
+#include "BsMonoArray.h"
+#include "Utility/BsTime.h"
 
 using namespace std::placeholders;
 
@@ -16,9 +18,10 @@ namespace bs
 	ScriptFolderMonitor::OnModifiedThunkDef ScriptFolderMonitor::OnAddedThunk;
 	ScriptFolderMonitor::OnModifiedThunkDef ScriptFolderMonitor::OnRemovedThunk;
 	ScriptFolderMonitor::OnRenamedThunkDef ScriptFolderMonitor::OnRenamedThunk;
+	ScriptFolderMonitor::OnChangedThunkDef ScriptFolderMonitor::OnChangedThunk;
 
-	ScriptFolderMonitor::ScriptFolderMonitor(MonoObject* instance, FolderMonitor* monitor)
-		:ScriptObject(instance), mMonitor(monitor)
+	ScriptFolderMonitor::ScriptFolderMonitor(MonoObject* instance, FolderMonitor* monitor, bool batchChanges)
+		:ScriptObject(instance), mMonitor(monitor), mBatchChanges(batchChanges)
 	{
 		mGCHandle = MonoUtil::newWeakGCHandle(instance);
 
@@ -47,9 +50,10 @@ namespace bs
 		OnAddedThunk = (OnModifiedThunkDef)metaData.scriptClass->getMethod("Internal_DoOnAdded", 1)->getThunk();
 		OnRemovedThunk = (OnModifiedThunkDef)metaData.scriptClass->getMethod("Internal_DoOnRemoved", 1)->getThunk();
 		OnRenamedThunk = (OnRenamedThunkDef)metaData.scriptClass->getMethod("Internal_DoOnRenamed", 2)->getThunk();
+		OnChangedThunk = (OnChangedThunkDef)metaData.scriptClass->getMethod("Internal_DoOnChanged", 1)->getThunk();
 	}
 
-	void ScriptFolderMonitor::internal_CreateInstance(MonoObject* instance, MonoString* folder)
+	void ScriptFolderMonitor::internal_CreateInstance(MonoObject* instance, MonoString* folder, bool batchChanges)
 	{
 		FolderMonitor* monitor = nullptr;
 		if (folder != nullptr)
@@ -65,7 +69,7 @@ namespace bs
 			monitor->startMonitor(folderPath, true, folderChanges);
 		}
 
-		new (bs_alloc<ScriptFolderMonitor>()) ScriptFolderMonitor(instance, monitor);
+		new (bs_alloc<ScriptFolderMonitor>()) ScriptFolderMonitor(instance, monitor, batchChanges);
 	}
 
 	void ScriptFolderMonitor::internal_Destroy(ScriptFolderMonitor* thisPtr)
@@ -75,6 +79,12 @@ namespace bs
 
 	void ScriptFolderMonitor::onMonitorFileModified(const Path& path)
 	{
+		if (mBatchChanges)
+		{
+			mChangeBatcher.addChange(path, getTimeMs());
+			return;
+		}
+
 		MonoObject* instance = MonoUtil::getObjectFromGCHandle(mGCHandle);
 		MonoString* monoPath = MonoUtil::stringToMono(path.toString());
 		MonoUtil::invokeThunk(OnModifiedThunk, instance, monoPath);
@@ -82,6 +92,12 @@ namespace bs
 
 	void ScriptFolderMonitor::onMonitorFileAdded(const Path& path)
 	{
+		if (mBatchChanges)
+		{
+			mChangeBatcher.addChange(path, getTimeMs());
+			return;
+		}
+
 		MonoObject* instance = MonoUtil::getObjectFromGCHandle(mGCHandle);
 		MonoString* monoPath = MonoUtil::stringToMono(path.toString());
 		MonoUtil::invokeThunk(OnAddedThunk, instance, monoPath);
@@ -89,6 +105,12 @@ namespace bs
 
 	void ScriptFolderMonitor::onMonitorFileRemoved(const Path& path)
 	{
+		if (mBatchChanges)
+		{
+			mChangeBatcher.addChange(path, getTimeMs());
+			return;
+		}
+
 		MonoObject* instance = MonoUtil::getObjectFromGCHandle(mGCHandle);
 		MonoString* monoPath = MonoUtil::stringToMono(path.toString());
 		MonoUtil::invokeThunk(OnRemovedThunk, instance, monoPath);
@@ -96,6 +118,12 @@ namespace bs
 
 	void ScriptFolderMonitor::onMonitorFileRenamed(const Path& from, const Path& to)
 	{
+		if (mBatchChanges)
+		{
+			mChangeBatcher.addRename(from, to, getTimeMs());
+			return;
+		}
+
 		MonoObject* instance = MonoUtil::getObjectFromGCHandle(mGCHandle);
 		MonoString* monoPathFrom = MonoUtil::stringToMono(from.toString());
 		MonoString* monoPathTo = MonoUtil::stringToMono(to.toString());
@@ -106,6 +134,25 @@ namespace bs
 	void ScriptFolderMonitor::update()
 	{
 		mMonitor->_update();
+
+		if (!mBatchChanges)
+			return;
+
+		Vector<Path> changedPaths = mChangeBatcher.update(getTimeMs());
+		if (changedPaths.empty())
+			return;
+
+		ScriptArray changedPathsArray = ScriptArray::create<String>((UINT32)changedPaths.size());
+		for (UINT32 i = 0; i < (UINT32)changedPaths.size(); i++)
+			changedPathsArray.set(i, changedPaths[i].toString());
+
+		MonoObject* instance = MonoUtil::getObjectFromGCHandle(mGCHandle);
+		MonoUtil::invokeThunk(OnChangedThunk, instance, changedPathsArray.getInternal());
+	}
+
+	UINT64 ScriptFolderMonitor::getTimeMs()
+	{
+		return gTime().getTimePrecise() / 1000;
 	}
 
 	void ScriptFolderMonitor::destroy()
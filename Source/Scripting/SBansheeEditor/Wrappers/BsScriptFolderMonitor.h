@@ -6,6 +6,7 @@
 #include "BsScriptObject.h"
 #include "Platform/BsFolderMonitor.h"
 #include "Utility/BsModule.h"
+#include "Library/BsFileChangeBatcher.h"
 
 namespace bs
 {
@@ -13,7 +14,10 @@ namespace bs
 	 *  @{
 	 */
 
-	/**	Interop class between C++ & CLR for FolderMonitor. */
+	/**
+	 * Interop class between C++ & CLR for FolderMonitor. Reports either individual changes as they happen or, if
+	 * batching is enabled, only the changed paths in batches once a burst of changes settles down.
+	 */
 	class BS_SCR_BED_EXPORT ScriptFolderMonitor : public ScriptObject <ScriptFolderMonitor>
 	{
 	public:
@@ -22,10 +26,10 @@ namespace bs
 	private:
 		friend class ScriptFolderMonitorManager;
 
-		ScriptFolderMonitor(MonoObject* instance, FolderMonitor* monitor);
+		ScriptFolderMonitor(MonoObject* instance, FolderMonitor* monitor, bool batchChanges);
 		~ScriptFolderMonitor();
 
-		/**	Updates the native folder monitor. Must be called once per frame. */
+		/**	Updates the native folder monitor and reports any batched changes. Must be called once per frame. */
 		void update();
 
 		/**	Destroys the native folder monitor. */
@@ -43,22 +47,29 @@ namespace bs
 		/**	Triggered when the native folder monitor detects a file has been renamed. */
 		void onMonitorFileRenamed(const Path& from, const Path& to);
 
+		/** Returns the current time in milliseconds, used for timing the batched changes. */
+		static UINT64 getTimeMs();
+
 		FolderMonitor* mMonitor = nullptr;
+		FileChangeBatcher mChangeBatcher;
+		bool mBatchChanges = false;
 		UINT32 mGCHandle = 0;
 
 		/************************************************************************/
 		/* 								CLR HOOKS						   		*/
 		/************************************************************************/
-		static void internal_CreateInstance(MonoObject* instance, MonoString* folder);
+		static void internal_CreateInstance(MonoObject* instance, MonoString* folder, bool batchChanges);
 		static void internal_Destroy(ScriptFolderMonitor* thisPtr);
 
 		typedef void(BS_THUNKCALL *OnModifiedThunkDef) (MonoObject*, MonoString*, MonoException**);
 		typedef void(BS_THUNKCALL *OnRenamedThunkDef) (MonoObject*, MonoString*, MonoString*, MonoException**);
+		typedef void(BS_THUNKCALL *OnChangedThunkDef) (MonoObject*, MonoArray*, MonoException**);
 
 		static OnModifiedThunkDef OnModifiedThunk;
 		static OnModifiedThunkDef OnAddedThunk;
 		static OnModifiedThunkDef OnRemovedThunk;
 		static OnRenamedThunkDef OnRenamedThunk;
+		static OnChangedThunkDef OnChangedThunk;
 	};
 
 	/** @} */
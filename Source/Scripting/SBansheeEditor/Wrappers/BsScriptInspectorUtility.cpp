@@ -7,6 +7,7 @@
 #include "BsMonoAssembly.h"
 #include "BsMonoUtil.h"
 #include "Serialization/BsScriptAssemblyManager.h"
+#include "BsScriptAttributeCache.h"
 #include "BsScriptObjectManager.h"
 #include "Wrappers/BsScriptResource.h"
 #include "Wrappers/BsScriptComponent.h"
@@ -68,11 +69,10 @@ namespace bs
 		Vector<String> scriptAssemblyNames = sam.getScriptAssemblies();
 		for (auto& assemblyName : scriptAssemblyNames)
 		{
-			MonoAssembly* assembly = MonoManager::instance().getAssembly(assemblyName);
-
 			// Find new classes/structs with the custom inspector attribute
-			const Vector<MonoClass*>& allClasses = assembly->getAllClasses();
-			for (auto curClass : allClasses)
+			Vector<MonoClass*> inspectorClasses =
+				ScriptAttributeCache::instance().getClassesWithAttribute(assemblyName, mCustomInspectorAtribute);
+			for (auto curClass : inspectorClasses)
 			{
 				MonoObject* attrib = curClass->getAttribute(mCustomInspectorAtribute);
 				if (attrib == nullptr)
@@ -7,10 +7,12 @@
 #include "Wrappers/BsScriptSceneObject.h"
 #include "Scene/BsSceneObject.h"
 #include "Scene/BsPrefab.h"
+#include "Scene/BsPrefabInstanceRegistry.h"
 #include "Resources/BsResources.h"
 #include "BsMonoUtil.h"
 #include "BsScriptGameObjectManager.h"
 #include "Wrappers/BsScriptPrefab.h"
+#include "BsManagedChangeTracker.h"
 
 namespace bs
 {
@@ -28,6 +30,8 @@ namespace bs
 		metaData.scriptClass->addInternalCall("Internal_GetPrefabUUID", (void*)&ScriptPrefabUtility::internal_GetPrefabUUID);
 		metaData.scriptClass->addInternalCall("Internal_UpdateFromPrefab", (void*)&ScriptPrefabUtility::internal_UpdateFromPrefab);
 		metaData.scriptClass->addInternalCall("Internal_RecordPrefabDiff", (void*)&ScriptPrefabUtility::internal_RecordPrefabDiff);
+		metaData.scriptClass->addInternalCall("Internal_IsUpdating", (void*)&ScriptPrefabUtility::internal_IsUpdating);
+		metaData.scriptClass->addInternalCall("Internal_GetUpdateProgress", (void*)&ScriptPrefabUtility::internal_GetUpdateProgress);
 	}
 
 	void ScriptPrefabUtility::internal_breakPrefab(ScriptSceneObject* soPtr)
@@ -38,12 +42,16 @@ namespace bs
 		soPtr->getNativeSceneObject()->breakPrefabLink();
 	}
 
-	void ScriptPrefabUtility::internal_applyPrefab(ScriptSceneObject* soPtr, ScriptPrefab* prefabPtr)
+	void ScriptPrefabUtility::internal_applyPrefab(ScriptSceneObject* soPtr, ScriptPrefab* prefabPtr,
+		bool updateInstances)
 	{
 		if (ScriptSceneObject::checkIfDestroyed(soPtr))
 			return;
 
-		prefabPtr->getHandle()->update(soPtr->getNativeSceneObject());
+		if (updateInstances)
+			PrefabInstanceRegistry::instance().applyPrefab(soPtr->getNativeSceneObject(), prefabPtr->getHandle());
+		else
+			prefabPtr->getHandle()->update(soPtr->getNativeSceneObject());
 	}
 
 	void ScriptPrefabUtility::internal_revertPrefab(ScriptSceneObject* soPtr)
@@ -52,6 +60,8 @@ namespace bs
 			return;
 
 		PrefabUtility::revertToPrefab(soPtr->getNativeSceneObject());
+
+		ManagedChangeTracker::notifyAllModified();
 	}
 
 	bool ScriptPrefabUtility::internal_hasPrefabLink(ScriptSceneObject* soPtr)
@@ -100,6 +110,8 @@ namespace bs
 
 		if(prefabParent != nullptr)
 			PrefabUtility::updateFromPrefab(prefabParent);
+
+		ManagedChangeTracker::notifyAllModified();
 	}
 
 	void ScriptPrefabUtility::internal_RecordPrefabDiff(ScriptSceneObject* soPtr)
@@ -110,4 +122,14 @@ namespace bs
 		HSceneObject so = soPtr->getNativeSceneObject();
 		PrefabUtility::recordPrefabDiff(so);
 	}
+
+	bool ScriptPrefabUtility::internal_IsUpdating()
+	{
+		return PrefabInstanceRegistry::instance().isUpdating();
+	}
+
+	float ScriptPrefabUtility::internal_GetUpdateProgress()
+	{
+		return PrefabInstanceRegistry::instance().getUpdateProgress();
+	}
 }
\ No newline at end of file
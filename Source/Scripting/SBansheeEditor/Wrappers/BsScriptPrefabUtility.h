@@ -24,13 +24,15 @@ namespace bs
 		/* 								CLR HOOKS						   		*/
 		/************************************************************************/
 		static void internal_breakPrefab(ScriptSceneObject* soPtr);
-		static void internal_applyPrefab(ScriptSceneObject* soPtr, ScriptPrefab* prefabPtr);
+		static void internal_applyPrefab(ScriptSceneObject* soPtr, ScriptPrefab* prefabPtr, bool updateInstances);
 		static void internal_revertPrefab(ScriptSceneObject* soPtr);
 		static bool internal_hasPrefabLink(ScriptSceneObject* soPtr);
 		static MonoObject* internal_getPrefabParent(ScriptSceneObject* soPtr);
 		static void internal_GetPrefabUUID(ScriptSceneObject* soPtr, UUID* uuid);
 		static void internal_UpdateFromPrefab(ScriptSceneObject* soPtr);
 		static void internal_RecordPrefabDiff(ScriptSceneObject* soPtr);
+		static bool internal_IsUpdating();
+		static float internal_GetUpdateProgress();
 	};
 
 	/** @} */
@@ -8,6 +8,7 @@
 #include "Wrappers/BsScriptResource.h"
 #include "Resources/BsResources.h"
 #include "Library/BsProjectResourceMeta.h"
+#include "Library/BsFileChangeBatcher.h"
 #include "BsScriptResourceManager.h"
 #include "Serialization/BsScriptAssemblyManager.h"
 #include "Wrappers/BsScriptImportOptions.h"
@@ -37,6 +38,7 @@ namespace bs
 	void ScriptProjectLibrary::initRuntimeData()
 	{
 		metaData.scriptClass->addInternalCall("Internal_Refresh", (void*)&ScriptProjectLibrary::internal_Refresh);
+		metaData.scriptClass->addInternalCall("Internal_RefreshMany", (void*)&ScriptProjectLibrary::internal_RefreshMany);
 		metaData.scriptClass->addInternalCall("Internal_FinalizeImports", (void*)&ScriptProjectLibrary::internal_FinalizeImports);
 		metaData.scriptClass->addInternalCall("Internal_Create", (void*)&ScriptProjectLibrary::internal_Create);
 		metaData.scriptClass->addInternalCall("Internal_Load", (void*)&ScriptProjectLibrary::internal_Load);
@@ -79,6 +81,33 @@ namespace bs
 		return importCount;
 	}
 
+	UINT32 ScriptProjectLibrary::internal_RefreshMany(MonoArray* paths)
+	{
+		ScriptArray pathArray(paths);
+		UINT32 numPaths = pathArray.size();
+
+		Vector<Path> nativePaths;
+		nativePaths.reserve(numPaths);
+
+		for (UINT32 i = 0; i < numPaths; i++)
+		{
+			Path nativePath = pathArray.get<String>(i);
+			if (!nativePath.isAbsolute())
+				nativePath.makeAbsolute(gProjectLibrary().getResourcesFolder());
+
+			nativePaths.push_back(nativePath);
+		}
+
+		// Check folders with many changed files once, rather than checking each of their files separately
+		Vector<Path> coalescedPaths = FileChangeBatcher::coalesce(nativePaths);
+
+		UINT32 importCount = 0;
+		for (auto& entry : coalescedPaths)
+			importCount += gProjectLibrary().checkForModifications(entry);
+
+		return importCount;
+	}
+
 	void ScriptProjectLibrary::internal_FinalizeImports()
 	{
 		gProjectLibrary()._finishQueuedImports();
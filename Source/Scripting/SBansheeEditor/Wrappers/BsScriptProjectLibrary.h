@@ -65,6 +65,7 @@ namespace bs
 		static OnEntryChangedThunkDef OnEntryImportedThunk;
 
 		static UINT32 internal_Refresh(MonoString* path, bool synchronous);
+		static UINT32 internal_RefreshMany(MonoArray* paths);
 		static void internal_FinalizeImports();
 		static void internal_Create(MonoObject* resource, MonoString* path);
 		static MonoObject* internal_Load(MonoString* path);
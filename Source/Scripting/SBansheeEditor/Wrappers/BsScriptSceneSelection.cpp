@@ -73,11 +73,7 @@ namespace bs
 			{
 				Vector<HSceneObject> selectedSOs = Selection::instance().getSceneObjects();
 
-				auto iterFind = std::find_if(selectedSOs.begin(), selectedSOs.end(),
-					[&](const HSceneObject& obj) { return obj == pickedObject; }
-				);
-
-				if (iterFind == selectedSOs.end())
+				if (!Selection::instance().isSelected(pickedObject))
 					selectedSOs.push_back(pickedObject);
 
 				Selection::instance().setSceneObjects(selectedSOs);
@@ -124,22 +120,13 @@ namespace bs
 		{
 			if (additive) // Append to existing selection
 			{
-				Vector<HSceneObject> selectedSOs = Selection::instance().getSceneObjects();
+				const Selection& selection = Selection::instance();
+				Vector<HSceneObject> selectedSOs = selection.getSceneObjects();
 
-				for (int i = 0; i < (int)pickedObjects.size(); i++)
+				for (auto& pickedObject : pickedObjects)
 				{
-					bool found = false;
-					for (int j = 0; j < (int)selectedSOs.size(); j++)
-					{
-						if (selectedSOs[j] == pickedObjects[i])
-						{
-							found = true;
-							break;
-						}
-					}
-
-					if (!found)
-						selectedSOs.push_back(pickedObjects[i]);
+					if (!selection.isSelected(pickedObject))
+						selectedSOs.push_back(pickedObject);
 				}
 
 				Selection::instance().setSceneObjects(selectedSOs);
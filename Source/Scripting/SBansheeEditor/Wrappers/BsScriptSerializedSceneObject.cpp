@@ -6,6 +6,7 @@
 #include "Wrappers/BsScriptSceneObject.h"
 #include "Scene/BsSceneObject.h"
 #include "Serialization/BsMemorySerializer.h"
+#include "Scene/BsPrefabInstanceRegistry.h"
 
 namespace bs
 {
@@ -114,5 +115,6 @@ namespace bs
 		}
 
 		restored->_instantiate();
+		PrefabInstanceRegistry::instance().registerInstances(restored->getHandle());
 	}
 }
\ No newline at end of file
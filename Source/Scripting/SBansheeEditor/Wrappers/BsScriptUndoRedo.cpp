@@ -17,6 +17,7 @@
 #include "UndoRedo/BsCmdBreakPrefab.h"
 #include "Wrappers/BsScriptPrefab.h"
 #include "BsManagedEditorCommand.h"
+#include "BsManagedChangeTracker.h"
 #include "Scene/BsPrefab.h"
 #include "BsScriptObjectManager.h"
 
@@ -101,12 +102,16 @@ namespace bs
 	{
 		UndoRedo* undoRedo = thisPtr->mUndoRedo != nullptr ? thisPtr->mUndoRedo.get() : UndoRedo::instancePtr();
 		undoRedo->undo();
+
+		ManagedChangeTracker::notifyAllModified();
 	}
 
 	void ScriptUndoRedo::internal_Redo(ScriptUndoRedo* thisPtr)
 	{
 		UndoRedo* undoRedo = thisPtr->mUndoRedo != nullptr ? thisPtr->mUndoRedo.get() : UndoRedo::instancePtr();
 		undoRedo->redo();
+
+		ManagedChangeTracker::notifyAllModified();
 	}
 
 	void ScriptUndoRedo::internal_RegisterCommand(ScriptUndoRedo* thisPtr, ScriptCmdManaged* command)
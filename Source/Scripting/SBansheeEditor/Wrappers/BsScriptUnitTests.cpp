@@ -8,11 +8,34 @@
 #include "Wrappers/BsScriptSceneObject.h"
 #include "Serialization/BsManagedSerializableObject.h"
 #include "Serialization/BsManagedSerializableDiff.h"
+#include "Wrappers/BsScriptManagedComponent.h"
+#include "BsManagedComponent.h"
+#include "BsManagedUpdateBatcher.h"
+#include "BsMonoArray.h"
+#include "Utility/BsTimer.h"
+#include "Wrappers/BsScriptResourceRef.h"
+#include "Wrappers/BsScriptResource.h"
+#include "Scene/BsPrefab.h"
+#include "Resources/BsResources.h"
+#include "FileSystem/BsFileSystem.h"
+#include "Serialization/BsManagedSerializableList.h"
+#include "Serialization/BsManagedSerializableDictionary.h"
+#include "Serialization/BsManagedSerializableObjectInfo.h"
+#include "Serialization/BsScriptAssemblyManager.h"
+#include "BsMonoManager.h"
+#include "BsMonoUtil.h"
+#include "BsMonoAssembly.h"
+#include "BsScriptAttributeCache.h"
+#include "Testing/BsEditorBenchmarks.h"
 
 namespace bs
 {
 	MonoMethod* ScriptUnitTests::RunTestsMethod;
+	MonoMethod* ScriptUnitTests::RunBenchmarksMethod;
+	MonoMethod* ScriptUnitTests::UpdateTestsMethod;
+	bool ScriptUnitTests::testsInProgress = false;
 	SPtr<ManagedSerializableDiff> ScriptUnitTests::tempDiff;
+	EditorBenchmarks* ScriptUnitTests::activeBenchmarks = nullptr;
 
 	ScriptUnitTests::ScriptUnitTests(MonoObject* instance)
 		:ScriptObject(instance)
@@ -23,13 +46,59 @@ namespace bs
 		metaData.scriptClass->addInternalCall("Internal_UT1_GameObjectClone", (void*)&ScriptUnitTests::internal_UT1_GameObjectClone);
 		metaData.scriptClass->addInternalCall("Internal_UT3_GenerateDiff", (void*)&ScriptUnitTests::internal_UT3_GenerateDiff);
 		metaData.scriptClass->addInternalCall("Internal_UT3_ApplyDiff", (void*)&ScriptUnitTests::internal_UT3_ApplyDiff);
+		metaData.scriptClass->addInternalCall("Internal_UT5_BenchmarkUpdate", (void*)&ScriptUnitTests::internal_UT5_BenchmarkUpdate);
+		metaData.scriptClass->addInternalCall("Internal_UT9_CreateResources", (void*)&ScriptUnitTests::internal_UT9_CreateResources);
+		metaData.scriptClass->addInternalCall("Internal_UT9_DeleteResources", (void*)&ScriptUnitTests::internal_UT9_DeleteResources);
+		metaData.scriptClass->addInternalCall("Internal_UT10_BenchmarkCollections", (void*)&ScriptUnitTests::internal_UT10_BenchmarkCollections);
+		metaData.scriptClass->addInternalCall("Internal_UT11_CompareAttributeIndex", (void*)&ScriptUnitTests::internal_UT11_CompareAttributeIndex);
+		metaData.scriptClass->addInternalCall("Internal_UT12_GetResourceRef", (void*)&ScriptUnitTests::internal_UT12_GetResourceRef);
+		metaData.scriptClass->addInternalCall("Internal_AddBenchmarkResult", (void*)&ScriptUnitTests::internal_AddBenchmarkResult);
 
 		RunTestsMethod = metaData.scriptClass->getMethod("RunTests");
+		RunBenchmarksMethod = metaData.scriptClass->getMethod("RunBenchmarks");
+		UpdateTestsMethod = metaData.scriptClass->getMethod("UpdateTests");
+
+		// Tests in progress are lost along with the old domain
+		testsInProgress = false;
 	}
 
 	void ScriptUnitTests::runTests()
 	{
 		RunTestsMethod->invoke(nullptr, nullptr);
+		testsInProgress = true;
+	}
+
+	void ScriptUnitTests::updateTests()
+	{
+		if (!testsInProgress)
+			return;
+
+		// Null if a test failed with an exception, in which case the remaining ones are abandoned
+		MonoObject* inProgress = UpdateTestsMethod->invoke(nullptr, nullptr);
+		testsInProgress = inProgress != nullptr && *(bool*)MonoUtil::unbox(inProgress);
+	}
+
+	void ScriptUnitTests::runBenchmarks(EditorBenchmarks& benchmarks)
+	{
+		activeBenchmarks = &benchmarks;
+		RunBenchmarksMethod->invoke(nullptr, nullptr);
+		activeBenchmarks = nullptr;
+	}
+
+	void ScriptUnitTests::internal_AddBenchmarkResult(MonoString* name, UINT32 count, double ms)
+	{
+		if (activeBenchmarks == nullptr)
+			return;
+
+		EditorBenchmarkResult result;
+		result.name = MonoUtil::monoToString(name);
+		result.count = count;
+		result.numIterations = 1;
+		result.minMs = ms;
+		result.avgMs = ms;
+		result.maxMs = ms;
+
+		activeBenchmarks->addResult(result);
 	}
 
 	void ScriptUnitTests::internal_UT1_GameObjectClone(MonoObject* instance)
@@ -57,4 +126,182 @@ namespace bs
 
 		tempDiff = nullptr;
 	}
+
+	void ScriptUnitTests::internal_UT5_BenchmarkUpdate(MonoArray* components, UINT32 numIterations,
+		double* perComponentMs, double* batchedMs)
+	{
+		ScriptArray componentArray(components);
+
+		Vector<HManagedComponent> nativeComponents;
+		for (UINT32 i = 0; i < componentArray.size(); i++)
+		{
+			ScriptManagedComponent* scriptComponent = ScriptManagedComponent::toNative(componentArray.get<MonoObject*>(i));
+			nativeComponents.push_back(scriptComponent->getHandle());
+		}
+
+		ManagedUpdateBatcher& batcher = ManagedUpdateBatcher::instance();
+		bool wasEnabled = ManagedUpdateBatcher::isEnabled();
+
+		// One managed call per component
+		batcher.setEnabled(false);
+
+		Timer timer;
+		for (UINT32 i = 0; i < numIterations; i++)
+		{
+			for (auto& component : nativeComponents)
+				component->update();
+		}
+
+		*perComponentMs = timer.getMicroseconds() / 1000.0;
+
+		// One managed call per component type
+		batcher.setEnabled(true);
+
+		timer.reset();
+		for (UINT32 i = 0; i < numIterations; i++)
+		{
+			for (auto& component : nativeComponents)
+				component->update();
+
+			batcher.dispatch();
+		}
+
+		*batchedMs = timer.getMicroseconds() / 1000.0;
+
+		batcher.setEnabled(wasEnabled);
+	}
+
+	/** Returns the path of the prefab with the specified index created by internal_UT9_CreateResources(). */
+	static Path getUT9ResourcePath(UINT32 idx)
+	{
+		return Path::combine(FileSystem::getTempDirectoryPath(), "UT9_" + toString(idx) + ".asset");
+	}
+
+	MonoArray* ScriptUnitTests::internal_UT9_CreateResources(UINT32 count)
+	{
+		ScriptArray output = ScriptArray::create<ScriptResourceRef>(count);
+		for (UINT32 i = 0; i < count; i++)
+		{
+			HSceneObject root = SceneObject::create("UT9_" + toString(i));
+
+			// Saved to disk and then released, so loading them must read them back from disk
+			HPrefab prefab = Prefab::create(root);
+			gResources().save(prefab, getUT9ResourcePath(i), true);
+
+			root->destroy();
+
+			output.set(i, ScriptResourceRef::create(prefab.getWeak()));
+			gResources().release(prefab);
+		}
+
+		return output.getInternal();
+	}
+
+	void ScriptUnitTests::internal_UT9_DeleteResources(UINT32 count)
+	{
+		for (UINT32 i = 0; i < count; i++)
+		{
+			Path prefabPath = getUT9ResourcePath(i);
+			if (FileSystem::exists(prefabPath))
+				FileSystem::remove(prefabPath);
+		}
+	}
+
+	void ScriptUnitTests::internal_UT10_BenchmarkCollections(MonoObject* list, MonoObject* dictionary,
+		MonoObject** listCopy, MonoObject** dictionaryCopy, double* perEntryMs, double* bulkMs)
+	{
+		ScriptAssemblyManager& sam = ScriptAssemblyManager::instance();
+
+		MonoClass* listClass = MonoManager::instance().findClass(MonoUtil::getClass(list));
+		SPtr<ManagedSerializableTypeInfoList> listTypeInfo =
+			std::static_pointer_cast<ManagedSerializableTypeInfoList>(sam.getTypeInfo(listClass));
+
+		MonoClass* dictionaryClass = MonoManager::instance().findClass(MonoUtil::getClass(dictionary));
+		SPtr<ManagedSerializableTypeInfoDictionary> dictionaryTypeInfo =
+			std::static_pointer_cast<ManagedSerializableTypeInfoDictionary>(sam.getTypeInfo(dictionaryClass));
+
+		// One managed call per entry, for both reading and writing
+		Timer timer;
+		{
+			SPtr<ManagedSerializableList> source = ManagedSerializableList::createFromExisting(list, listTypeInfo);
+			UINT32 numElements = source->getLength();
+
+			SPtr<ManagedSerializableList> copy = ManagedSerializableList::createNew(listTypeInfo, numElements);
+			for (UINT32 i = 0; i < numElements; i++)
+				copy->setFieldData(i, source->getFieldData(i));
+		}
+
+		{
+			SPtr<ManagedSerializableDictionary> source =
+				ManagedSerializableDictionary::createFromExisting(dictionary, dictionaryTypeInfo);
+			SPtr<ManagedSerializableDictionary> copy = ManagedSerializableDictionary::createNew(dictionaryTypeInfo);
+
+			ManagedSerializableDictionary::Enumerator enumerator = source->getEnumerator();
+			while (enumerator.moveNext())
+			{
+				SPtr<ManagedSerializableFieldData> key = enumerator.getKey();
+				copy->setFieldData(key, source->getFieldData(key));
+			}
+		}
+
+		*perEntryMs = timer.getMicroseconds() / 1000.0;
+
+		// One managed call for all the entries, as done when serializing and deserializing
+		timer.reset();
+
+		SPtr<ManagedSerializableList> serializableList =
+			ManagedSerializableList::createFromExisting(list, listTypeInfo);
+		serializableList->serialize();
+		*listCopy = serializableList->deserialize();
+
+		SPtr<ManagedSerializableDictionary> serializableDictionary =
+			ManagedSerializableDictionary::createFromExisting(dictionary, dictionaryTypeInfo);
+		serializableDictionary->serialize();
+		*dictionaryCopy = serializableDictionary->deserialize();
+
+		*bulkMs = timer.getMicroseconds() / 1000.0;
+	}
+
+	bool ScriptUnitTests::internal_UT11_CompareAttributeIndex(UINT32* numFound)
+	{
+		MonoAssembly* editorAssembly = MonoManager::instance().getAssembly(EDITOR_ASSEMBLY);
+		MonoClass* menuItemAttribute = editorAssembly->getClass("BansheeEditor", "MenuItem");
+		MonoClass* customInspectorAttribute = editorAssembly->getClass("BansheeEditor", "CustomInspector");
+
+		ScriptAttributeCache& attributeCache = ScriptAttributeCache::instance();
+		Vector<MonoMethod*> indexedMethods =
+			attributeCache.getMethodsWithAttribute(EDITOR_ASSEMBLY, menuItemAttribute);
+		Vector<MonoClass*> indexedClasses =
+			attributeCache.getClassesWithAttribute(EDITOR_ASSEMBLY, customInspectorAttribute);
+
+		// Full pass over the assembly, for comparison
+		Vector<MonoMethod*> methods;
+		Vector<MonoClass*> classes;
+
+		const Vector<MonoClass*>& allClasses = editorAssembly->getAllClasses();
+		for (auto curClass : allClasses)
+		{
+			if (curClass->hasAttribute(customInspectorAttribute))
+				classes.push_back(curClass);
+
+			const Vector<MonoMethod*>& allMethods = curClass->getAllMethods();
+			for (auto& curMethod : allMethods)
+			{
+				if (curMethod->hasAttribute(menuItemAttribute))
+					methods.push_back(curMethod);
+			}
+		}
+
+		*numFound = (UINT32)(indexedMethods.size() + indexedClasses.size());
+		return indexedMethods == methods && indexedClasses == classes;
+	}
+
+	MonoObject* ScriptUnitTests::internal_UT12_GetResourceRef(MonoObject* resource)
+	{
+		ScriptResourceBase* scriptResource = ScriptResource::toNative(resource);
+		if (scriptResource == nullptr)
+			return nullptr;
+
+		return ScriptResourceRef::create(scriptResource->getGenericHandle().getWeak());
+	}
 }
\ No newline at end of file
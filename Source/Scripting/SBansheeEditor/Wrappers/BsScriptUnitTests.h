@@ -20,11 +20,24 @@ namespace bs
 		/**	Starts execution of the managed tests. */
 		static void runTests();
 
+		/**
+		 * Advances the managed tests that span multiple frames, if any are still in progress. Must be called once per
+		 * frame.
+		 */
+		static void updateTests();
+
+		/** Runs the managed benchmarks, recording their results in the provided benchmark set. */
+		static void runBenchmarks(EditorBenchmarks& benchmarks);
+
 	private:
 		ScriptUnitTests(MonoObject* instance);
 
 		static MonoMethod* RunTestsMethod;
+		static MonoMethod* RunBenchmarksMethod;
+		static MonoMethod* UpdateTestsMethod;
+		static bool testsInProgress;
 		static SPtr<ManagedSerializableDiff> tempDiff;
+		static EditorBenchmarks* activeBenchmarks;
 
 		/************************************************************************/
 		/* 								CLR HOOKS						   		*/
@@ -32,6 +45,15 @@ namespace bs
 		static void internal_UT1_GameObjectClone(MonoObject* instance);
 		static void internal_UT3_GenerateDiff(MonoObject* oldObj, MonoObject* newObj);
 		static void internal_UT3_ApplyDiff(MonoObject* obj);
+		static void internal_UT5_BenchmarkUpdate(MonoArray* components, UINT32 numIterations, double* perComponentMs,
+			double* batchedMs);
+		static MonoArray* internal_UT9_CreateResources(UINT32 count);
+		static void internal_UT9_DeleteResources(UINT32 count);
+		static void internal_UT10_BenchmarkCollections(MonoObject* list, MonoObject* dictionary, MonoObject** listCopy,
+			MonoObject** dictionaryCopy, double* perEntryMs, double* bulkMs);
+		static bool internal_UT11_CompareAttributeIndex(UINT32* numFound);
+		static MonoObject* internal_UT12_GetResourceRef(MonoObject* resource);
+		static void internal_AddBenchmarkResult(MonoString* name, UINT32 count, double ms);
 	};
 
 	/** @} */
@@ -12,16 +12,24 @@
 #include "Wrappers/BsScriptVirtualInput.h"
 #include "BsScriptObjectManager.h"
 #include "Resources/BsGameResourceManager.h"
+#include "Resources/BsResources.h"
+#include "Resources/BsResourceManifest.h"
+#include "Serialization/BsFileSerializer.h"
 #include "BsApplication.h"
 #include "FileSystem/BsFileSystem.h"
+#include "FileSystem/BsDataStream.h"
 #include "Wrappers/BsScriptDebug.h"
 #include "Wrappers/GUI/BsScriptGUI.h"
 #include "BsPlayInEditorManager.h"
+#include "BsManagedProfiler.h"
+#include "BsManagedUpdateBatcher.h"
 #include "Wrappers/BsScriptScene.h"
 #include "GUI/BsGUIManager.h"
 
 namespace bs
 {
+	const char* EngineScriptLibrary::SCRIPT_ASSEMBLY_MANIFEST_NAME = "ScriptAssemblies.manifest";
+
 	EngineScriptLibrary::EngineScriptLibrary()
 		:mScriptAssembliesLoaded(false)
 	{ }
@@ -31,7 +39,7 @@ namespace bs
 		for (auto assembly : assemblies)
 		{
 			MonoManager::instance().loadAssembly(assembly.second.toString(), assembly.first);
-			ScriptAssemblyManager::instance().loadAssemblyInfo(assembly.first);
+			ScriptAssemblyManager::instance().loadAssemblyInfo(assembly.first, assembly.second);
 		}
 	}
 
@@ -56,6 +64,45 @@ namespace bs
 		}
 	}
 
+	void EngineScriptLibrary::addScriptAssemblies(const Path& folder, Vector<std::pair<String, Path>>& assemblies)
+	{
+		if (folder.isEmpty())
+			return;
+
+		Path manifestPath = folder;
+		manifestPath.append(SCRIPT_ASSEMBLY_MANIFEST_NAME);
+
+		if (!FileSystem::exists(manifestPath))
+			return;
+
+		SPtr<DataStream> stream = FileSystem::openFile(manifestPath);
+		if (stream == nullptr)
+			return;
+
+		// Each line is "<name>\t<kind>\t<signature>", written by the script compiler in dependency order. Only 
+		// assemblies compiled from assembly definitions are added, as the game and editor script assemblies are loaded
+		// separately.
+		Vector<String> lines = StringUtil::split(stream->getAsString(), "\n");
+		for (auto& line : lines)
+		{
+			Vector<String> columns = StringUtil::split(line, "\t");
+			if (columns.size() < 2)
+				continue;
+
+			StringUtil::trim(columns[0]);
+			StringUtil::trim(columns[1]);
+
+			if (columns[1] != "Definition")
+				continue;
+
+			Path assemblyPath = folder;
+			assemblyPath.append(columns[0] + ".dll");
+
+			if (FileSystem::exists(assemblyPath))
+				assemblies.push_back({ columns[0], assemblyPath });
+		}
+	}
+
 	void EngineScriptLibrary::initialize()
 	{
 		Path engineAssemblyPath = gApplication().getEngineAssemblyPath();
@@ -65,9 +112,11 @@ namespace bs
 		MonoAssembly& bansheeEngineAssembly = MonoManager::instance().loadAssembly(engineAssemblyPath.toString(), ENGINE_ASSEMBLY);
 
 		PlayInEditorManager::startUp();
+		ManagedProfiler::startUp();
 		ScriptDebug::startUp();
 		GameResourceManager::startUp();
 		ScriptObjectManager::startUp();
+		ManagedUpdateBatcher::startUp();
 		ManagedResourceManager::startUp();
 		ScriptAssemblyManager::startUp();
 		ScriptResourceManager::startUp();
@@ -77,13 +126,20 @@ namespace bs
 		ScriptVirtualInput::startUp();
 		ScriptGUI::startUp();
 
-		ScriptAssemblyManager::instance().loadAssemblyInfo(ENGINE_ASSEMBLY);
+		if (!gApplication().isEditor())
+			setUpGameResources();
+
+		ScriptAssemblyManager::instance().loadAssemblyInfo(ENGINE_ASSEMBLY, engineAssemblyPath);
+
+		Vector<std::pair<String, Path>> scriptAssemblies;
+		addScriptAssemblies(gApplication().getScriptAssemblyFolder(), scriptAssemblies);
+		loadOtherAssemblies(scriptAssemblies);
 
 		Path gameAssemblyPath = gApplication().getGameAssemblyPath();
 		if (FileSystem::exists(gameAssemblyPath))
 		{
 			MonoManager::instance().loadAssembly(gameAssemblyPath.toString(), SCRIPT_GAME_ASSEMBLY);
-			ScriptAssemblyManager::instance().loadAssemblyInfo(SCRIPT_GAME_ASSEMBLY);
+			ScriptAssemblyManager::instance().loadAssemblyInfo(SCRIPT_GAME_ASSEMBLY, gameAssemblyPath);
 		}
 
 		
@@ -102,6 +158,7 @@ namespace bs
 		{
 			Vector<std::pair<String, Path>> assemblies;
 			assemblies.push_back({ ENGINE_ASSEMBLY, engineAssemblyPath });
+			addScriptAssemblies(gApplication().getScriptAssemblyFolder(), assemblies);
 
 			if (FileSystem::exists(gameAssemblyPath))
 				assemblies.push_back({ SCRIPT_GAME_ASSEMBLY, gameAssemblyPath });
@@ -118,12 +175,16 @@ namespace bs
 		else // Otherwise just additively load them
 		{
 			MonoManager::instance().loadAssembly(engineAssemblyPath.toString(), ENGINE_ASSEMBLY);
-			ScriptAssemblyManager::instance().loadAssemblyInfo(ENGINE_ASSEMBLY);
+			ScriptAssemblyManager::instance().loadAssemblyInfo(ENGINE_ASSEMBLY, engineAssemblyPath);
+
+			Vector<std::pair<String, Path>> scriptAssemblies;
+			addScriptAssemblies(gApplication().getScriptAssemblyFolder(), scriptAssemblies);
+			loadOtherAssemblies(scriptAssemblies);
 
 			if (FileSystem::exists(gameAssemblyPath))
 			{
 				MonoManager::instance().loadAssembly(gameAssemblyPath.toString(), SCRIPT_GAME_ASSEMBLY);
-				ScriptAssemblyManager::instance().loadAssemblyInfo(SCRIPT_GAME_ASSEMBLY);
+				ScriptAssemblyManager::instance().loadAssemblyInfo(SCRIPT_GAME_ASSEMBLY, gameAssemblyPath);
 			}
 			
 			if (FileSystem::exists(gameResourcesPath))
@@ -147,6 +208,7 @@ namespace bs
 	void EngineScriptLibrary::unloadAssemblies()
 	{
 		ManagedResourceManager::instance().clear();
+		ManagedUpdateBatcher::instance().clear();
 		MonoManager::instance().unloadScriptDomain();
 		ScriptObjectManager::instance().processFinalizedObjects();
 	}
@@ -162,12 +224,38 @@ namespace bs
 		ScriptGameObjectManager::shutDown();
 		ScriptResourceManager::shutDown();
 		ScriptAssemblyManager::shutDown();
+		ManagedUpdateBatcher::shutDown();
 		ScriptObjectManager::shutDown();
 		GameResourceManager::shutDown();
 		ScriptDebug::shutDown();
+		ManagedProfiler::shutDown();
 		PlayInEditorManager::shutDown();
 
 		// Make sure all GUI elements are actually destroyed
 		GUIManager::instance().processDestroyQueue();
 	}
+
+	void EngineScriptLibrary::setUpGameResources()
+	{
+		Path resourcesPath = Paths::getGameResourcesPath();
+
+		Path resourceMappingPath = resourcesPath + GAME_RESOURCE_MAPPING_NAME;
+		if (FileSystem::exists(resourceMappingPath))
+		{
+			FileDecoder mappingFd(resourceMappingPath);
+			SPtr<ResourceMapping> resMapping = std::static_pointer_cast<ResourceMapping>(mappingFd.decode());
+
+			GameResourceManager::instance().setMapping(resMapping);
+		}
+
+		Path resourceManifestPath = resourcesPath + GAME_RESOURCE_MANIFEST_NAME;
+		if (FileSystem::exists(resourceManifestPath))
+		{
+			Path resourceRoot = resourcesPath;
+			resourceRoot.makeParent(); // Remove /Resources entry, as we expect all resources to be relative to that path
+
+			SPtr<ResourceManifest> manifest = ResourceManifest::load(resourceManifestPath, resourceRoot);
+			gResources().registerResourceManifest(manifest);
+		}
+	}
 }
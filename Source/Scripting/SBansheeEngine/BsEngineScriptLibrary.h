@@ -23,6 +23,13 @@ namespace bs
 		/**	Adds the all assemblies in folder and subfolders to assemblies. */
 		void addOtherAssemblies(const Path& path, Vector<std::pair<String, Path>>& assemblies);
 
+		/**
+		 * Adds the assemblies compiled from assembly definition files in the project, as listed in the script assembly
+		 * manifest in the provided folder. Assemblies are added in dependency order. Does nothing if the folder has no
+		 * manifest.
+		 */
+		void addScriptAssemblies(const Path& folder, Vector<std::pair<String, Path>>& assemblies);
+
 		/** @copydoc ScriptLibrary::initialize */
 		void initialize() override;
 
@@ -39,7 +46,16 @@ namespace bs
 		/** Shuts down all script engine modules. */
 		void shutdownModules();
 
+		/**
+		 * Registers the resource manifest and the resource mapping of a packaged game, if running outside of the editor.
+		 * Done before any script code runs, so scripts can load resources during start-up.
+		 */
+		void setUpGameResources();
+
 	private:
+		/** Name of the file that lists the compiled script assemblies, in the script assembly folder. */
+		static const char* SCRIPT_ASSEMBLY_MANIFEST_NAME;
+
 		bool mScriptAssembliesLoaded;
 	};
 
@@ -0,0 +1,37 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsManagedChangeTracker.h"
+
+namespace bs
+{
+	UnorderedMap<UINT64, UINT64> ManagedChangeTracker::sVersions;
+	UINT64 ManagedChangeTracker::sGlobalVersion = 0;
+	UINT64 ManagedChangeTracker::sLastVersion = 0;
+
+	void ManagedChangeTracker::notifyModified(UINT64 instanceId)
+	{
+		// Entries of destroyed components are never removed, so instead just drop all of them once there are too many.
+		// Bumping the global version ensures no component reports the same version it did before.
+		if (sVersions.size() >= MAX_TRACKED_OBJECTS)
+		{
+			sVersions.clear();
+			sGlobalVersion = ++sLastVersion;
+		}
+
+		sVersions[instanceId] = ++sLastVersion;
+	}
+
+	void ManagedChangeTracker::notifyAllModified()
+	{
+		sGlobalVersion = ++sLastVersion;
+	}
+
+	UINT64 ManagedChangeTracker::getVersion(UINT64 instanceId)
+	{
+		auto iterFind = sVersions.find(instanceId);
+		if (iterFind != sVersions.end())
+			return std::max(iterFind->second, sGlobalVersion);
+
+		return sGlobalVersion;
+	}
+}
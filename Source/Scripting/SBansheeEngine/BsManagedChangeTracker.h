@@ -0,0 +1,49 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsScriptEnginePrerequisites.h"
+
+namespace bs
+{
+	/** @addtogroup SBansheeEngine
+	 *  @{
+	 */
+
+	/**
+	 * Keeps a version counter for each managed component whose fields were modified through the serialization layer
+	 * (e.g. SerializableField). Versions are used for detecting if a component changed without reading all of its
+	 * fields, allowing tools like the inspector to avoid refreshing unchanged components.
+	 *
+	 * Modifications that can't be attributed to a single component (e.g. undo/redo, or writes into nested objects)
+	 * increment a global version, which is included in the version of every component.
+	 *
+	 * @note	Fields written directly from managed code, bypassing the serialization layer, are not tracked.
+	 * @note	Sim thread only.
+	 */
+	class BS_SCR_BE_EXPORT ManagedChangeTracker
+	{
+	public:
+		/** Notifies the tracker that fields of the component with the provided instance ID were modified. */
+		static void notifyModified(UINT64 instanceId);
+
+		/** Notifies the tracker that any component might have been modified. */
+		static void notifyAllModified();
+
+		/**
+		 * Returns the current version of the component with the provided instance ID. If the version is the same as one
+		 * returned by a previous call, the component was not modified in the meantime.
+		 */
+		static UINT64 getVersion(UINT64 instanceId);
+
+	private:
+		/** Maximum number of per-component versions to keep before they are discarded in favor of the global version. */
+		static constexpr UINT32 MAX_TRACKED_OBJECTS = 65536;
+
+		static UnorderedMap<UINT64, UINT64> sVersions;
+		static UINT64 sGlobalVersion;
+		static UINT64 sLastVersion;
+	};
+
+	/** @} */
+}
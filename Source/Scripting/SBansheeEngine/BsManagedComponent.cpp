@@ -13,6 +13,8 @@
 #include "Wrappers/BsScriptManagedComponent.h"
 #include "BsMonoAssembly.h"
 #include "BsPlayInEditorManager.h"
+#include "BsManagedProfiler.h"
+#include "BsManagedUpdateBatcher.h"
 
 namespace bs
 {
@@ -131,6 +133,7 @@ namespace bs
 	{
 		mOwner = owner;
 		mFullTypeName = mNamespace + "." + mTypeName;
+		mProfilerTypeId = ManagedProfiler::instance().registerType(mFullTypeName);
 		
 		MonoObject* instance = owner->getManagedInstance();
 		mManagedClass = nullptr;
@@ -229,6 +232,9 @@ namespace bs
 				break;
 		}
 
+		if (mOnUpdateThunk != nullptr)
+			mUpdateGroupId = ManagedUpdateBatcher::instance().registerType(mRuntimeType, mProfilerTypeId);
+
 		if (mManagedClass != nullptr)
 		{
 			MonoAssembly* bansheeEngineAssembly = MonoManager::instance().getAssembly(ENGINE_ASSEMBLY);
@@ -290,8 +296,17 @@ namespace bs
 	{
 		if (mOnUpdateThunk != nullptr)
 		{
+			// Defer the call so it can be executed together with all other components of the same type
+			if (ManagedUpdateBatcher::isEnabled())
+			{
+				ManagedUpdateBatcher::instance().queue(mUpdateGroupId, mOwner->getHandle());
+				return;
+			}
+
 			MonoObject* instance = mOwner->getManagedInstance();
 
+			ManagedProfilerSample sample(ManagedCallback::OnUpdate, getInstanceId(), mProfilerTypeId);
+
 			// Note: Not calling virtual methods. Can be easily done if needed but for now doing this
 			// for some extra speed.
 			MonoUtil::invokeThunk(mOnUpdateThunk, instance);
@@ -304,6 +319,8 @@ namespace bs
 		{
 			MonoObject* instance = mOwner->getManagedInstance();
 
+			ManagedProfilerSample sample(ManagedCallback::OnFixedUpdate, getInstanceId(), mProfilerTypeId);
+
 			// Note: Not calling virtual methods. Can be easily done if needed but for now doing this
 			// for some extra speed.
 			MonoUtil::invokeThunk(mOnFixedUpdateThunk, instance);
@@ -316,6 +333,8 @@ namespace bs
 		{
 			MonoObject* instance = mOwner->getManagedInstance();
 
+			ManagedProfilerSample sample(ManagedCallback::OnReset, getInstanceId(), mProfilerTypeId);
+
 			// Note: Not calling virtual methods. Can be easily done if needed but for now doing this
 			// for some extra speed.
 			MonoUtil::invokeThunk(mOnResetThunk, instance);
@@ -371,6 +390,8 @@ namespace bs
 
 		if (mOnCreatedThunk != nullptr)
 		{
+			ManagedProfilerSample sample(ManagedCallback::OnCreated, getInstanceId(), mProfilerTypeId);
+
 			// Note: Not calling virtual methods. Can be easily done if needed but for now doing this
 			// for some extra speed.
 			MonoUtil::invokeThunk(mOnCreatedThunk, instance);
@@ -385,6 +406,8 @@ namespace bs
 		{
 			MonoObject* instance = mOwner->getManagedInstance();
 
+			ManagedProfilerSample sample(ManagedCallback::OnInitialized, getInstanceId(), mProfilerTypeId);
+
 			// Note: Not calling virtual methods. Can be easily done if needed but for now doing this
 			// for some extra speed.
 			MonoUtil::invokeThunk(mOnInitializedThunk, instance);
@@ -399,6 +422,8 @@ namespace bs
 		{
 			MonoObject* instance = mOwner->getManagedInstance();
 
+			ManagedProfilerSample sample(ManagedCallback::OnDestroyed, getInstanceId(), mProfilerTypeId);
+
 			// Note: Not calling virtual methods. Can be easily done if needed but for now doing this
 			// for some extra speed.
 			MonoUtil::invokeThunk(mOnDestroyThunk, instance);
@@ -411,6 +436,8 @@ namespace bs
 		{
 			MonoObject* instance = mOwner->getManagedInstance();
 
+			ManagedProfilerSample sample(ManagedCallback::OnEnabled, getInstanceId(), mProfilerTypeId);
+
 			// Note: Not calling virtual methods. Can be easily done if needed but for now doing this
 			// for some extra speed.
 			MonoUtil::invokeThunk(mOnEnabledThunk, instance);
@@ -423,6 +450,8 @@ namespace bs
 		{
 			MonoObject* instance = mOwner->getManagedInstance();
 
+			ManagedProfilerSample sample(ManagedCallback::OnDisabled, getInstanceId(), mProfilerTypeId);
+
 			// Note: Not calling virtual methods. Can be easily done if needed but for now doing this
 			// for some extra speed.
 			MonoUtil::invokeThunk(mOnDisabledThunk, instance);
@@ -435,6 +464,8 @@ namespace bs
 		{
 			MonoObject* instance = mOwner->getManagedInstance();
 
+			ManagedProfilerSample sample(ManagedCallback::OnTransformChanged, getInstanceId(), mProfilerTypeId);
+
 			// Note: Not calling virtual methods. Can be easily done if needed but for now doing this
 			// for some extra speed.
 			MonoUtil::invokeThunk(mOnTransformChangedThunk, instance, flags);
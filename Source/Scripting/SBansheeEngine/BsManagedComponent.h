@@ -92,6 +92,8 @@ namespace bs
 		String mNamespace;
 		String mTypeName;
 		String mFullTypeName;
+		UINT32 mProfilerTypeId = 0;
+		UINT32 mUpdateGroupId = 0;
 		bool mRequiresReset = true;
 
 		bool mMissingType = false;
@@ -0,0 +1,226 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsManagedProfiler.h"
+#include "Wrappers/BsScriptManagedProfiler.h"
+#include "FileSystem/BsFileSystem.h"
+#include "FileSystem/BsDataStream.h"
+#include "Utility/BsTime.h"
+
+namespace bs
+{
+	bool ManagedProfiler::sEnabled = false;
+
+	/** Names of ManagedCallback entries, as output in the trace file. */
+	static const char* CALLBACK_NAMES[] =
+	{
+		"OnCreate", "OnInitialize", "OnUpdate", "OnFixedUpdate", "OnReset", "OnDestroy", "OnEnable", "OnDisable",
+		"OnTransformChanged"
+	};
+
+	static_assert(sizeof(CALLBACK_NAMES) / sizeof(CALLBACK_NAMES[0]) == (UINT32)ManagedCallback::Count,
+		"Callback name array doesn't match the number of callbacks.");
+
+	ManagedProfiler::ManagedProfiler(UINT32 numFrames)
+		:mStartTime(std::chrono::high_resolution_clock::now()), mFrames(std::max(numFrames, 1U))
+	{
+		resetCurrentFrame();
+	}
+
+	ManagedProfiler::~ManagedProfiler()
+	{
+		sEnabled = false;
+	}
+
+	void ManagedProfiler::setEnabled(bool enabled)
+	{
+		if (sEnabled == enabled)
+			return;
+
+		sEnabled = enabled;
+
+		// Start with a clean frame so partial samples from before the toggle don't get reported
+		resetCurrentFrame();
+	}
+
+	const ManagedFrameSample& ManagedProfiler::getFrame(UINT32 idx) const
+	{
+		assert(idx < mNumFrames);
+
+		UINT32 numFrames = (UINT32)mFrames.size();
+		UINT32 frameIdx = (mNextFrame + numFrames - 1 - idx) % numFrames;
+
+		return mFrames[frameIdx];
+	}
+
+	UINT32 ManagedProfiler::registerType(const String& fullTypeName)
+	{
+		auto iterFind = mTypeLookup.find(fullTypeName);
+		if (iterFind != mTypeLookup.end())
+			return iterFind->second;
+
+		UINT32 typeId = (UINT32)mTypeNames.size();
+		mTypeNames.push_back(fullTypeName);
+		mTypeLookup[fullTypeName] = typeId;
+
+		return typeId;
+	}
+
+	void ManagedProfiler::clear()
+	{
+		for (auto& frame : mFrames)
+			frame = ManagedFrameSample();
+
+		mNextFrame = 0;
+		mNumFrames = 0;
+
+		resetCurrentFrame();
+	}
+
+	UINT64 ManagedProfiler::_getTime() const
+	{
+		auto elapsed = std::chrono::high_resolution_clock::now() - mStartTime;
+		return (UINT64)std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+	}
+
+	UINT64 ManagedProfiler::_getManagedHeapSize() const
+	{
+		if (!mTrackAllocations)
+			return 0;
+
+		return ScriptManagedProfiler::getManagedHeapSize();
+	}
+
+	void ManagedProfiler::_addSample(ManagedCallback callback, UINT64 instanceId, UINT32 typeId, UINT64 start,
+		UINT64 end, UINT64 gcAllocated)
+	{
+		UINT64 duration = end - start;
+
+		if (typeId >= (UINT32)mCurrentFrame.types.size())
+		{
+			UINT32 oldSize = (UINT32)mCurrentFrame.types.size();
+			mCurrentFrame.types.resize(typeId + 1);
+
+			for (UINT32 i = oldSize; i < (UINT32)mCurrentFrame.types.size(); i++)
+				mCurrentFrame.types[i].typeId = i;
+		}
+
+		ManagedTypeSample& typeSample = mCurrentFrame.types[typeId];
+		typeSample.numCalls++;
+		typeSample.time += duration;
+		typeSample.gcAllocated += gcAllocated;
+
+		if (mCaptureEvents)
+			mCurrentFrame.events.push_back({ instanceId, typeId, callback, start, duration });
+
+		// Samples not belonging to a single instance only contribute to the type
+		if (instanceId == 0)
+			return;
+
+		auto iterFind = mCurrentInstanceLookup.find(instanceId);
+		if (iterFind == mCurrentInstanceLookup.end())
+		{
+			UINT32 instanceIdx = (UINT32)mCurrentFrame.instances.size();
+			mCurrentFrame.instances.push_back(ManagedInstanceSample());
+
+			ManagedInstanceSample& instanceSample = mCurrentFrame.instances.back();
+			instanceSample.instanceId = instanceId;
+			instanceSample.typeId = typeId;
+
+			iterFind = mCurrentInstanceLookup.insert(std::make_pair(instanceId, instanceIdx)).first;
+		}
+
+		ManagedInstanceSample& instanceSample = mCurrentFrame.instances[iterFind->second];
+		instanceSample.numCalls++;
+		instanceSample.time += duration;
+		instanceSample.gcAllocated += gcAllocated;
+	}
+
+	void ManagedProfiler::_update()
+	{
+		if (!sEnabled)
+			return;
+
+		// Only keep types that were actually called this frame
+		Vector<ManagedTypeSample>& types = mCurrentFrame.types;
+		types.erase(std::remove_if(types.begin(), types.end(),
+			[](const ManagedTypeSample& x) { return x.numCalls == 0; }), types.end());
+
+		mCurrentFrame.duration = _getTime() - mCurrentFrame.start;
+
+		// Swap instead of copying, so the storage of the frame falling out of the ring buffer gets re-used
+		std::swap(mFrames[mNextFrame], mCurrentFrame);
+
+		mNextFrame = (mNextFrame + 1) % (UINT32)mFrames.size();
+		mNumFrames = std::min(mNumFrames + 1, (UINT32)mFrames.size());
+
+		resetCurrentFrame();
+	}
+
+	void ManagedProfiler::resetCurrentFrame()
+	{
+		mCurrentFrame.frameIdx = gTime().getFrameIdx();
+		mCurrentFrame.start = _getTime();
+		mCurrentFrame.duration = 0;
+		mCurrentFrame.types.clear();
+		mCurrentFrame.instances.clear();
+		mCurrentFrame.events.clear();
+
+		mCurrentInstanceLookup.clear();
+	}
+
+	void ManagedProfiler::saveTrace(const Path& path) const
+	{
+		StringStream output;
+		output << "{\"traceEvents\":[\n";
+
+		bool first = true;
+		auto writeSeparator = [&first, &output]()
+		{
+			if (!first)
+				output << ",\n";
+
+			first = false;
+		};
+
+		// Chrome trace timestamps are in microseconds
+		auto toMicroseconds = [](UINT64 ns) { return ns / 1000.0; };
+
+		for (INT32 i = (INT32)mNumFrames - 1; i >= 0; i--)
+		{
+			const ManagedFrameSample& frame = getFrame((UINT32)i);
+
+			writeSeparator();
+			output << "{\"name\":\"Frame " << frame.frameIdx << "\",\"cat\":\"frame\",\"ph\":\"X\",\"pid\":0,\"tid\":0,"
+				<< "\"ts\":" << toMicroseconds(frame.start) << ",\"dur\":" << toMicroseconds(frame.duration) << "}";
+
+			if (!frame.events.empty())
+			{
+				for (auto& event : frame.events)
+				{
+					writeSeparator();
+					output << "{\"name\":\"" << mTypeNames[event.typeId] << "." << CALLBACK_NAMES[(UINT32)event.callback]
+						<< "\",\"cat\":\"script\",\"ph\":\"X\",\"pid\":0,\"tid\":1,"
+						<< "\"ts\":" << toMicroseconds(event.start) << ",\"dur\":" << toMicroseconds(event.duration)
+						<< ",\"args\":{\"instance\":" << event.instanceId << "}}";
+				}
+			}
+			else
+			{
+				for (auto& type : frame.types)
+				{
+					writeSeparator();
+					output << "{\"name\":\"" << mTypeNames[type.typeId] << "\",\"cat\":\"script\",\"ph\":\"C\",\"pid\":0,"
+						<< "\"ts\":" << toMicroseconds(frame.start) << ",\"args\":{\"calls\":" << type.numCalls
+						<< ",\"time_us\":" << toMicroseconds(type.time) << ",\"gc_bytes\":" << type.gcAllocated << "}}";
+				}
+			}
+		}
+
+		output << "\n]}\n";
+
+		String outputStr = output.str();
+		SPtr<DataStream> stream = FileSystem::createAndOpenFile(path);
+		stream->write(outputStr.c_str(), outputStr.size() * sizeof(String::value_type));
+		stream->close();
+	}
+}
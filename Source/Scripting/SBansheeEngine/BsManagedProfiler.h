@@ -0,0 +1,227 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsScriptEnginePrerequisites.h"
+#include "Utility/BsModule.h"
+#include <chrono>
+
+namespace bs
+{
+	/** @addtogroup SBansheeEngine
+	 *  @{
+	 */
+
+	/** Types of managed component callbacks tracked by the ManagedProfiler. */
+	enum class ManagedCallback
+	{
+		OnCreated,
+		OnInitialized,
+		OnUpdate,
+		OnFixedUpdate,
+		OnReset,
+		OnDestroyed,
+		OnEnabled,
+		OnDisabled,
+		OnTransformChanged,
+		Count // Keep at end
+	};
+
+	/** Accumulated statistics for all callbacks of a single managed component type, during a single frame. */
+	struct ManagedTypeSample
+	{
+		UINT32 typeId = 0;
+		UINT32 numCalls = 0;
+		UINT64 time = 0; /**< Inclusive time, in nanoseconds. */
+		UINT64 gcAllocated = 0; /**< Approximate number of bytes allocated on the managed heap. */
+	};
+
+	/** Accumulated statistics for all callbacks of a single managed component instance, during a single frame. */
+	struct ManagedInstanceSample
+	{
+		UINT64 instanceId = 0;
+		UINT32 typeId = 0;
+		UINT32 numCalls = 0;
+		UINT64 time = 0; /**< Inclusive time, in nanoseconds. */
+		UINT64 gcAllocated = 0; /**< Approximate number of bytes allocated on the managed heap. */
+	};
+
+	/** Information about a single managed callback invocation. Only recorded if event capture is enabled. */
+	struct ManagedCallbackEvent
+	{
+		UINT64 instanceId;
+		UINT32 typeId;
+		ManagedCallback callback;
+		UINT64 start; /**< Time at which the callback started, in nanoseconds since profiler start-up. */
+		UINT64 duration; /**< Duration of the callback, in nanoseconds. */
+	};
+
+	/** All profiling information recorded during a single frame. */
+	struct ManagedFrameSample
+	{
+		UINT64 frameIdx = 0;
+		UINT64 start = 0; /**< Time at which the frame started, in nanoseconds since profiler start-up. */
+		UINT64 duration = 0; /**< Duration of the frame, in nanoseconds. */
+		Vector<ManagedTypeSample> types;
+		Vector<ManagedInstanceSample> instances;
+		Vector<ManagedCallbackEvent> events;
+	};
+
+	/**
+	 * Measures call counts, inclusive time and managed heap allocations of managed component callbacks (e.g.
+	 * OnUpdate). Samples are accumulated per component type and per component instance, and stored per frame in a ring
+	 * buffer of fixed size. Profiling is disabled by default, in which case the only overhead is a single flag check per
+	 * callback.
+	 */
+	class BS_SCR_BE_EXPORT ManagedProfiler : public Module<ManagedProfiler>
+	{
+	public:
+		/**
+		 * Constructs the profiler.
+		 *
+		 * @param[in]	numFrames	Number of most recent frames to keep the samples for.
+		 */
+		ManagedProfiler(UINT32 numFrames = 300);
+		~ManagedProfiler();
+
+		/** Checks is the profiler currently recording samples. */
+		static bool isEnabled() { return sEnabled; }
+
+		/** Starts or stops recording of samples. */
+		void setEnabled(bool enabled);
+
+		/**
+		 * Determines should managed heap allocations be tracked for each callback. This requires an additional managed call
+		 * per callback and therefore has higher overhead than just timing.
+		 */
+		void setTrackAllocations(bool track) { mTrackAllocations = track; }
+
+		/** @copydoc setTrackAllocations */
+		bool getTrackAllocations() const { return mTrackAllocations; }
+
+		/**
+		 * Determines should information about each individual callback invocation be recorded, in addition to the
+		 * accumulated per-type and per-instance samples. Required for detailed trace output from saveTrace().
+		 */
+		void setCaptureEvents(bool capture) { mCaptureEvents = capture; }
+
+		/** @copydoc setCaptureEvents */
+		bool getCaptureEvents() const { return mCaptureEvents; }
+
+		/** Returns the number of frames currently stored in the ring buffer. */
+		UINT32 getNumFrames() const { return mNumFrames; }
+
+		/**
+		 * Returns samples for a previously recorded frame.
+		 *
+		 * @param[in]	idx		Index of the frame, where 0 is the most recent frame. Must be less than getNumFrames().
+		 */
+		const ManagedFrameSample& getFrame(UINT32 idx) const;
+
+		/** Returns the name of a managed type registered through registerType(). */
+		const String& getTypeName(UINT32 typeId) const { return mTypeNames[typeId]; }
+
+		/**
+		 * Returns a unique identifier for the provided managed type name, used for identifying the type in samples. Always
+		 * returns the same identifier for the same name.
+		 */
+		UINT32 registerType(const String& fullTypeName);
+
+		/** Removes all recorded frames. */
+		void clear();
+
+		/**
+		 * Saves all recorded frames into a file in the Chrome trace event format (viewable in chrome://tracing). If event
+		 * capture is enabled individual callbacks are output, otherwise per-frame counters for each type are output.
+		 */
+		void saveTrace(const Path& path) const;
+
+		/** @name Internal
+		 *  @{
+		 */
+
+		/** Returns the current time in nanoseconds since profiler start-up. */
+		UINT64 _getTime() const;
+
+		/** Returns the current managed heap size, or 0 if allocation tracking is disabled. */
+		UINT64 _getManagedHeapSize() const;
+
+		/**
+		 * Records a sample for a single callback invocation. Only valid to call if the profiler is enabled. If
+		 * @p instanceId is zero the sample is only recorded for the type.
+		 */
+		void _addSample(ManagedCallback callback, UINT64 instanceId, UINT32 typeId, UINT64 start, UINT64 end,
+			UINT64 gcAllocated);
+
+		/** Ends the current frame and moves its samples into the ring buffer. Must be called once per frame. */
+		void _update();
+
+		/** @} */
+	private:
+		/** Resets the accumulation buffers for the current frame. */
+		void resetCurrentFrame();
+
+		static bool sEnabled;
+
+		bool mTrackAllocations = false;
+		bool mCaptureEvents = false;
+		std::chrono::high_resolution_clock::time_point mStartTime;
+
+		Vector<ManagedFrameSample> mFrames;
+		UINT32 mNextFrame = 0;
+		UINT32 mNumFrames = 0;
+
+		ManagedFrameSample mCurrentFrame;
+		UnorderedMap<UINT64, UINT32> mCurrentInstanceLookup;
+
+		Vector<String> mTypeNames;
+		UnorderedMap<String, UINT32> mTypeLookup;
+	};
+
+	/**
+	 * Helper class that records a ManagedProfiler sample for the duration of its lifetime, if the profiler is enabled.
+	 * Should be constructed on the stack around a managed callback invocation.
+	 */
+	class BS_SCR_BE_EXPORT ManagedProfilerSample
+	{
+	public:
+		ManagedProfilerSample(ManagedCallback callback, UINT64 instanceId, UINT32 typeId)
+			:mEnabled(ManagedProfiler::isEnabled())
+		{
+			if (!mEnabled)
+				return;
+
+			mCallback = callback;
+			mInstanceId = instanceId;
+			mTypeId = typeId;
+
+			ManagedProfiler& profiler = ManagedProfiler::instance();
+			mHeapSize = profiler._getManagedHeapSize();
+			mStart = profiler._getTime();
+		}
+
+		~ManagedProfilerSample()
+		{
+			if (!mEnabled)
+				return;
+
+			ManagedProfiler& profiler = ManagedProfiler::instance();
+			UINT64 end = profiler._getTime();
+			UINT64 heapSize = profiler._getManagedHeapSize();
+
+			// Heap size can go down if a collection happened during the callback
+			UINT64 gcAllocated = heapSize > mHeapSize ? heapSize - mHeapSize : 0;
+			profiler._addSample(mCallback, mInstanceId, mTypeId, mStart, end, gcAllocated);
+		}
+
+	private:
+		bool mEnabled;
+		ManagedCallback mCallback = ManagedCallback::OnUpdate;
+		UINT64 mInstanceId = 0;
+		UINT32 mTypeId = 0;
+		UINT64 mStart = 0;
+		UINT64 mHeapSize = 0;
+	};
+
+	/** @} */
+}
@@ -0,0 +1,146 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsManagedUpdateBatcher.h"
+#include "BsManagedComponent.h"
+#include "BsManagedProfiler.h"
+#include "BsMonoManager.h"
+#include "BsMonoClass.h"
+#include "BsMonoMethod.h"
+#include "BsMonoUtil.h"
+#include "BsMonoArray.h"
+#include "BsScriptObjectManager.h"
+#include "Wrappers/BsScriptManagedComponent.h"
+
+namespace bs
+{
+	bool ManagedUpdateBatcher::sEnabled = false;
+
+	ManagedUpdateBatcher::ManagedUpdateBatcher()
+	{
+		mRefreshStartedConn = ScriptObjectManager::instance().onRefreshStarted.connect(
+			std::bind(&ManagedUpdateBatcher::clear, this));
+	}
+
+	ManagedUpdateBatcher::~ManagedUpdateBatcher()
+	{
+		mRefreshStartedConn.disconnect();
+		clear();
+
+		sEnabled = false;
+	}
+
+	void ManagedUpdateBatcher::setEnabled(bool enabled)
+	{
+		if (sEnabled == enabled)
+			return;
+
+		if (!enabled)
+			dispatch();
+
+		sEnabled = enabled;
+	}
+
+	UINT32 ManagedUpdateBatcher::registerType(MonoReflectionType* type, UINT32 profilerTypeId)
+	{
+		auto iterFind = mGroupLookup.find(type);
+		if (iterFind != mGroupLookup.end())
+			return iterFind->second;
+
+		UINT32 groupId = (UINT32)mGroups.size();
+		mGroups.push_back(UpdateGroup());
+		mGroups.back().type = type;
+		mGroups.back().profilerTypeId = profilerTypeId;
+
+		mGroupLookup[type] = groupId;
+		return groupId;
+	}
+
+	void ManagedUpdateBatcher::queue(UINT32 groupId, const HManagedComponent& component)
+	{
+		assert(groupId < (UINT32)mGroups.size());
+
+		mGroups[groupId].queued.push_back(component);
+	}
+
+	void ManagedUpdateBatcher::dispatch()
+	{
+		mNumDispatchCalls = 0;
+
+		if (mUpdateBatchThunk == nullptr)
+		{
+			MonoMethod* updateBatchMethod = ScriptManagedComponent::getMetaData()->scriptClass->getMethod(
+				"Internal_UpdateBatch", 3);
+
+			if (updateBatchMethod == nullptr)
+				return;
+
+			mUpdateBatchThunk = (UpdateBatchThunkDef)updateBatchMethod->getThunk();
+		}
+
+		::MonoClass* componentClass = ScriptManagedComponent::getMetaData()->scriptClass->_getInternalClass();
+
+		// Note: Using an index since managed updates can create new components, registering new groups
+		for (UINT32 i = 0; i < (UINT32)mGroups.size(); i++)
+		{
+			UpdateGroup& group = mGroups[i];
+			if (group.queued.empty())
+				continue;
+
+			// Re-use the same managed array every frame, only growing it when needed
+			UINT32 numQueued = (UINT32)group.queued.size();
+			if (numQueued > group.arrayCapacity)
+			{
+				if (group.arrayHandle != 0)
+					MonoUtil::freeGCHandle(group.arrayHandle);
+
+				UINT32 newCapacity = std::max(numQueued, group.arrayCapacity * 2);
+				ScriptArray newArray(componentClass, newCapacity);
+
+				group.arrayHandle = MonoUtil::newGCHandle((MonoObject*)newArray.getInternal(), false);
+				group.arrayCapacity = newCapacity;
+			}
+
+			ScriptArray array((MonoArray*)MonoUtil::getObjectFromGCHandle(group.arrayHandle));
+
+			UINT32 numValid = 0;
+			for (auto& component : group.queued)
+			{
+				// Component could have been destroyed since it was queued
+				if (component.isDestroyed())
+					continue;
+
+				array.set(numValid++, component->getManagedInstance());
+			}
+
+			group.queued.clear();
+
+			if (numValid == 0)
+				continue;
+
+			{
+				// Time is only attributed to the type, since the instances are updated in a single call
+				ManagedProfilerSample sample(ManagedCallback::OnUpdate, 0, group.profilerTypeId);
+				MonoUtil::invokeThunk(mUpdateBatchThunk, group.type, array.getInternal(), (INT32)numValid);
+			}
+
+			mNumDispatchCalls++;
+
+			// Release the references so the array doesn't keep the components alive
+			for (UINT32 j = 0; j < numValid; j++)
+				array.set(j, (MonoObject*)nullptr);
+		}
+	}
+
+	void ManagedUpdateBatcher::clear()
+	{
+		for (auto& group : mGroups)
+		{
+			if (group.arrayHandle != 0)
+				MonoUtil::freeGCHandle(group.arrayHandle);
+		}
+
+		mGroups.clear();
+		mGroupLookup.clear();
+		mUpdateBatchThunk = nullptr;
+	}
+}
@@ -0,0 +1,82 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsScriptEnginePrerequisites.h"
+#include "Utility/BsModule.h"
+
+namespace bs
+{
+	/** @addtogroup SBansheeEngine
+	 *  @{
+	 */
+
+	/**
+	 * Optional dispatch mode for managed component OnUpdate callbacks. When enabled, ManagedComponent::update() doesn't
+	 * call into managed code directly, but instead queues the component into a group belonging to its managed type. Once
+	 * per frame all the queued components of a type are passed to managed code in a single call, reducing the number of
+	 * native to managed transitions from one per component to one per component type.
+	 *
+	 * @note
+	 * Since the managed callbacks are deferred until the queue is processed, they no longer run interleaved with the
+	 * native component updates. Disabled by default.
+	 */
+	class BS_SCR_BE_EXPORT ManagedUpdateBatcher : public Module<ManagedUpdateBatcher>
+	{
+	public:
+		ManagedUpdateBatcher();
+		~ManagedUpdateBatcher();
+
+		/** Checks is batched dispatch of updates currently enabled. */
+		static bool isEnabled() { return sEnabled; }
+
+		/** Enables or disables batched dispatch. Any currently queued updates are dispatched when disabling. */
+		void setEnabled(bool enabled);
+
+		/**
+		 * Returns a unique identifier of the update group for the provided managed type. Components of the same type
+		 * should be queued in the same group.
+		 *
+		 * @param[in]	type			Managed type of the components in the group.
+		 * @param[in]	profilerTypeId	Identifier of the type as registered with the ManagedProfiler.
+		 */
+		UINT32 registerType(MonoReflectionType* type, UINT32 profilerTypeId);
+
+		/** Queues the provided component for an update, to be executed on the next call to dispatch(). */
+		void queue(UINT32 groupId, const HManagedComponent& component);
+
+		/** Triggers OnUpdate for all components queued since the last call, one managed call per component type. */
+		void dispatch();
+
+		/** Returns the number of managed calls made during the last call to dispatch(). */
+		UINT32 getNumDispatchCalls() const { return mNumDispatchCalls; }
+
+		/** Releases all managed objects held by the batcher. Must be called before the script domain is unloaded. */
+		void clear();
+
+	private:
+		/** Contains all queued components of a single managed type. */
+		struct UpdateGroup
+		{
+			MonoReflectionType* type = nullptr;
+			UINT32 profilerTypeId = 0;
+			Vector<HManagedComponent> queued;
+
+			UINT32 arrayHandle = 0; /**< GC handle to a re-usable managed array of components. */
+			UINT32 arrayCapacity = 0;
+		};
+
+		typedef void(BS_THUNKCALL *UpdateBatchThunkDef) (MonoReflectionType*, MonoArray*, INT32, MonoException**);
+
+		static bool sEnabled;
+
+		Vector<UpdateGroup> mGroups;
+		UnorderedMap<MonoReflectionType*, UINT32> mGroupLookup;
+		UINT32 mNumDispatchCalls = 0;
+
+		UpdateBatchThunkDef mUpdateBatchThunk = nullptr;
+		HEvent mRefreshStartedConn;
+	};
+
+	/** @} */
+}
@@ -2,6 +2,7 @@
 //**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
 #include "BsPlayInEditorManager.h"
 #include "BsScriptGameObjectManager.h"
+#include "Wrappers/BsScriptPrefab.h"
 #include "Utility/BsTime.h"
 #include "Scene/BsSceneManager.h"
 #include "Scene/BsSceneObject.h"
@@ -56,6 +57,7 @@ namespace bs
 			gSceneManager().setComponentState(ComponentState::Stopped);
 			mSavedScene->_instantiate();
 			gSceneManager().setRootNode(mSavedScene);
+			ScriptPrefab::onInstantiated(mSavedScene);
 
 			mSavedScene = nullptr;
 		}
@@ -5,7 +5,11 @@
 #include "BsEngineScriptLibrary.h"
 #include "Script/BsScriptManager.h"
 #include "Wrappers/GUI/BsScriptGUI.h"
+#include "Wrappers/BsScriptDebug.h"
 #include "BsPlayInEditorManager.h"
+#include "BsManagedProfiler.h"
+#include "BsManagedUpdateBatcher.h"
+#include "Wrappers/BsScriptAsyncResourceLoad.h"
 
 namespace bs
 {
@@ -26,7 +30,11 @@ namespace bs
 	extern "C" BS_SCR_BE_EXPORT void updatePlugin()
 	{
 		PlayInEditorManager::instance().update();
+		ManagedUpdateBatcher::instance().dispatch();
 		ScriptObjectManager::instance().update();
 		ScriptGUI::update();
+		ScriptDebug::update();
+		ScriptAsyncResourceLoad::update();
+		ManagedProfiler::instance()._update();
 	}
 }
\ No newline at end of file
@@ -62,7 +62,7 @@ namespace bs
 		for (auto& assemblyPair : assemblies)
 		{
 			MonoManager::instance().loadAssembly(assemblyPair.second.toString(), assemblyPair.first);
-			ScriptAssemblyManager::instance().loadAssemblyInfo(assemblyPair.first);
+			ScriptAssemblyManager::instance().loadAssemblyInfo(assemblyPair.first, assemblyPair.second);
 		}
 
 		Vector<ScriptObjectBase*> scriptObjCopy(mScriptObjects.size()); // Store originals as we could add new objects during the next iteration
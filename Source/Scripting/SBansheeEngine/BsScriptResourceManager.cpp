@@ -9,6 +9,12 @@
 #include "Resources/BsResource.h"
 #include "Wrappers/BsScriptManagedResource.h"
 #include "Serialization/BsScriptAssemblyManager.h"
+#include "Image/BsTexture.h"
+#include "Image/BsPixelUtil.h"
+#include "Mesh/BsMesh.h"
+#include "RenderAPI/BsVertexDataDesc.h"
+#include "BsApplication.h"
+#include "BsScriptObjectManager.h"
 
 using namespace std::placeholders;
 
@@ -17,11 +23,17 @@ namespace bs
 	ScriptResourceManager::ScriptResourceManager()
 	{
 		mResourceDestroyedConn = gResources().onResourceDestroyed.connect(std::bind(&ScriptResourceManager::onResourceDestroyed, this, _1));
+		mRefreshStartedConn = ScriptObjectManager::instance().onRefreshStarted.connect(
+			std::bind(&ScriptResourceManager::clearPins, this));
 	}
 
 	ScriptResourceManager::~ScriptResourceManager()
 	{
 		mResourceDestroyedConn.disconnect();
+		mRefreshStartedConn.disconnect();
+
+		// Release the pinned handles while the resource system is still running
+		mPinnedResources.clear();
 	}
 
 	ScriptManagedResource* ScriptResourceManager::createManagedScriptResource(const HManagedResource& resource, MonoObject* instance)
@@ -100,6 +112,144 @@ namespace bs
 		mScriptResources.erase(uuid);
 	}
 
+	void ScriptResourceManager::pinResource(const WeakResourceHandle<Resource>& resource, const String& reason)
+	{
+		const UUID& uuid = resource.getUUID();
+		if (uuid.empty())
+			return;
+
+		PinnedResource& pinnedResource = mPinnedResources[uuid];
+		if (pinnedResource.reasons.empty())
+		{
+			ResourceLoadFlags loadFlags = ResourceLoadFlag::LoadDependencies;
+			if (gApplication().isEditor())
+				loadFlags |= ResourceLoadFlag::KeepSourceData;
+
+			// Holding on to the handle keeps the resource loaded, so no internal reference is required
+			pinnedResource.handle = gResources().loadFromUUID(uuid, true, loadFlags);
+		}
+
+		pinnedResource.reasons.push_back(reason);
+	}
+
+	void ScriptResourceManager::unpinResource(const UUID& uuid, const String& reason)
+	{
+		auto iterFind = mPinnedResources.find(uuid);
+		if (iterFind == mPinnedResources.end())
+			return;
+
+		Vector<String>& reasons = iterFind->second.reasons;
+		auto iterFindReason = std::find(reasons.begin(), reasons.end(), reason);
+		if (iterFindReason == reasons.end())
+			return;
+
+		reasons.erase(iterFindReason);
+		if (reasons.empty())
+			mPinnedResources.erase(iterFind);
+	}
+
+	bool ScriptResourceManager::isPinned(const UUID& uuid) const
+	{
+		return mPinnedResources.find(uuid) != mPinnedResources.end();
+	}
+
+	void ScriptResourceManager::clearPins()
+	{
+		mPinnedResources.clear();
+	}
+
+	String ScriptResourceManager::getResidencyReport() const
+	{
+		// Sorted by UUID so the report is stable between calls
+		Map<String, std::pair<HResource, String>> entries;
+		for (auto& entry : mPinnedResources)
+		{
+			String reasons;
+			for (auto& reason : entry.second.reasons)
+				reasons += (reasons.empty() ? "pinned: " : ", ") + reason;
+
+			entries[entry.first.toString()] = std::make_pair(entry.second.handle, reasons);
+		}
+
+		for (auto& entry : mScriptResources)
+		{
+			std::pair<HResource, String>& reportEntry = entries[entry.first.toString()];
+			if (reportEntry.first.getUUID().empty())
+				reportEntry.first = entry.second->getGenericHandle();
+
+			if (!reportEntry.second.empty())
+				reportEntry.second += "; ";
+
+			reportEntry.second += "referenced by a managed object";
+		}
+
+		UINT64 totalBytes = 0;
+		UINT32 numLoaded = 0;
+		String report;
+		for (auto& entry : entries)
+		{
+			const HResource& resource = entry.second.first;
+			bool isLoaded = resource.isLoaded(false);
+
+			UINT64 numBytes = isLoaded ? getMemoryUsage(resource.get()) : 0;
+			totalBytes += numBytes;
+
+			String name = isLoaded ? resource->getName() : String();
+			if (name.empty())
+				name = entry.first;
+
+			if (isLoaded)
+				numLoaded++;
+
+			report += "\n  " + name + (isLoaded ? "" : " (loading)") + ": " + toString(numBytes / 1024) + " KB, " +
+				entry.second.second;
+		}
+
+		return "Resident resources: " + toString(numLoaded) + " loaded, " + toString((UINT32)entries.size()) +
+			" tracked, " + toString(totalBytes / 1024) + " KB" + report;
+	}
+
+	UINT64 ScriptResourceManager::getMemoryUsage(const Resource* resource)
+	{
+		if (resource == nullptr)
+			return 0;
+
+		if (resource->getTypeId() == TID_Texture)
+		{
+			const TextureProperties& props = static_cast<const Texture*>(resource)->getProperties();
+
+			UINT32 width = props.getWidth();
+			UINT32 height = props.getHeight();
+			UINT32 depth = props.getDepth();
+
+			UINT64 numBytes = 0;
+			for (UINT32 i = 0; i <= props.getNumMipmaps(); i++)
+			{
+				numBytes += PixelUtil::getMemorySize(width, height, depth, props.getFormat());
+
+				width = std::max(1U, width / 2);
+				height = std::max(1U, height / 2);
+				depth = std::max(1U, depth / 2);
+			}
+
+			return numBytes * props.getNumFaces();
+		}
+
+		if (resource->getTypeId() == TID_Mesh)
+		{
+			const Mesh* mesh = static_cast<const Mesh*>(resource);
+			const MeshProperties& props = mesh->getProperties();
+
+			// Index size isn't exposed, so 32-bit indices are assumed
+			UINT64 numBytes = (UINT64)props.getNumVertices() * mesh->getVertexDesc()->getVertexStride();
+			numBytes += (UINT64)props.getNumIndices() * sizeof(UINT32);
+
+			return numBytes;
+		}
+
+		return 0;
+	}
+
 	void ScriptResourceManager::onResourceDestroyed(const UUID& UUID)
 	{
 		auto findIter = mScriptResources.find(UUID);
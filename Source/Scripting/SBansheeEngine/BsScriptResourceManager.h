@@ -69,15 +69,59 @@ namespace bs
 		 */
 		void destroyScriptResource(ScriptResourceBase* resource);
 
+		/**
+		 * Keeps the resource loaded until it is unpinned, starting a load in the background if it isn't loaded already.
+		 * A resource can be pinned multiple times for different reasons, and remains loaded until all of them are
+		 * unpinned.
+		 *
+		 * @param[in]	resource	Resource to pin.
+		 * @param[in]	reason		Description of why the resource needs to stay loaded. Reported by
+		 *							getResidencyReport(), and used for identifying the pin when unpinning.
+		 */
+		void pinResource(const WeakResourceHandle<Resource>& resource, const String& reason);
+
+		/** Removes a pin added by pinResource() with the same reason. Does nothing if no such pin exists. */
+		void unpinResource(const UUID& uuid, const String& reason);
+
+		/** Checks has the resource with the specified UUID been pinned for at least one reason. */
+		bool isPinned(const UUID& uuid) const;
+
+		/** 
+		 * Removes all pins added by pinResource(). Called automatically when the script assemblies are about to be
+		 * reloaded, as the managed code that owns the pins doesn't survive the reload.
+		 */
+		void clearPins();
+
+		/**
+		 * Returns a human readable report of all resources that are either pinned, or referenced by a managed object,
+		 * along with their load state, approximate memory usage and the reason they are resident.
+		 */
+		String getResidencyReport() const;
+
+		/**
+		 * Returns the approximate amount of memory used by the resource's data, in bytes. Only textures and meshes are
+		 * accounted for, and zero is returned for other types, or if the resource is null.
+		 */
+		static UINT64 getMemoryUsage(const Resource* resource);
+
 		/**	Throws an exception if the provided UUID already exists in the interop object lookup table. */
 		void _throwExceptionIfInvalidOrDuplicate(const UUID& uuid) const;
 
 	private:
+		/** Resource kept loaded through pinResource(). */
+		struct PinnedResource
+		{
+			HResource handle;
+			Vector<String> reasons;
+		};
+
 		/**	Triggered when the native resource has been unloaded and therefore destroyed. */
 		void onResourceDestroyed(const UUID& UUID);
 
 		UnorderedMap<UUID, ScriptResourceBase*> mScriptResources;
+		UnorderedMap<UUID, PinnedResource> mPinnedResources;
 		HEvent mResourceDestroyedConn;
+		HEvent mRefreshStartedConn;
 	};
 
 	/** @} */
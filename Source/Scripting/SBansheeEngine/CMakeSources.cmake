@@ -11,6 +11,9 @@ set(BS_SBANSHEEENGINE_INC_NOFILTER
 	"BsScriptObjectManager.h"
 	"BsEngineScriptLibrary.h"
 	"BsPlayInEditorManager.h"
+	"BsManagedProfiler.h"
+	"BsManagedUpdateBatcher.h"
+	"BsManagedChangeTracker.h"
 )
 
 set(BS_SBANSHEEENGINE_SRC_WRAPPERS_GUI
@@ -65,7 +68,13 @@ set(BS_SBANSHEEENGINE_INC_WRAPPERS
 	"Wrappers/BsScriptInput.h"
 	"Wrappers/BsScriptInputConfiguration.h"
 	"Wrappers/BsScriptLogEntry.h"
+	"Wrappers/BsScriptManagedProfiler.h"
+	"Wrappers/BsScriptManagedChangeTracker.h"
 	"Wrappers/BsScriptManagedResource.h"
+	"Wrappers/BsScriptMeshDataStreams.h"
+	"Wrappers/BsScriptAnimationCurveSampling.h"
+	"Wrappers/BsScriptAsyncResourceLoad.h"
+	"Wrappers/BsScriptPixelDataAccess.h"
 	"Wrappers/BsScriptPixelUtility.h"
 	"Wrappers/BsScriptPlainText.h"
 	"Wrappers/BsScriptPrefab.h"
@@ -147,7 +156,13 @@ set(BS_SBANSHEEENGINE_SRC_WRAPPERS
 	"Wrappers/BsScriptInput.cpp"
 	"Wrappers/BsScriptInputConfiguration.cpp"
 	"Wrappers/BsScriptLogEntry.cpp"
+	"Wrappers/BsScriptManagedProfiler.cpp"
+	"Wrappers/BsScriptManagedChangeTracker.cpp"
 	"Wrappers/BsScriptManagedResource.cpp"
+	"Wrappers/BsScriptMeshDataStreams.cpp"
+	"Wrappers/BsScriptAnimationCurveSampling.cpp"
+	"Wrappers/BsScriptAsyncResourceLoad.cpp"
+	"Wrappers/BsScriptPixelDataAccess.cpp"
 	"Wrappers/BsScriptPixelUtility.cpp"
 	"Wrappers/BsScriptPlainText.cpp"
 	"Wrappers/BsScriptPrefab.cpp"
@@ -202,6 +217,9 @@ set(BS_SBANSHEEENGINE_SRC_NOFILTER
 	"BsScriptObjectManager.cpp"
 	"BsEngineScriptLibrary.cpp"
 	"BsPlayInEditorManager.cpp"
+	"BsManagedProfiler.cpp"
+	"BsManagedUpdateBatcher.cpp"
+	"BsManagedChangeTracker.cpp"
 )
 
 set(BS_SBANSHEEENGINE_INC_RTTI
@@ -101,6 +101,68 @@ namespace bs
 		TVertexDataAccessor<Semantic>::set(meshData, (UINT8*)input.data(), numElements * sizeof(TNative));
 	}
 
+	/** Maps a single vertex layout flag to the vertex element semantic it is stored as. */
+	bool getElementSemantic(VertexLayout type, VertexElementSemantic& semantic, UINT32& semanticIdx)
+	{
+		semanticIdx = 0;
+		switch(type)
+		{
+		case VertexLayout::Position:
+			semantic = VES_POSITION;
+			return true;
+		case VertexLayout::Normal:
+			semantic = VES_NORMAL;
+			return true;
+		case VertexLayout::Tangent:
+			semantic = VES_TANGENT;
+			return true;
+		case VertexLayout::Color:
+			semantic = VES_COLOR;
+			return true;
+		case VertexLayout::UV0:
+			semantic = VES_TEXCOORD;
+			return true;
+		case VertexLayout::UV1:
+			semantic = VES_TEXCOORD;
+			semanticIdx = 1;
+			return true;
+		case VertexLayout::BoneWeights:
+			semantic = VES_BLEND_INDICES;
+			return true;
+		default:
+			return false;
+		}
+	}
+
+	/** Checks if the mesh data contains the element and the provided buffer is large enough to hold all of them. */
+	bool validateElementAccess(const SPtr<RendererMeshData>& meshData, VertexLayout type, UINT32 size)
+	{
+		VertexElementSemantic semantic;
+		UINT32 semanticIdx;
+		if(!getElementSemantic(type, semantic, semanticIdx))
+			return false;
+
+		const SPtr<MeshData>& data = meshData->getData();
+		if(!data->getVertexDesc()->hasElement(semantic, semanticIdx))
+			return false;
+
+		return size >= data->getNumVertices() * MeshDataEx::getElementSize(type);
+	}
+
+	template<int Semantic>
+	void readElements(const SPtr<RendererMeshData>& meshData, UINT8* buffer, UINT32 elementSize)
+	{
+		UINT32 numElements = meshData->getData()->getNumVertices();
+		TVertexDataAccessor<Semantic>::get(meshData, buffer, numElements * elementSize);
+	}
+
+	template<int Semantic>
+	void writeElements(const SPtr<RendererMeshData>& meshData, UINT8* buffer, UINT32 elementSize)
+	{
+		UINT32 numElements = meshData->getData()->getNumVertices();
+		TVertexDataAccessor<Semantic>::set(meshData, buffer, numElements * elementSize);
+	}
+
 	SPtr<RendererMeshData> MeshDataEx::create(UINT32 numVertices, UINT32 numIndices, VertexLayout layout, IndexType indexType)
 	{
 		return RendererMeshData::create(numVertices, numIndices, layout, indexType);
@@ -202,4 +264,160 @@ namespace bs
 	{
 		return (int)thisPtr->getData()->getNumIndices();
 	}
+
+	UINT32 MeshDataEx::getElementSize(VertexLayout type)
+	{
+		switch(type)
+		{
+		case VertexLayout::Position:
+		case VertexLayout::Normal:
+			return sizeof(Vector3);
+		case VertexLayout::Tangent:
+			return sizeof(Vector4);
+		case VertexLayout::Color:
+			return sizeof(Color);
+		case VertexLayout::UV0:
+		case VertexLayout::UV1:
+			return sizeof(Vector2);
+		case VertexLayout::BoneWeights:
+			return sizeof(BoneWeight);
+		default:
+			return 0;
+		}
+	}
+
+	bool MeshDataEx::readElements(const SPtr<RendererMeshData>& thisPtr, VertexLayout type, UINT8* buffer, UINT32 size)
+	{
+		if(!validateElementAccess(thisPtr, type, size))
+			return false;
+
+		UINT32 elementSize = getElementSize(type);
+		switch(type)
+		{
+		case VertexLayout::Position:
+			bs::readElements<(int)VertexLayout::Position>(thisPtr, buffer, elementSize);
+			break;
+		case VertexLayout::Normal:
+			bs::readElements<(int)VertexLayout::Normal>(thisPtr, buffer, elementSize);
+			break;
+		case VertexLayout::Tangent:
+			bs::readElements<(int)VertexLayout::Tangent>(thisPtr, buffer, elementSize);
+			break;
+		case VertexLayout::Color:
+			bs::readElements<(int)VertexLayout::Color>(thisPtr, buffer, elementSize);
+			break;
+		case VertexLayout::UV0:
+			bs::readElements<(int)VertexLayout::UV0>(thisPtr, buffer, elementSize);
+			break;
+		case VertexLayout::UV1:
+			bs::readElements<(int)VertexLayout::UV1>(thisPtr, buffer, elementSize);
+			break;
+		case VertexLayout::BoneWeights:
+			bs::readElements<(int)VertexLayout::BoneWeights>(thisPtr, buffer, elementSize);
+			break;
+		default:
+			return false;
+		}
+
+		return true;
+	}
+
+	bool MeshDataEx::writeElements(const SPtr<RendererMeshData>& thisPtr, VertexLayout type, UINT8* buffer, UINT32 size)
+	{
+		if(!validateElementAccess(thisPtr, type, size))
+			return false;
+
+		UINT32 elementSize = getElementSize(type);
+		switch(type)
+		{
+		case VertexLayout::Position:
+			bs::writeElements<(int)VertexLayout::Position>(thisPtr, buffer, elementSize);
+			break;
+		case VertexLayout::Normal:
+			bs::writeElements<(int)VertexLayout::Normal>(thisPtr, buffer, elementSize);
+			break;
+		case VertexLayout::Tangent:
+			bs::writeElements<(int)VertexLayout::Tangent>(thisPtr, buffer, elementSize);
+			break;
+		case VertexLayout::Color:
+			bs::writeElements<(int)VertexLayout::Color>(thisPtr, buffer, elementSize);
+			break;
+		case VertexLayout::UV0:
+			bs::writeElements<(int)VertexLayout::UV0>(thisPtr, buffer, elementSize);
+			break;
+		case VertexLayout::UV1:
+			bs::writeElements<(int)VertexLayout::UV1>(thisPtr, buffer, elementSize);
+			break;
+		case VertexLayout::BoneWeights:
+			bs::writeElements<(int)VertexLayout::BoneWeights>(thisPtr, buffer, elementSize);
+			break;
+		default:
+			return false;
+		}
+
+		return true;
+	}
+
+	UINT32 MeshDataEx::getVertexStride(const SPtr<RendererMeshData>& thisPtr)
+	{
+		return thisPtr->getData()->getVertexDesc()->getVertexStride(0);
+	}
+
+	INT32 MeshDataEx::getElementOffset(const SPtr<RendererMeshData>& thisPtr, VertexLayout type)
+	{
+		VertexElementSemantic semantic;
+		UINT32 semanticIdx;
+		if(!getElementSemantic(type, semantic, semanticIdx))
+			return -1;
+
+		SPtr<VertexDataDesc> vertexDesc = thisPtr->getData()->getVertexDesc();
+		if(!vertexDesc->hasElement(semantic, semanticIdx))
+			return -1;
+
+		return (INT32)vertexDesc->getElementOffsetFromStream(semantic, semanticIdx, 0);
+	}
+
+	bool MeshDataEx::readVertexStream(const SPtr<RendererMeshData>& thisPtr, UINT8* buffer, UINT32 size)
+	{
+		const SPtr<MeshData>& data = thisPtr->getData();
+
+		UINT32 streamSize = data->getStreamSize(0);
+		if(size < streamSize)
+			return false;
+
+		memcpy(buffer, data->getStreamData(0), streamSize);
+		return true;
+	}
+
+	bool MeshDataEx::writeVertexStream(const SPtr<RendererMeshData>& thisPtr, UINT8* buffer, UINT32 size)
+	{
+		const SPtr<MeshData>& data = thisPtr->getData();
+
+		UINT32 streamSize = data->getStreamSize(0);
+		if(size < streamSize)
+			return false;
+
+		memcpy(data->getStreamData(0), buffer, streamSize);
+		return true;
+	}
+
+	bool MeshDataEx::readIndices(const SPtr<RendererMeshData>& thisPtr, UINT32* buffer, UINT32 count)
+	{
+		UINT32 numElements = thisPtr->getData()->getNumIndices();
+		if(count < numElements)
+			return false;
+
+		thisPtr->getIndices(buffer, numElements * sizeof(UINT32));
+		return true;
+	}
+
+	bool MeshDataEx::writeIndices(const SPtr<RendererMeshData>& thisPtr, UINT32* buffer, UINT32 count)
+	{
+		UINT32 numElements = thisPtr->getData()->getNumIndices();
+		if(count < numElements)
+			return false;
+
+		thisPtr->setIndices(buffer, numElements * sizeof(UINT32));
+		return true;
+	}
 }
\ No newline at end of file
@@ -82,6 +82,75 @@ namespace bs
 		/** Returns the number of indices contained in the mesh. */
 		BS_SCRIPT_EXPORT(e:RendererMeshData,pr:getter,n:IndexCount)
 		static int getIndexCount(const SPtr<RendererMeshData>& thisPtr);
+
+		/** @name Internal
+		 *  @{
+		 */
+
+		/** 
+		 * Returns the size of a single element of the provided type, as seen by the element accessors (e.g. 12 bytes for
+		 * positions). Returns 0 if the provided layout doesn't refer to exactly one element type.
+		 */
+		static UINT32 getElementSize(VertexLayout type);
+
+		/** 
+		 * Copies all vertex elements of the specified type directly into the provided buffer, without any intermediate
+		 * allocations. Buffer must be able to hold getElementSize() * number of vertices bytes.
+		 *
+		 * @return	False if the mesh data doesn't contain the element, or the provided buffer is not large enough.
+		 */
+		static bool readElements(const SPtr<RendererMeshData>& thisPtr, VertexLayout type, UINT8* buffer, UINT32 size);
+
+		/** 
+		 * Copies all vertex elements of the specified type from the provided buffer directly into the mesh data. 
+		 * Buffer must contain getElementSize() * number of vertices bytes.
+		 *
+		 * @return	False if the mesh data doesn't contain the element, or the provided buffer is not large enough.
+		 */
+		static bool writeElements(const SPtr<RendererMeshData>& thisPtr, VertexLayout type, UINT8* buffer, UINT32 size);
+
+		/** Returns the size of a single vertex in the interleaved vertex stream, in bytes. */
+		static UINT32 getVertexStride(const SPtr<RendererMeshData>& thisPtr);
+
+		/** 
+		 * Returns an offset of the element of the specified type from the start of a vertex in the interleaved vertex
+		 * stream, in bytes. Returns -1 if the element is not present. For bone weights the offset of the blend indices is
+		 * returned, followed by the blend weights.
+		 */
+		static INT32 getElementOffset(const SPtr<RendererMeshData>& thisPtr, VertexLayout type);
+
+		/** 
+		 * Copies the entire interleaved vertex stream in the layout described by getVertexStride() and 
+		 * getElementOffset() into the provided buffer, using a single copy.
+		 *
+		 * @return	False if the provided buffer is not large enough.
+		 */
+		static bool readVertexStream(const SPtr<RendererMeshData>& thisPtr, UINT8* buffer, UINT32 size);
+
+		/** 
+		 * Copies the provided interleaved vertex data into the vertex stream, using a single copy. Data must be in the
+		 * layout described by getVertexStride() and getElementOffset().
+		 *
+		 * @return	False if the provided buffer is not large enough.
+		 */
+		static bool writeVertexStream(const SPtr<RendererMeshData>& thisPtr, UINT8* buffer, UINT32 size);
+
+		/** 
+		 * Copies all indices directly into the provided buffer, converting them to 32-bit if needed. 
+		 *
+		 * @return	False if the provided buffer is not large enough.
+		 */
+		static bool readIndices(const SPtr<RendererMeshData>& thisPtr, UINT32* buffer, UINT32 count);
+
+		/** 
+		 * Copies all indices from the provided buffer directly into the mesh data, converting them to the mesh data's
+		 * index format if needed.
+		 *
+		 * @return	False if the provided buffer is not large enough.
+		 */
+		static bool writeIndices(const SPtr<RendererMeshData>& thisPtr, UINT32* buffer, UINT32 count);
+
+		/** @} */
 	};
 
 	/** @endcond */
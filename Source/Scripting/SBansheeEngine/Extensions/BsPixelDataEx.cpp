@@ -2,9 +2,101 @@
 //**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
 #include "Extensions/BsPixelDataEx.h"
 #include "Wrappers/BsScriptColor.h"
+#include "Image/BsPixelUtil.h"
+
+#if BS_ARCH_TYPE == BS_ARCHITECTURE_x86_64
+#include <emmintrin.h>
+#endif
 
 namespace bs
 {
+	/** Converts pixels in 8-bit RGBA or BGRA (if @p SWIZZLE is true) format into colors. */
+	template<bool SWIZZLE>
+	void unpackColors8888(const UINT8* src, Color* dst, UINT32 count)
+	{
+		UINT32 i = 0;
+
+#if BS_ARCH_TYPE == BS_ARCHITECTURE_x86_64
+		const __m128 scale = _mm_set1_ps(1.0f / 255.0f);
+		const __m128i zero = _mm_setzero_si128();
+
+		// Four pixels per iteration: widen the 16 bytes to 32-bit integers, convert to float and normalize
+		for (; i + 4 <= count; i += 4)
+		{
+			__m128i packed = _mm_loadu_si128((const __m128i*)(src + i * 4));
+			__m128i lo = _mm_unpacklo_epi8(packed, zero);
+			__m128i hi = _mm_unpackhi_epi8(packed, zero);
+
+			__m128 pixels[4];
+			pixels[0] = _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(lo, zero)), scale);
+			pixels[1] = _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(lo, zero)), scale);
+			pixels[2] = _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(hi, zero)), scale);
+			pixels[3] = _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(hi, zero)), scale);
+
+			for (UINT32 j = 0; j < 4; j++)
+			{
+				if (SWIZZLE)
+					pixels[j] = _mm_shuffle_ps(pixels[j], pixels[j], _MM_SHUFFLE(3, 0, 1, 2));
+
+				_mm_storeu_ps(&dst[i + j].r, pixels[j]);
+			}
+		}
+#endif
+
+		for (; i < count; i++)
+		{
+			const UINT8* pixel = src + i * 4;
+
+			dst[i].r = pixel[SWIZZLE ? 2 : 0] * (1.0f / 255.0f);
+			dst[i].g = pixel[1] * (1.0f / 255.0f);
+			dst[i].b = pixel[SWIZZLE ? 0 : 2] * (1.0f / 255.0f);
+			dst[i].a = pixel[3] * (1.0f / 255.0f);
+		}
+	}
+
+	/** Converts colors into pixels in 8-bit RGBA or BGRA (if @p SWIZZLE is true) format. */
+	template<bool SWIZZLE>
+	void packColors8888(const Color* src, UINT8* dst, UINT32 count)
+	{
+		UINT32 i = 0;
+
+#if BS_ARCH_TYPE == BS_ARCHITECTURE_x86_64
+		const __m128 zero = _mm_setzero_ps();
+		const __m128 one = _mm_set1_ps(1.0f);
+		const __m128 scale = _mm_set1_ps(255.0f);
+		const __m128 half = _mm_set1_ps(0.5f);
+
+		// Four pixels per iteration. Rounds by adding 0.5 and truncating, same as the scalar path below.
+		for (; i + 4 <= count; i += 4)
+		{
+			__m128i channels[4];
+			for (UINT32 j = 0; j < 4; j++)
+			{
+				__m128 color = _mm_loadu_ps(&src[i + j].r);
+				if (SWIZZLE)
+					color = _mm_shuffle_ps(color, color, _MM_SHUFFLE(3, 0, 1, 2));
+
+				color = _mm_min_ps(_mm_max_ps(color, zero), one);
+				channels[j] = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(color, scale), half));
+			}
+
+			__m128i lo = _mm_packs_epi32(channels[0], channels[1]);
+			__m128i hi = _mm_packs_epi32(channels[2], channels[3]);
+			_mm_storeu_si128((__m128i*)(dst + i * 4), _mm_packus_epi16(lo, hi));
+		}
+#endif
+
+		for (; i < count; i++)
+		{
+			UINT8* pixel = dst + i * 4;
+
+			pixel[SWIZZLE ? 2 : 0] = (UINT8)(Math::clamp01(src[i].r) * 255.0f + 0.5f);
+			pixel[1] = (UINT8)(Math::clamp01(src[i].g) * 255.0f + 0.5f);
+			pixel[SWIZZLE ? 0 : 2] = (UINT8)(Math::clamp01(src[i].b) * 255.0f + 0.5f);
+			pixel[3] = (UINT8)(Math::clamp01(src[i].a) * 255.0f + 0.5f);
+		}
+	}
+
 	SPtr<PixelData> PixelDataEx::create(const PixelVolume& volume, PixelFormat format)
 	{
 		SPtr<PixelData> pixelData = bs_shared_ptr_new<PixelData>(volume, format);
@@ -37,7 +129,7 @@ namespace bs
 
 	Vector<Color> PixelDataEx::getPixels(const SPtr<PixelData>& thisPtr)
 	{
-		if (!checkIsLocked(thisPtr))
+		if (checkIsLocked(thisPtr))
 			return Vector<Color>();
 
 		return thisPtr->getColors();
@@ -45,7 +137,7 @@ namespace bs
 
 	void PixelDataEx::setPixels(const SPtr<PixelData>& thisPtr, const Vector<Color>& value)
 	{
-		if (!checkIsLocked(thisPtr))
+		if (checkIsLocked(thisPtr))
 			return;
 
 		thisPtr->setColors(value);
@@ -53,7 +145,7 @@ namespace bs
 
 	Vector<char> PixelDataEx::getRawPixels(const SPtr<PixelData>& thisPtr)
 	{
-		if (!checkIsLocked(thisPtr))
+		if (checkIsLocked(thisPtr))
 			return Vector<char>();
 
 		Vector<char> output(thisPtr->getSize());
@@ -64,7 +156,7 @@ namespace bs
 
 	void PixelDataEx::setRawPixels(const SPtr<PixelData>& thisPtr, const Vector<char>& value)
 	{
-		if (!checkIsLocked(thisPtr))
+		if (checkIsLocked(thisPtr))
 			return;
 
 		UINT32 arrayLen = (UINT32)value.size();
@@ -88,4 +180,209 @@ namespace bs
 
 		return false;
 	}
+
+	bool PixelDataEx::readRawPixels(const SPtr<PixelData>& thisPtr, UINT8* buffer, UINT32 size)
+	{
+		if (checkIsLocked(thisPtr) || size < thisPtr->getSize())
+			return false;
+
+		memcpy(buffer, thisPtr->getData(), thisPtr->getSize());
+		return true;
+	}
+
+	bool PixelDataEx::writeRawPixels(const SPtr<PixelData>& thisPtr, const UINT8* buffer, UINT32 size)
+	{
+		if (checkIsLocked(thisPtr) || size < thisPtr->getSize())
+			return false;
+
+		memcpy(thisPtr->getData(), buffer, thisPtr->getSize());
+		return true;
+	}
+
+	bool PixelDataEx::readColors(const SPtr<PixelData>& thisPtr, Color* buffer, UINT32 count)
+	{
+		UINT32 width = thisPtr->getWidth();
+		UINT32 height = thisPtr->getHeight();
+		UINT32 depth = thisPtr->getDepth();
+
+		if (count < width * height * depth || getRowSize(thisPtr) == 0 || checkIsLocked(thisPtr))
+			return false;
+
+		for (UINT32 z = 0; z < depth; z++)
+		{
+			for (UINT32 y = 0; y < height; y++)
+				unpackColors(getRowData(thisPtr, y, z), thisPtr->getFormat(), buffer + (z * height + y) * width, width);
+		}
+
+		return true;
+	}
+
+	bool PixelDataEx::writeColors(const SPtr<PixelData>& thisPtr, const Color* buffer, UINT32 count)
+	{
+		UINT32 width = thisPtr->getWidth();
+		UINT32 height = thisPtr->getHeight();
+		UINT32 depth = thisPtr->getDepth();
+
+		if (count < width * height * depth || getRowSize(thisPtr) == 0 || checkIsLocked(thisPtr))
+			return false;
+
+		for (UINT32 z = 0; z < depth; z++)
+		{
+			for (UINT32 y = 0; y < height; y++)
+				packColors(buffer + (z * height + y) * width, thisPtr->getFormat(), getRowData(thisPtr, y, z), width);
+		}
+
+		return true;
+	}
+
+	UINT32 PixelDataEx::getRowSize(const SPtr<PixelData>& thisPtr)
+	{
+		if (PixelUtil::isCompressed(thisPtr->getFormat()))
+			return 0;
+
+		return thisPtr->getWidth() * PixelUtil::getNumElemBytes(thisPtr->getFormat());
+	}
+
+	/** Returns a pointer to the start of the specified row, or null if the row is out of range or compressed. */
+	static UINT8* getRowDataNoLockCheck(const SPtr<PixelData>& thisPtr, UINT32 y, UINT32 z)
+	{
+		if (y >= thisPtr->getHeight() || z >= thisPtr->getDepth() || PixelUtil::isCompressed(thisPtr->getFormat()))
+			return nullptr;
+
+		// Pitches are in pixels
+		UINT32 pixelSize = PixelUtil::getNumElemBytes(thisPtr->getFormat());
+		UINT32 offset = (z * thisPtr->getSlicePitch() + y * thisPtr->getRowPitch()) * pixelSize;
+
+		return thisPtr->getData() + offset;
+	}
+
+	UINT8* PixelDataEx::getRowData(const SPtr<PixelData>& thisPtr, UINT32 y, UINT32 z)
+	{
+		if (checkIsLocked(thisPtr))
+			return nullptr;
+
+		return getRowDataNoLockCheck(thisPtr, y, z);
+	}
+
+	bool PixelDataEx::lock(const SPtr<PixelData>& thisPtr)
+	{
+		if (checkIsLocked(thisPtr))
+			return false;
+
+		thisPtr->lock();
+		return true;
+	}
+
+	void PixelDataEx::unlock(const SPtr<PixelData>& thisPtr)
+	{
+		thisPtr->unlock();
+	}
+
+	UINT8* PixelDataEx::getLockedRowData(const SPtr<PixelData>& thisPtr, UINT32 y, UINT32 z)
+	{
+		if (!thisPtr->isLocked())
+		{
+			LOGWRN("Attempting to access pixel data rows without locking the pixel data first.");
+			return nullptr;
+		}
+
+		return getRowDataNoLockCheck(thisPtr, y, z);
+	}
+
+	bool PixelDataEx::readRow(const SPtr<PixelData>& thisPtr, UINT32 y, UINT32 z, UINT8* buffer, UINT32 size)
+	{
+		UINT32 rowSize = getRowSize(thisPtr);
+		if (size < rowSize)
+			return false;
+
+		UINT8* rowData = getRowData(thisPtr, y, z);
+		if (rowData == nullptr)
+			return false;
+
+		memcpy(buffer, rowData, rowSize);
+		return true;
+	}
+
+	bool PixelDataEx::writeRow(const SPtr<PixelData>& thisPtr, UINT32 y, UINT32 z, const UINT8* buffer, UINT32 size)
+	{
+		UINT32 rowSize = getRowSize(thisPtr);
+		if (size < rowSize)
+			return false;
+
+		UINT8* rowData = getRowData(thisPtr, y, z);
+		if (rowData == nullptr)
+			return false;
+
+		memcpy(rowData, buffer, rowSize);
+		return true;
+	}
+
+	bool PixelDataEx::readRowColors(const SPtr<PixelData>& thisPtr, UINT32 y, UINT32 z, Color* buffer, UINT32 count)
+	{
+		if (count < thisPtr->getWidth())
+			return false;
+
+		UINT8* rowData = getRowData(thisPtr, y, z);
+		if (rowData == nullptr)
+			return false;
+
+		unpackColors(rowData, thisPtr->getFormat(), buffer, thisPtr->getWidth());
+		return true;
+	}
+
+	bool PixelDataEx::writeRowColors(const SPtr<PixelData>& thisPtr, UINT32 y, UINT32 z, const Color* buffer, 
+		UINT32 count)
+	{
+		if (count < thisPtr->getWidth())
+			return false;
+
+		UINT8* rowData = getRowData(thisPtr, y, z);
+		if (rowData == nullptr)
+			return false;
+
+		packColors(buffer, thisPtr->getFormat(), rowData, thisPtr->getWidth());
+		return true;
+	}
+
+	void PixelDataEx::unpackColors(const UINT8* src, PixelFormat format, Color* dst, UINT32 count)
+	{
+		switch (format)
+		{
+		case PF_RGBA8:
+			unpackColors8888<false>(src, dst, count);
+			break;
+		case PF_BGRA8:
+			unpackColors8888<true>(src, dst, count);
+			break;
+		default:
+		{
+			UINT32 pixelSize = PixelUtil::getNumElemBytes(format);
+			for (UINT32 i = 0; i < count; i++)
+				PixelUtil::unpackColor(&dst[i], format, src + i * pixelSize);
+
+			break;
+		}
+		}
+	}
+
+	void PixelDataEx::packColors(const Color* src, PixelFormat format, UINT8* dst, UINT32 count)
+	{
+		switch (format)
+		{
+		case PF_RGBA8:
+			packColors8888<false>(src, dst, count);
+			break;
+		case PF_BGRA8:
+			packColors8888<true>(src, dst, count);
+			break;
+		default:
+		{
+			UINT32 pixelSize = PixelUtil::getNumElemBytes(format);
+			for (UINT32 i = 0; i < count; i++)
+				PixelUtil::packColor(src[i], format, dst + i * pixelSize);
+
+			break;
+		}
+		}
+	}
 }
\ No newline at end of file
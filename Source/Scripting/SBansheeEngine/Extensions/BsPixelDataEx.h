@@ -82,6 +82,108 @@ namespace bs
 		static void setRawPixels(const SPtr<PixelData>& thisPtr, const Vector<char>& value);
 
 		static bool checkIsLocked(const SPtr<PixelData>& thisPtr);
+
+		/** @name Internal
+		 *  @{
+		 */
+
+		/** 
+		 * Copies the raw contents of the pixel buffer directly into the provided buffer, using a single copy. 
+		 *
+		 * @return	False if the pixel data is locked or the provided buffer is smaller than PixelData::getSize().
+		 */
+		static bool readRawPixels(const SPtr<PixelData>& thisPtr, UINT8* buffer, UINT32 size);
+
+		/** 
+		 * Copies the raw contents of the pixel buffer from the provided buffer, using a single copy. 
+		 *
+		 * @return	False if the pixel data is locked or the provided buffer is smaller than PixelData::getSize().
+		 */
+		static bool writeRawPixels(const SPtr<PixelData>& thisPtr, const UINT8* buffer, UINT32 size);
+
+		/** 
+		 * Converts all pixels to colors and writes them directly into the provided buffer, without intermediate 
+		 * allocations. Pixels are output consecutively with any row and slice padding removed.
+		 *
+		 * @return	False if the pixel data is locked or the buffer can't hold width * height * depth colors.
+		 */
+		static bool readColors(const SPtr<PixelData>& thisPtr, Color* buffer, UINT32 count);
+
+		/** 
+		 * Converts colors from the provided buffer into the pixel format of the pixel data and writes them into the 
+		 * pixel buffer. Colors are expected to be laid out consecutively, without row or slice padding.
+		 *
+		 * @return	False if the pixel data is locked or the buffer doesn't contain width * height * depth colors.
+		 */
+		static bool writeColors(const SPtr<PixelData>& thisPtr, const Color* buffer, UINT32 count);
+
+		/** Returns the size of a single row of pixels without padding, in bytes. Returns 0 for compressed formats. */
+		static UINT32 getRowSize(const SPtr<PixelData>& thisPtr);
+
+		/** 
+		 * Returns a pointer to the start of the specified row in the pixel buffer, or null if the row is out of range, the
+		 * pixel data is locked or uses a compressed format.
+		 */
+		static UINT8* getRowData(const SPtr<PixelData>& thisPtr, UINT32 y, UINT32 z);
+
+		/** 
+		 * Locks the pixel data, preventing any other reads or writes until unlock() is called. Used for exposing the 
+		 * raw pixel memory to the caller, who then accesses it through getLockedRowData().
+		 *
+		 * @return	False if the pixel data is already locked.
+		 */
+		static bool lock(const SPtr<PixelData>& thisPtr);
+
+		/** Releases a lock acquired through lock(). */
+		static void unlock(const SPtr<PixelData>& thisPtr);
+
+		/** 
+		 * Same as getRowData(), except it may only be called while the pixel data is locked through lock(). Returns null
+		 * if the pixel data isn't locked.
+		 */
+		static UINT8* getLockedRowData(const SPtr<PixelData>& thisPtr, UINT32 y, UINT32 z);
+
+		/** 
+		 * Copies a single row of raw pixels into the provided buffer.
+		 *
+		 * @return	False if the row is not accessible (see getRowData()) or the buffer is smaller than getRowSize().
+		 */
+		static bool readRow(const SPtr<PixelData>& thisPtr, UINT32 y, UINT32 z, UINT8* buffer, UINT32 size);
+
+		/** 
+		 * Copies a single row of raw pixels from the provided buffer.
+		 *
+		 * @return	False if the row is not accessible (see getRowData()) or the buffer is smaller than getRowSize().
+		 */
+		static bool writeRow(const SPtr<PixelData>& thisPtr, UINT32 y, UINT32 z, const UINT8* buffer, UINT32 size);
+
+		/** 
+		 * Converts a single row of pixels into colors and writes them into the provided buffer.
+		 *
+		 * @return	False if the row is not accessible (see getRowData()) or the buffer can't hold a row of colors.
+		 */
+		static bool readRowColors(const SPtr<PixelData>& thisPtr, UINT32 y, UINT32 z, Color* buffer, UINT32 count);
+
+		/** 
+		 * Converts colors from the provided buffer into the pixel format and writes them into a single row.
+		 *
+		 * @return	False if the row is not accessible (see getRowData()) or the buffer doesn't contain a row of colors.
+		 */
+		static bool writeRowColors(const SPtr<PixelData>& thisPtr, UINT32 y, UINT32 z, const Color* buffer, UINT32 count);
+
+		/** 
+		 * Converts @p count consecutive pixels of the specified format into colors. 8-bit four channel formats are 
+		 * converted four pixels at a time using SIMD, while other formats fall back to PixelUtil::unpackColor.
+		 */
+		static void unpackColors(const UINT8* src, PixelFormat format, Color* dst, UINT32 count);
+
+		/** 
+		 * Converts @p count colors into consecutive pixels of the specified format. 8-bit four channel formats are 
+		 * converted four pixels at a time using SIMD, while other formats fall back to PixelUtil::packColor.
+		 */
+		static void packColors(const Color* src, PixelFormat format, UINT8* dst, UINT32 count);
+
+		/** @} */
 	};
 
 	/** @endcond */
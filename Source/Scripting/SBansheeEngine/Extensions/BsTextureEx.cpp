@@ -2,6 +2,8 @@
 //**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
 #include "Extensions/BsTextureEx.h"
 #include "Extensions/BsAsyncOpEx.h"
+#include "Extensions/BsPixelDataEx.h"
+#include "Image/BsPixelUtil.h"
 
 #include "BsScriptPixelData.generated.h"
 
@@ -128,4 +130,63 @@ namespace bs
 
 		thisPtr->writeData(pixelData, face, mipLevel, false);
 	}
+
+	/** Creates an empty (unallocated) pixel buffer matching the dimensions and format of a texture mip level. */
+	SPtr<PixelData> createMipPixelData(const HTexture& texture, UINT32 mipLevel)
+	{
+		const TextureProperties& props = texture->getProperties();
+
+		UINT32 width, height, depth;
+		PixelUtil::getSizeForMipLevel(props.getWidth(), props.getHeight(), props.getDepth(), mipLevel, width, height, 
+			depth);
+
+		return bs_shared_ptr_new<PixelData>(width, height, depth, props.getFormat());
+	}
+
+	bool TextureEx::readCachedPixels(const HTexture& thisPtr, UINT8* buffer, UINT32 size, UINT32 face, UINT32 mipLevel)
+	{
+		if ((thisPtr->getProperties().getUsage() & TU_CPUCACHED) == 0)
+		{
+			LOGERR("Attempting to read CPU data from a texture that is created without CPU caching.");
+			return false;
+		}
+
+		SPtr<PixelData> pixelData = createMipPixelData(thisPtr, mipLevel);
+		if (size < pixelData->getSize())
+			return false;
+
+		// Read straight into the provided buffer
+		pixelData->setExternalBuffer(buffer);
+		thisPtr->readCachedData(*pixelData, face, mipLevel);
+
+		return true;
+	}
+
+	bool TextureEx::writeRawPixels(const HTexture& thisPtr, const UINT8* buffer, UINT32 size, UINT32 face, 
+		UINT32 mipLevel)
+	{
+		SPtr<PixelData> pixelData = createMipPixelData(thisPtr, mipLevel);
+		if (size < pixelData->getSize())
+			return false;
+
+		// Write is executed on the core thread, so the data needs to be copied into a buffer owned by the pixel data
+		pixelData->allocateInternalBuffer();
+		memcpy(pixelData->getData(), buffer, pixelData->getSize());
+
+		thisPtr->writeData(pixelData, face, mipLevel, false);
+		return true;
+	}
+
+	bool TextureEx::writeColors(const HTexture& thisPtr, const Color* colors, UINT32 count, UINT32 face, 
+		UINT32 mipLevel)
+	{
+		SPtr<PixelData> pixelData = createMipPixelData(thisPtr, mipLevel);
+		pixelData->allocateInternalBuffer();
+
+		if (!PixelDataEx::writeColors(pixelData, colors, count))
+			return false;
+
+		thisPtr->writeData(pixelData, face, mipLevel, false);
+		return true;
+	}
 }
\ No newline at end of file
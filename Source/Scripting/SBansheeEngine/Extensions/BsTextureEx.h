@@ -115,6 +115,38 @@ namespace bs
 		 */
 		BS_SCRIPT_EXPORT(e:Texture,n:SetPixels)
 		static void setPixelsArray(const HTexture& thisPtr, const Vector<Color>& colors, UINT32 face = 0, UINT32 mipLevel = 0);
+
+		/** @name Internal
+		 *  @{
+		 */
+
+		/** 
+		 * Reads the CPU cached pixels of the specified mip level and face directly into the provided buffer, without 
+		 * allocating an intermediate PixelData object. Pixels are written consecutively, without row or slice padding.
+		 *
+		 * @return	False if the buffer is too small to hold the mip level, or the texture isn't CPU cached.
+		 */
+		static bool readCachedPixels(const HTexture& thisPtr, UINT8* buffer, UINT32 size, UINT32 face, UINT32 mipLevel);
+
+		/** 
+		 * Writes raw pixels of the specified mip level and face. The data must be in the texture pixel format, laid out 
+		 * consecutively without row or slice padding.
+		 *
+		 * @return	False if the buffer doesn't contain enough data for the mip level.
+		 */
+		static bool writeRawPixels(const HTexture& thisPtr, const UINT8* buffer, UINT32 size, UINT32 face, 
+			UINT32 mipLevel);
+
+		/** 
+		 * Converts the provided colors into the texture pixel format and writes them to the specified mip level and face,
+		 * without going through an intermediate color array.
+		 *
+		 * @return	False if the number of colors doesn't match the mip level dimensions.
+		 */
+		static bool writeColors(const HTexture& thisPtr, const Color* colors, UINT32 count, UINT32 face, 
+			UINT32 mipLevel);
+
+		/** @} */
 	};
 
 	/** @endcond */
@@ -9,6 +9,7 @@
 #include "BsMonoMethod.h"
 #include "BsMonoProperty.h"
 #include "BsMonoUtil.h"
+#include "BsMonoArray.h"
 
 namespace bs
 {
@@ -335,8 +336,7 @@ namespace bs
 
 	MonoObject* ManagedSerializableDictionary::deserialize()
 	{
-		MonoObject* managedInstance = createManagedInstance(mDictionaryTypeInfo);
-		if (managedInstance == nullptr)
+		if (!mDictionaryTypeInfo->isTypeLoaded())
 			return nullptr;
 
 		::MonoClass* dictionaryMonoClass = mDictionaryTypeInfo->getMonoClass();
@@ -346,6 +346,11 @@ namespace bs
 
 		initMonoObjects(dictionaryClass);
 
+		UINT32 numEntries = (UINT32)mCachedEntries.size();
+
+		void* capacityParams[1] = { &numEntries };
+		MonoObject* managedInstance = dictionaryClass->createInstance("int", capacityParams);
+
 		// Deserialize children
 		for (auto& fieldEntry : mCachedEntries)
 		{
@@ -353,13 +358,32 @@ namespace bs
 			fieldEntry.second->deserialize();
 		}
 
+		::MonoClass* keyClass = mDictionaryTypeInfo->mKeyType->getMonoClass();
+		::MonoClass* valueClass = mDictionaryTypeInfo->mValueType->getMonoClass();
+
+		ScriptArray keys(keyClass, numEntries);
+		ScriptArray values(valueClass, numEntries);
+
+		UINT32 keySize = keys.elementSize();
+		UINT32 valueSize = values.elementSize();
+		bool isKeyValueType = MonoUtil::isValueType(keyClass);
+		bool isValueValueType = MonoUtil::isValueType(valueClass);
+
 		UINT32 idx = 0;
 		for (auto& entry : mCachedEntries)
 		{
-			setFieldData(managedInstance, entry.first, entry.second);
+			void* key = entry.first->getValue(mDictionaryTypeInfo->mKeyType);
+			void* value = entry.second->getValue(mDictionaryTypeInfo->mValueType);
+
+			keys.setRaw(idx, isKeyValueType ? (UINT8*)key : (UINT8*)&key, keySize);
+			values.setRaw(idx, isValueValueType ? (UINT8*)value : (UINT8*)&value, valueSize);
 			idx++;
 		}
 
+		// All entries are added in a single managed call, rather than one call per entry
+		void* params[3] = { managedInstance, keys.getInternal(), values.getInternal() };
+		mSetEntriesMethod->invoke(nullptr, params);
+
 		return managedInstance;
 	}
 
@@ -467,6 +491,9 @@ namespace bs
 
 		MonoClass* valueCollectionClass = mValuesProp->getReturnType();
 		mValuesCopyTo = valueCollectionClass->getMethod("CopyTo", 2);
+
+		MonoClass* utilityClass = ScriptAssemblyManager::instance().getSerializableUtilityClass();
+		mSetEntriesMethod = utilityClass->getMethod("Internal_SetDictionaryEntries", 3);
 	}
 
 	RTTITypeBase* ManagedSerializableDictionary::getRTTIStatic()
@@ -241,6 +241,7 @@ namespace bs
 		MonoMethod* mKeysCopyTo = nullptr;
 		MonoProperty* mValuesProp = nullptr;
 		MonoMethod* mValuesCopyTo = nullptr;
+		MonoMethod* mSetEntriesMethod = nullptr;
 
 		SPtr<ManagedSerializableTypeInfoDictionary> mDictionaryTypeInfo;
 		CachedEntriesMap mCachedEntries;
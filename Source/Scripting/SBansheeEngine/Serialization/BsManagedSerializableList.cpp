@@ -9,6 +9,7 @@
 #include "BsMonoMethod.h"
 #include "BsMonoProperty.h"
 #include "BsMonoUtil.h"
+#include "BsMonoArray.h"
 
 namespace bs
 {
@@ -174,8 +175,51 @@ namespace bs
 		mNumElements = getLengthInternal();
 		mCachedEntries = Vector<SPtr<ManagedSerializableFieldData>>(mNumElements);
 
-		for (UINT32 i = 0; i < mNumElements; i++)
-			mCachedEntries[i] = getFieldData(i);
+		// All elements are copied into an array of the element type in a single managed call, rather than one call per
+		// element
+		::MonoClass* elementClass = mListTypeInfo->mElementType->getMonoClass();
+		ScriptArray elementArray(elementClass, mNumElements);
+
+		UINT32 zero = 0;
+		void* params[4] = { &zero, elementArray.getInternal(), &zero, &mNumElements };
+		mCopyToMethod->invoke(getManagedInstance(), params);
+
+		UINT32 elementSize = elementArray.elementSize();
+		if (MonoUtil::isValueType(elementClass))
+		{
+			// Field data of primitive types copies the value out of the boxed object, so a single boxed object can be
+			// re-used for all elements
+			bool isPrimitive = mListTypeInfo->mElementType->getTypeId() == TID_SerializableTypeInfoPrimitive;
+
+			MonoObject* sharedBox = nullptr;
+			for (UINT32 i = 0; i < mNumElements; i++)
+			{
+				void* value = elementArray.getRaw(i, elementSize);
+
+				MonoObject* boxedValue;
+				if (isPrimitive)
+				{
+					if (sharedBox == nullptr)
+						sharedBox = MonoUtil::box(elementClass, value);
+					else
+						memcpy(MonoUtil::unbox(sharedBox), value, elementSize);
+
+					boxedValue = sharedBox;
+				}
+				else
+					boxedValue = MonoUtil::box(elementClass, value);
+
+				mCachedEntries[i] = ManagedSerializableFieldData::create(mListTypeInfo->mElementType, boxedValue);
+			}
+		}
+		else
+		{
+			for (UINT32 i = 0; i < mNumElements; i++)
+			{
+				MonoObject* element = *(MonoObject**)elementArray.getRaw(i, elementSize);
+				mCachedEntries[i] = ManagedSerializableFieldData::create(mListTypeInfo->mElementType, element);
+			}
+		}
 
 		// Serialize children
 		for (auto& fieldEntry : mCachedEntries)
@@ -187,25 +231,47 @@ namespace bs
 
 	MonoObject* ManagedSerializableList::deserialize()
 	{
-		MonoObject* managedInstance = createManagedInstance(mListTypeInfo, mNumElements);
-
-		if (managedInstance == nullptr)
+		if (!mListTypeInfo->isTypeLoaded())
 			return nullptr;
 
 		MonoClass* listClass = MonoManager::instance().findClass(mListTypeInfo->getMonoClass());
+		if (listClass == nullptr)
+			return nullptr;
+
 		initMonoObjects(listClass);
 
+		UINT32 numElements = (UINT32)mCachedEntries.size();
+
+		void* params[1] = { &numElements };
+		MonoObject* managedInstance = listClass->createInstance("int", params);
+
 		// Deserialize children
 		for (auto& fieldEntry : mCachedEntries)
 			fieldEntry->deserialize();
 
+		::MonoClass* elementClass = mListTypeInfo->mElementType->getMonoClass();
+		ScriptArray elementArray(elementClass, numElements);
+
+		UINT32 elementSize = elementArray.elementSize();
+		bool isValueType = MonoUtil::isValueType(elementClass);
+
 		UINT32 idx = 0;
 		for (auto& entry : mCachedEntries)
 		{
-			setFieldData(managedInstance, idx, entry);
+			void* value = entry->getValue(mListTypeInfo->mElementType);
+
+			if (isValueType)
+				elementArray.setRaw(idx, (UINT8*)value, elementSize);
+			else
+				elementArray.setRaw(idx, (UINT8*)&value, elementSize);
+
 			idx++;
 		}
 
+		// All elements are added in a single managed call, rather than one call per element
+		params[0] = elementArray.getInternal();
+		mAddRangeMethod->invoke(managedInstance, params);
+
 		return managedInstance;
 	}
 
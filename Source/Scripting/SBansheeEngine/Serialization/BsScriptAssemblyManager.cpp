@@ -77,6 +77,7 @@ namespace bs
 		: mBaseTypesInitialized(false), mSystemArrayClass(nullptr), mSystemGenericListClass(nullptr)
 		, mSystemGenericDictionaryClass(nullptr), mSystemTypeClass(nullptr), mComponentClass(nullptr)
 		, mManagedComponentClass(nullptr), mSceneObjectClass(nullptr), mMissingComponentClass(nullptr)
+		, mSerializableUtilityClass(nullptr)
 		, mSerializeObjectAttribute(nullptr), mDontSerializeFieldAttribute(nullptr), mSerializeFieldAttribute(nullptr)
 		, mHideInInspectorAttribute(nullptr), mShowInInspectorAttribute(nullptr), mRangeAttribute(nullptr)
 		, mStepAttribute(nullptr)
@@ -98,7 +99,16 @@ namespace bs
 		return initializedAssemblies;
 	}
 
-	void ScriptAssemblyManager::loadAssemblyInfo(const String& assemblyName)
+	Path ScriptAssemblyManager::getAssemblyPath(const String& assemblyName) const
+	{
+		auto iterFind = mAssemblyPaths.find(assemblyName);
+		if (iterFind != mAssemblyPaths.end())
+			return iterFind->second;
+
+		return Path::BLANK;
+	}
+
+	void ScriptAssemblyManager::loadAssemblyInfo(const String& assemblyName, const Path& assemblyPath)
 	{
 		if(!mBaseTypesInitialized)
 			initializeBaseTypes();
@@ -117,6 +127,7 @@ namespace bs
 		assemblyInfo->mName = assemblyName;
 
 		mAssemblyInfos[assemblyName] = assemblyInfo;
+		mAssemblyPaths[assemblyName] = assemblyPath;
 
 		MonoClass* resourceClass = ScriptResource::getMetaData()->scriptClass;
 		MonoClass* managedResourceClass = ScriptManagedResource::getMetaData()->scriptClass;
@@ -268,6 +279,7 @@ namespace bs
 	{
 		clearScriptObjects();
 		mAssemblyInfos.clear();
+		mAssemblyPaths.clear();
 	}
 
 	SPtr<ManagedSerializableTypeInfo> ScriptAssemblyManager::getTypeInfo(MonoClass* monoClass)
@@ -527,6 +539,7 @@ namespace bs
 		mManagedComponentClass = nullptr;
 		mSceneObjectClass = nullptr;
 		mMissingComponentClass = nullptr;
+		mSerializableUtilityClass = nullptr;
 
 		mSerializeFieldAttribute = nullptr;
 		mHideInInspectorAttribute = nullptr;
@@ -594,6 +607,10 @@ namespace bs
 		if(mSceneObjectClass == nullptr)
 			BS_EXCEPT(InvalidStateException, "Cannot find SceneObject managed class.");
 
+		mSerializableUtilityClass = bansheeEngineAssembly->getClass("BansheeEngine", "SerializableUtility");
+		if(mSerializableUtilityClass == nullptr)
+			BS_EXCEPT(InvalidStateException, "Cannot find SerializableUtility managed class.");
+
 		mSerializeFieldAttribute = bansheeEngineAssembly->getClass("BansheeEngine", "SerializeField");
 		if(mSerializeFieldAttribute == nullptr)
 			BS_EXCEPT(InvalidStateException, "Cannot find SerializeField managed class.");
@@ -26,8 +26,11 @@ namespace bs
 		 * currently loaded. Once the data has been loaded you will be able to call getSerializableObjectInfo() and
 		 * hasSerializableObjectInfo() to retrieve information about those objects. If an assembly already had data loaded
 		 * it will be rebuilt.
+		 *
+		 * @param[in]	assemblyName	Name of the assembly, as provided when loading it.
+		 * @param[in]	assemblyPath	Path to the file the assembly was loaded from.
 		 */
-		void loadAssemblyInfo(const String& assemblyName);
+		void loadAssemblyInfo(const String& assemblyName, const Path& assemblyPath);
 
 		/**	Clears any assembly data previously loaded with loadAssemblyInfo(). */
 		void clearAssemblyInfo();
@@ -89,6 +92,9 @@ namespace bs
 		/**	Returns names of all assemblies that currently have managed serializable object data loaded. */
 		Vector<String> getScriptAssemblies() const;
 
+		/** Returns the path to the file an assembly with managed serializable object data was loaded from. */
+		Path getAssemblyPath(const String& assemblyName) const;
+
 		/**	Gets the managed class for System.Array type. */
 		MonoClass* getSystemArrayClass() const { return mSystemArrayClass; }
 
@@ -113,6 +119,9 @@ namespace bs
 		/**	Gets the managed class for BansheeEngine.SceneObject type. */
 		MonoClass* getSceneObjectClass() const { return mSceneObjectClass; }
 
+		/**	Gets the managed class for BansheeEngine.SerializableUtility type. */
+		MonoClass* getSerializableUtilityClass() const { return mSerializableUtilityClass; }
+
 		/** Gets the managed class for BansheeEngine.Range attribute */
 		MonoClass* getRangeAttribute() const { return mRangeAttribute; }
 
@@ -135,6 +144,7 @@ namespace bs
 		void initializeBuiltinResourceInfos();
 
 		UnorderedMap<String, SPtr<ManagedSerializableAssemblyInfo>> mAssemblyInfos;
+		UnorderedMap<String, Path> mAssemblyPaths;
 		UnorderedMap<::MonoReflectionType*, BuiltinComponentInfo> mBuiltinComponentInfos;
 		UnorderedMap<UINT32, BuiltinComponentInfo> mBuiltinComponentInfosByTID;
 		UnorderedMap<::MonoReflectionType*, BuiltinResourceInfo> mBuiltinResourceInfos;
@@ -151,6 +161,7 @@ namespace bs
 		MonoClass* mManagedComponentClass;
 		MonoClass* mSceneObjectClass;
 		MonoClass* mMissingComponentClass;
+		MonoClass* mSerializableUtilityClass;
 
 		MonoClass* mSerializeObjectAttribute;
 		MonoClass* mDontSerializeFieldAttribute;
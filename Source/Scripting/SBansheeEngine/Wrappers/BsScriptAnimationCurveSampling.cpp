@@ -0,0 +1,124 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "Wrappers/BsScriptAnimationCurveSampling.h"
+#include "BsMonoManager.h"
+#include "BsMonoClass.h"
+#include "BsMonoUtil.h"
+#include "BsMonoArray.h"
+#include "Animation/BsAnimationCurve.h"
+#include "BsScriptTAnimationCurve.generated.h"
+
+namespace bs
+{
+	/** 
+	 * Evaluates the curve at @p count evenly spaced points starting at @p start. A single curve cache is shared by all
+	 * the evaluations so keyframes only need to be searched for when the time moves into a different segment.
+	 */
+	template<class T>
+	void evaluateRange(const TAnimationCurve<T>& curve, float start, float step, bool loop, T* output, UINT32 count)
+	{
+		TCurveCache<T> cache;
+		for (UINT32 i = 0; i < count; i++)
+			output[i] = curve.evaluate(start + i * step, cache, loop);
+	}
+
+	/** Evaluates the curve at each of the provided times. Sorted times will benefit the most from the curve cache. */
+	template<class T>
+	void evaluateMany(const TAnimationCurve<T>& curve, const float* times, bool loop, T* output, UINT32 count)
+	{
+		TCurveCache<T> cache;
+		for (UINT32 i = 0; i < count; i++)
+			output[i] = curve.evaluate(times[i], cache, loop);
+	}
+
+	/** Validates the managed output array and evaluates the curve at evenly spaced points, one for each array element. */
+	template<class T>
+	bool evaluateRange(const SPtr<TAnimationCurve<T>>& curve, float start, float step, bool loop, MonoArray* output)
+	{
+		if (curve == nullptr || output == nullptr)
+			return false;
+
+		// Managed array is referenced from the stack for the duration of the call, so the GC won't move it
+		ScriptArray outputArray(output);
+		if (outputArray.elementSize() != sizeof(T))
+			return false;
+
+		UINT32 count = outputArray.size();
+		if (count == 0)
+			return true;
+
+		evaluateRange(*curve, start, step, loop, (T*)outputArray.getRaw(0, sizeof(T)), count);
+		return true;
+	}
+
+	/** Validates the managed time and output arrays and evaluates the curve at each of the provided times. */
+	template<class T>
+	bool evaluateMany(const SPtr<TAnimationCurve<T>>& curve, MonoArray* times, bool loop, MonoArray* output)
+	{
+		if (curve == nullptr || times == nullptr || output == nullptr)
+			return false;
+
+		ScriptArray timesArray(times);
+		ScriptArray outputArray(output);
+		if (outputArray.elementSize() != sizeof(T) || timesArray.size() > outputArray.size())
+			return false;
+
+		UINT32 count = timesArray.size();
+		if (count == 0)
+			return true;
+
+		evaluateMany(*curve, (float*)timesArray.getRaw(0, sizeof(float)), loop, (T*)outputArray.getRaw(0, sizeof(T)), 
+			count);
+		return true;
+	}
+
+	ScriptAnimationCurveSampling::ScriptAnimationCurveSampling(MonoObject* instance)
+		:ScriptObject(instance)
+	{ }
+
+	void ScriptAnimationCurveSampling::initRuntimeData()
+	{
+		metaData.scriptClass->addInternalCall("Internal_EvaluateRangeFloat", (void*)&ScriptAnimationCurveSampling::internal_EvaluateRangeFloat);
+		metaData.scriptClass->addInternalCall("Internal_EvaluateRangeVector3", (void*)&ScriptAnimationCurveSampling::internal_EvaluateRangeVector3);
+		metaData.scriptClass->addInternalCall("Internal_EvaluateRangeQuaternion", (void*)&ScriptAnimationCurveSampling::internal_EvaluateRangeQuaternion);
+		metaData.scriptClass->addInternalCall("Internal_EvaluateManyFloat", (void*)&ScriptAnimationCurveSampling::internal_EvaluateManyFloat);
+		metaData.scriptClass->addInternalCall("Internal_EvaluateManyVector3", (void*)&ScriptAnimationCurveSampling::internal_EvaluateManyVector3);
+		metaData.scriptClass->addInternalCall("Internal_EvaluateManyQuaternion", (void*)&ScriptAnimationCurveSampling::internal_EvaluateManyQuaternion);
+	}
+
+	bool ScriptAnimationCurveSampling::internal_EvaluateRangeFloat(ScriptTAnimationCurvefloat* thisPtr, float start, 
+		float step, bool loop, MonoArray* output)
+	{
+		return evaluateRange(thisPtr->getInternal(), start, step, loop, output);
+	}
+
+	bool ScriptAnimationCurveSampling::internal_EvaluateRangeVector3(ScriptTAnimationCurveVector3* thisPtr, float start, 
+		float step, bool loop, MonoArray* output)
+	{
+		return evaluateRange(thisPtr->getInternal(), start, step, loop, output);
+	}
+
+	bool ScriptAnimationCurveSampling::internal_EvaluateRangeQuaternion(ScriptTAnimationCurveQuaternion* thisPtr, 
+		float start, float step, bool loop, MonoArray* output)
+	{
+		return evaluateRange(thisPtr->getInternal(), start, step, loop, output);
+	}
+
+	bool ScriptAnimationCurveSampling::internal_EvaluateManyFloat(ScriptTAnimationCurvefloat* thisPtr, MonoArray* times, 
+		bool loop, MonoArray* output)
+	{
+		return evaluateMany(thisPtr->getInternal(), times, loop, output);
+	}
+
+	bool ScriptAnimationCurveSampling::internal_EvaluateManyVector3(ScriptTAnimationCurveVector3* thisPtr, 
+		MonoArray* times, bool loop, MonoArray* output)
+	{
+		return evaluateMany(thisPtr->getInternal(), times, loop, output);
+	}
+
+	bool ScriptAnimationCurveSampling::internal_EvaluateManyQuaternion(ScriptTAnimationCurveQuaternion* thisPtr, 
+		MonoArray* times, bool loop, MonoArray* output)
+	{
+		return evaluateMany(thisPtr->getInternal(), times, loop, output);
+	}
+}
@@ -0,0 +1,48 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsScriptEnginePrerequisites.h"
+#include "BsScriptObject.h"
+
+namespace bs
+{
+	class ScriptTAnimationCurvefloat;
+	class ScriptTAnimationCurveVector3;
+	class ScriptTAnimationCurveQuaternion;
+
+	/** @addtogroup ScriptInteropEngine
+	 *  @{
+	 */
+
+	/** 
+	 * Interop class between C++ & CLR for AnimationCurveSampling. Evaluates animation curves at many points in a single
+	 * call, writing the results directly into caller provided managed arrays.
+	 */
+	class BS_SCR_BE_EXPORT ScriptAnimationCurveSampling : public ScriptObject <ScriptAnimationCurveSampling>
+	{
+	public:
+		SCRIPT_OBJ(ENGINE_ASSEMBLY, "BansheeEngine", "AnimationCurveSampling")
+
+	private:
+		ScriptAnimationCurveSampling(MonoObject* instance);
+
+		/************************************************************************/
+		/* 								CLR HOOKS						   		*/
+		/************************************************************************/
+		static bool internal_EvaluateRangeFloat(ScriptTAnimationCurvefloat* thisPtr, float start, float step, bool loop, 
+			MonoArray* output);
+		static bool internal_EvaluateRangeVector3(ScriptTAnimationCurveVector3* thisPtr, float start, float step, bool loop,
+			MonoArray* output);
+		static bool internal_EvaluateRangeQuaternion(ScriptTAnimationCurveQuaternion* thisPtr, float start, float step, 
+			bool loop, MonoArray* output);
+		static bool internal_EvaluateManyFloat(ScriptTAnimationCurvefloat* thisPtr, MonoArray* times, bool loop, 
+			MonoArray* output);
+		static bool internal_EvaluateManyVector3(ScriptTAnimationCurveVector3* thisPtr, MonoArray* times, bool loop,
+			MonoArray* output);
+		static bool internal_EvaluateManyQuaternion(ScriptTAnimationCurveQuaternion* thisPtr, MonoArray* times, bool loop,
+			MonoArray* output);
+	};
+
+	/** @} */
+}
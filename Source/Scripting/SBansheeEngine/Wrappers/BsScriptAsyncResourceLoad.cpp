@@ -0,0 +1,172 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "Wrappers/BsScriptAsyncResourceLoad.h"
+#include "BsScriptMeta.h"
+#include "BsMonoClass.h"
+#include "BsMonoMethod.h"
+#include "BsMonoUtil.h"
+#include "BsMonoArray.h"
+#include "Resources/BsResources.h"
+#include "BsScriptResourceManager.h"
+#include "Wrappers/BsScriptResource.h"
+#include "Wrappers/BsScriptResourceRef.h"
+#include "BsApplication.h"
+
+namespace bs
+{
+	ScriptAsyncResourceLoad::OnCompletedThunkDef ScriptAsyncResourceLoad::onCompletedThunk;
+	Vector<ScriptAsyncResourceLoad*> ScriptAsyncResourceLoad::sPendingLoads;
+
+	ScriptAsyncResourceLoad::ScriptAsyncResourceLoad(MonoObject* instance, Vector<HResource> resources)
+		:ScriptObject(instance), mResources(std::move(resources))
+	{
+		sPendingLoads.push_back(this);
+	}
+
+	void ScriptAsyncResourceLoad::initRuntimeData()
+	{
+		metaData.scriptClass->addInternalCall("Internal_CreateInstance", (void*)&ScriptAsyncResourceLoad::internal_CreateInstance);
+		metaData.scriptClass->addInternalCall("Internal_IsComplete", (void*)&ScriptAsyncResourceLoad::internal_IsComplete);
+		metaData.scriptClass->addInternalCall("Internal_GetProgress", (void*)&ScriptAsyncResourceLoad::internal_GetProgress);
+		metaData.scriptClass->addInternalCall("Internal_GetCount", (void*)&ScriptAsyncResourceLoad::internal_GetCount);
+		metaData.scriptClass->addInternalCall("Internal_GetResource", (void*)&ScriptAsyncResourceLoad::internal_GetResource);
+		metaData.scriptClass->addInternalCall("Internal_BlockUntilComplete", (void*)&ScriptAsyncResourceLoad::internal_BlockUntilComplete);
+
+		onCompletedThunk = (OnCompletedThunkDef)metaData.scriptClass->getMethod("Internal_OnCompleted")->getThunk();
+	}
+
+	void ScriptAsyncResourceLoad::update()
+	{
+		// Completion callbacks can start new loads, or release existing ones
+		Vector<ScriptAsyncResourceLoad*> completedLoads;
+		for (auto& entry : sPendingLoads)
+		{
+			if (entry->isLoaded())
+				completedLoads.push_back(entry);
+		}
+
+		for (auto& entry : completedLoads)
+		{
+			if (!entry->mIsComplete)
+				entry->complete();
+		}
+	}
+
+	bool ScriptAsyncResourceLoad::isLoaded() const
+	{
+		for (auto& entry : mResources)
+		{
+			// Resources that couldn't be found have an empty handle
+			if (!entry.getUUID().empty() && !entry.isLoaded())
+				return false;
+		}
+
+		return true;
+	}
+
+	void ScriptAsyncResourceLoad::complete()
+	{
+		mIsComplete = true;
+
+		auto iterFind = std::find(sPendingLoads.begin(), sPendingLoads.end(), this);
+		if (iterFind != sPendingLoads.end())
+			sPendingLoads.erase(iterFind);
+
+		MonoUtil::invokeThunk(onCompletedThunk, getManagedInstance());
+	}
+
+	void ScriptAsyncResourceLoad::_onManagedInstanceDeleted(bool assemblyRefresh)
+	{
+		auto iterFind = std::find(sPendingLoads.begin(), sPendingLoads.end(), this);
+		if (iterFind != sPendingLoads.end())
+			sPendingLoads.erase(iterFind);
+
+		ScriptObject::_onManagedInstanceDeleted(assemblyRefresh);
+	}
+
+	void ScriptAsyncResourceLoad::internal_CreateInstance(MonoObject* instance, MonoArray* references, bool keepLoaded)
+	{
+		ResourceLoadFlags loadFlags = ResourceLoadFlag::LoadDependencies;
+		if (keepLoaded)
+			loadFlags |= ResourceLoadFlag::KeepInternalRef;
+
+		if (gApplication().isEditor())
+			loadFlags |= ResourceLoadFlag::KeepSourceData;
+
+		Vector<HResource> resources;
+		if (references != nullptr)
+		{
+			ScriptArray referenceArray(references);
+
+			UINT32 numReferences = referenceArray.size();
+			resources.reserve(numReferences);
+
+			// All loads are queued before any are waited on, so they can proceed in parallel
+			for (UINT32 i = 0; i < numReferences; i++)
+			{
+				ScriptResourceRef* scriptRef = ScriptResourceRef::toNative(referenceArray.get<MonoObject*>(i));
+				if (scriptRef == nullptr)
+				{
+					resources.push_back(HResource());
+					continue;
+				}
+
+				resources.push_back(gResources().loadFromUUID(scriptRef->getHandle().getUUID(), true, loadFlags));
+			}
+		}
+
+		new (bs_alloc<ScriptAsyncResourceLoad>()) ScriptAsyncResourceLoad(instance, std::move(resources));
+	}
+
+	bool ScriptAsyncResourceLoad::internal_IsComplete(ScriptAsyncResourceLoad* thisPtr)
+	{
+		return thisPtr->mIsComplete;
+	}
+
+	float ScriptAsyncResourceLoad::internal_GetProgress(ScriptAsyncResourceLoad* thisPtr)
+	{
+		if (thisPtr->mIsComplete || thisPtr->mResources.empty())
+			return 1.0f;
+
+		UINT32 numLoaded = 0;
+		for (auto& entry : thisPtr->mResources)
+		{
+			if (entry.getUUID().empty() || entry.isLoaded())
+				numLoaded++;
+		}
+
+		return numLoaded / (float)thisPtr->mResources.size();
+	}
+
+	UINT32 ScriptAsyncResourceLoad::internal_GetCount(ScriptAsyncResourceLoad* thisPtr)
+	{
+		return (UINT32)thisPtr->mResources.size();
+	}
+
+	MonoObject* ScriptAsyncResourceLoad::internal_GetResource(ScriptAsyncResourceLoad* thisPtr, UINT32 idx)
+	{
+		if (idx >= (UINT32)thisPtr->mResources.size())
+			return nullptr;
+
+		const HResource& resource = thisPtr->mResources[idx];
+		if (resource.getUUID().empty() || !resource.isLoaded())
+			return nullptr;
+
+		ScriptResourceBase* scriptResource = ScriptResourceManager::instance().getScriptResource(resource, true);
+		return scriptResource->getManagedInstance();
+	}
+
+	void ScriptAsyncResourceLoad::internal_BlockUntilComplete(ScriptAsyncResourceLoad* thisPtr)
+	{
+		if (thisPtr->mIsComplete)
+			return;
+
+		for (auto& entry : thisPtr->mResources)
+		{
+			if (!entry.getUUID().empty())
+				entry.blockUntilLoaded();
+		}
+
+		thisPtr->complete();
+	}
+}
@@ -0,0 +1,61 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsScriptEnginePrerequisites.h"
+#include "BsScriptObject.h"
+
+namespace bs
+{
+	/** @addtogroup ScriptInteropEngine
+	 *  @{
+	 */
+
+	/**
+	 * Interop class between C++ & CLR for AsyncResourceLoad. Tracks a batch of resources loading on worker threads, and
+	 * notifies the managed object on the main thread once all of them have finished loading.
+	 */
+	class BS_SCR_BE_EXPORT ScriptAsyncResourceLoad : public ScriptObject<ScriptAsyncResourceLoad>
+	{
+	public:
+		SCRIPT_OBJ(ENGINE_ASSEMBLY, "BansheeEngine", "AsyncResourceLoad")
+
+		/**
+		 * Triggers completion callbacks for all pending loads whose resources have finished loading. Should be called
+		 * once per frame.
+		 */
+		static void update();
+
+	private:
+		ScriptAsyncResourceLoad(MonoObject* instance, Vector<HResource> resources);
+
+		/** Checks have all the resources in the batch finished loading, including their dependencies. */
+		bool isLoaded() const;
+
+		/** Marks the load as complete, removes it from the pending list and notifies the managed instance. */
+		void complete();
+
+		/** @copydoc ScriptObjectBase::_onManagedInstanceDeleted */
+		void _onManagedInstanceDeleted(bool assemblyRefresh) override;
+
+		Vector<HResource> mResources;
+		bool mIsComplete = false;
+
+		static Vector<ScriptAsyncResourceLoad*> sPendingLoads;
+
+		/************************************************************************/
+		/* 								CLR HOOKS						   		*/
+		/************************************************************************/
+		typedef void(BS_THUNKCALL *OnCompletedThunkDef) (MonoObject*, MonoException**);
+		static OnCompletedThunkDef onCompletedThunk;
+
+		static void internal_CreateInstance(MonoObject* instance, MonoArray* references, bool keepLoaded);
+		static bool internal_IsComplete(ScriptAsyncResourceLoad* thisPtr);
+		static float internal_GetProgress(ScriptAsyncResourceLoad* thisPtr);
+		static UINT32 internal_GetCount(ScriptAsyncResourceLoad* thisPtr);
+		static MonoObject* internal_GetResource(ScriptAsyncResourceLoad* thisPtr, UINT32 idx);
+		static void internal_BlockUntilComplete(ScriptAsyncResourceLoad* thisPtr);
+	};
+
+	/** @} */
+}
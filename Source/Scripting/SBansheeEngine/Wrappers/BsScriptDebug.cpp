@@ -10,8 +10,19 @@
 
 namespace bs
 {
+	const UINT32 ScriptDebug::QUEUE_CAPACITY = 8192;
+
 	HEvent ScriptDebug::mOnLogEntryAddedConn;
-	ScriptDebug::OnAddedThunkDef ScriptDebug::onAddedThunk = nullptr;
+	Mutex ScriptDebug::mQueueMutex;
+	Vector<ScriptDebug::QueuedLogEntry> ScriptDebug::mQueue;
+	UINT32 ScriptDebug::mQueueStart = 0;
+	UINT32 ScriptDebug::mQueueCount = 0;
+	UINT32 ScriptDebug::mNumDropped = 0;
+	UINT32 ScriptDebug::mMaxEntriesPerFrame = 100;
+	Vector<ScriptDebug::QueuedLogEntry> ScriptDebug::mTempEntries;
+	Vector<LogEntry> ScriptDebug::mHistory;
+
+	ScriptDebug::OnAddedBatchThunkDef ScriptDebug::onAddedBatchThunk = nullptr;
 
 	/**	C++ version of the managed LogEntry structure. */
 	struct ScriptLogEntryData
@@ -32,26 +43,121 @@ namespace bs
 		metaData.scriptClass->addInternalCall("Internal_LogMessage", (void*)&ScriptDebug::internal_logMessage);
 		metaData.scriptClass->addInternalCall("Internal_Clear", (void*)&ScriptDebug::internal_clear);
 		metaData.scriptClass->addInternalCall("Internal_ClearType", (void*)&ScriptDebug::internal_clearType);
+		metaData.scriptClass->addInternalCall("Internal_GetNumMessages", (void*)&ScriptDebug::internal_getNumMessages);
 		metaData.scriptClass->addInternalCall("Internal_GetMessages", (void*)&ScriptDebug::internal_getMessages);
+		metaData.scriptClass->addInternalCall("Internal_GetMaxMessagesPerFrame",
+			(void*)&ScriptDebug::internal_getMaxMessagesPerFrame);
+		metaData.scriptClass->addInternalCall("Internal_SetMaxMessagesPerFrame",
+			(void*)&ScriptDebug::internal_setMaxMessagesPerFrame);
 
-		onAddedThunk = (OnAddedThunkDef)metaData.scriptClass->getMethod("Internal_OnAdded", 2)->getThunk();
+		onAddedBatchThunk = (OnAddedBatchThunkDef)metaData.scriptClass->getMethod("Internal_OnAddedBatch", 4)->getThunk();
 	}
 
 	void ScriptDebug::startUp()
 	{
+		Lock lock(mQueueMutex);
+
+		mQueue.resize(QUEUE_CAPACITY);
+		mQueueStart = 0;
+		mQueueCount = 0;
+		mNumDropped = 0;
+
+		// Connect before copying the existing entries, while holding the lock, so no entries are missed
 		mOnLogEntryAddedConn = gDebug().onLogEntryAdded.connect(&ScriptDebug::onLogEntryAdded);
+		mHistory = gDebug().getLog().getEntries();
 	}
 
 	void ScriptDebug::shutDown()
 	{
 		mOnLogEntryAddedConn.disconnect();
+
+		Lock lock(mQueueMutex);
+		mQueue.clear();
+		mQueueStart = 0;
+		mQueueCount = 0;
+		mHistory.clear();
 	}
 
 	void ScriptDebug::onLogEntryAdded(const LogEntry& entry)
 	{
-		MonoString* message = MonoUtil::stringToMono(entry.getMessage());
+		// Note: Can't call into managed code here since the entry could have been logged from any thread. Instead queue
+		// the entry and forward it on the next update().
+		Lock lock(mQueueMutex);
+
+		mHistory.push_back(entry);
+
+		// Collapse repeated messages into a single entry
+		if (mQueueCount > 0)
+		{
+			QueuedLogEntry& lastEntry = mQueue[(mQueueStart + mQueueCount - 1) % QUEUE_CAPACITY];
+			if (lastEntry.channel == entry.getChannel() && lastEntry.message == entry.getMessage())
+			{
+				lastEntry.count++;
+				return;
+			}
+		}
 
-		MonoUtil::invokeThunk(onAddedThunk, entry.getChannel(), message);
+		// Keep the oldest entries when full, as the first messages of a burst are usually the most relevant ones. The
+		// dropped entries can still be retrieved from the log itself.
+		if (mQueueCount == (UINT32)mQueue.size())
+		{
+			mNumDropped++;
+			return;
+		}
+
+		QueuedLogEntry& queuedEntry = mQueue[(mQueueStart + mQueueCount) % QUEUE_CAPACITY];
+		queuedEntry.channel = entry.getChannel();
+		queuedEntry.message = entry.getMessage();
+		queuedEntry.count = 1;
+
+		mQueueCount++;
+	}
+
+	void ScriptDebug::update()
+	{
+		UINT32 numDropped;
+		{
+			Lock lock(mQueueMutex);
+
+			UINT32 numEntries = mQueueCount;
+			if (mMaxEntriesPerFrame > 0)
+				numEntries = std::min(numEntries, mMaxEntriesPerFrame);
+
+			for (UINT32 i = 0; i < numEntries; i++)
+			{
+				QueuedLogEntry& queuedEntry = mQueue[(mQueueStart + i) % QUEUE_CAPACITY];
+				mTempEntries.push_back(std::move(queuedEntry));
+
+				queuedEntry.message.clear();
+			}
+
+			mQueueStart = (mQueueStart + numEntries) % QUEUE_CAPACITY;
+			mQueueCount -= numEntries;
+
+			numDropped = mNumDropped;
+			mNumDropped = 0;
+		}
+
+		if (mTempEntries.empty() && numDropped == 0)
+			return;
+
+		// Forward all entries in a single managed call, outside of the lock since managed code might log new entries
+		UINT32 numEntries = (UINT32)mTempEntries.size();
+		ScriptArray types = ScriptArray::create<UINT32>(numEntries);
+		ScriptArray messages = ScriptArray::create<String>(numEntries);
+		ScriptArray counts = ScriptArray::create<UINT32>(numEntries);
+
+		for (UINT32 i = 0; i < numEntries; i++)
+		{
+			types.set(i, mTempEntries[i].channel);
+			messages.set(i, MonoUtil::stringToMono(mTempEntries[i].message));
+			counts.set(i, mTempEntries[i].count);
+		}
+
+		mTempEntries.clear();
+
+		MonoUtil::invokeThunk(onAddedBatchThunk, types.getInternal(), messages.getInternal(), counts.getInternal(),
+			numDropped);
 	}
 
 	void ScriptDebug::internal_log(MonoString* message)
@@ -77,27 +183,92 @@ namespace bs
 	void ScriptDebug::internal_clear()
 	{
 		gDebug().getLog().clear();
+
+		// Don't report entries that were cleared before they were forwarded
+		Lock lock(mQueueMutex);
+		for (UINT32 i = 0; i < mQueueCount; i++)
+			mQueue[(mQueueStart + i) % QUEUE_CAPACITY].message.clear();
+
+		mQueueStart = 0;
+		mQueueCount = 0;
+		mNumDropped = 0;
+
+		mHistory.clear();
 	}
 
 	void ScriptDebug::internal_clearType(UINT32 type)
 	{
 		gDebug().getLog().clear(type);
+
+		// Don't report entries that were cleared before they were forwarded
+		Lock lock(mQueueMutex);
+
+		UINT32 numRemaining = 0;
+		for (UINT32 i = 0; i < mQueueCount; i++)
+		{
+			QueuedLogEntry& entry = mQueue[(mQueueStart + i) % QUEUE_CAPACITY];
+			if (entry.channel == type)
+			{
+				entry.message.clear();
+				continue;
+			}
+
+			if (numRemaining != i)
+				mQueue[(mQueueStart + numRemaining) % QUEUE_CAPACITY] = std::move(entry);
+
+			numRemaining++;
+		}
+
+		mQueueCount = numRemaining;
+
+		mHistory.erase(std::remove_if(mHistory.begin(), mHistory.end(),
+			[type](const LogEntry& entry) { return entry.getChannel() == type; }), mHistory.end());
 	}
 
-	MonoArray* ScriptDebug::internal_getMessages()
+	UINT32 ScriptDebug::internal_getNumMessages()
 	{
-		Vector<LogEntry> entries = gDebug().getLog().getEntries();
+		Lock lock(mQueueMutex);
+		return (UINT32)mHistory.size();
+	}
+
+	MonoArray* ScriptDebug::internal_getMessages(UINT32 offset, UINT32 count)
+	{
+		// Only copy the requested range, as copying and converting the entire history can be expensive
+		Vector<LogEntry> entries;
+		{
+			Lock lock(mQueueMutex);
+
+			UINT32 numAllEntries = (UINT32)mHistory.size();
+			UINT32 start = std::min(offset, numAllEntries);
+			UINT32 numEntries = std::min(count, numAllEntries - start);
+
+			entries.assign(mHistory.begin() + start, mHistory.begin() + start + numEntries);
+		}
 
+		// Managed strings are created outside of the lock, as it's also taken by threads that log
 		UINT32 numEntries = (UINT32)entries.size();
 		ScriptArray output = ScriptArray::create<ScriptLogEntry>(numEntries);
 		for (UINT32 i = 0; i < numEntries; i++)
 		{
-			MonoString* message = MonoUtil::stringToMono(entries[i].getMessage());
+			const LogEntry& entry = entries[i];
+			MonoString* message = MonoUtil::stringToMono(entry.getMessage());
 
-			ScriptLogEntryData scriptEntry = { entries[i].getChannel(), message };
+			ScriptLogEntryData scriptEntry = { entry.getChannel(), message };
 			output.set(i, scriptEntry);
 		}
 
 		return output.getInternal();
 	}
+
+	UINT32 ScriptDebug::internal_getMaxMessagesPerFrame()
+	{
+		Lock lock(mQueueMutex);
+		return mMaxEntriesPerFrame;
+	}
+
+	void ScriptDebug::internal_setMaxMessagesPerFrame(INT32 value)
+	{
+		Lock lock(mQueueMutex);
+		mMaxEntriesPerFrame = (UINT32)std::max(value, 0);
+	}
 }
\ No newline at end of file
@@ -22,14 +22,42 @@ namespace bs
 
 		/**	Unregisters internal callbacks. Must be called on scripting system shutdown. */
 		static void shutDown();
+
+		/** Forwards log entries queued since the last call to managed code. Must be called once per frame. */
+		static void update();
 	private:
+		/** Log entry waiting to be forwarded to managed code. */
+		struct QueuedLogEntry
+		{
+			UINT32 channel = 0;
+			String message;
+			UINT32 count = 0; /**< Number of times the same message was logged in succession. */
+		};
+
 		ScriptDebug(MonoObject* instance);
 
-		/**	Triggered when a new entry is added to the debug log. */
+		/**	Triggered when a new entry is added to the debug log. Can be called from any thread. */
 		static void onLogEntryAdded(const LogEntry& entry);
 
+		/** Maximum number of entries that can be queued. Entries added while the queue is full are dropped. */
+		static const UINT32 QUEUE_CAPACITY;
+
 		static HEvent mOnLogEntryAddedConn;
 
+		static Mutex mQueueMutex;
+		static Vector<QueuedLogEntry> mQueue; /**< Ring buffer of QUEUE_CAPACITY entries. */
+		static UINT32 mQueueStart;
+		static UINT32 mQueueCount;
+		static UINT32 mNumDropped;
+		static UINT32 mMaxEntriesPerFrame;
+		static Vector<QueuedLogEntry> mTempEntries;
+
+		/**
+		 * Copy of the native log that can be counted and accessed by range, without copying the entire log as
+		 * Log::getEntries() does. Guarded by the queue mutex.
+		 */
+		static Vector<LogEntry> mHistory;
+
 		/************************************************************************/
 		/* 								CLR HOOKS						   		*/
 		/************************************************************************/
@@ -39,11 +67,14 @@ namespace bs
 		static void internal_logMessage(MonoString* message, UINT32 type);
 		static void internal_clear();
 		static void internal_clearType(UINT32 type);
-		static MonoArray* internal_getMessages();
+		static UINT32 internal_getNumMessages();
+		static MonoArray* internal_getMessages(UINT32 offset, UINT32 count);
+		static UINT32 internal_getMaxMessagesPerFrame();
+		static void internal_setMaxMessagesPerFrame(INT32 value);
 
-		typedef void(BS_THUNKCALL *OnAddedThunkDef) (UINT32, MonoString*, MonoException**);
+		typedef void(BS_THUNKCALL *OnAddedBatchThunkDef) (MonoArray*, MonoArray*, MonoArray*, UINT32, MonoException**);
 
-		static OnAddedThunkDef onAddedThunk;
+		static OnAddedBatchThunkDef onAddedBatchThunk;
 	};
 
 	/** @} */
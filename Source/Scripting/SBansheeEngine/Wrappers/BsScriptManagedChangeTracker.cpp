@@ -0,0 +1,29 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "Wrappers/BsScriptManagedChangeTracker.h"
+#include "BsMonoClass.h"
+#include "BsManagedChangeTracker.h"
+
+namespace bs
+{
+	ScriptManagedChangeTracker::ScriptManagedChangeTracker(MonoObject* instance)
+		:ScriptObject(instance)
+	{ }
+
+	void ScriptManagedChangeTracker::initRuntimeData()
+	{
+		metaData.scriptClass->addInternalCall("Internal_GetVersion", (void*)&ScriptManagedChangeTracker::internal_GetVersion);
+		metaData.scriptClass->addInternalCall("Internal_NotifyAllModified",
+			(void*)&ScriptManagedChangeTracker::internal_NotifyAllModified);
+	}
+
+	UINT64 ScriptManagedChangeTracker::internal_GetVersion(UINT64 instanceId)
+	{
+		return ManagedChangeTracker::getVersion(instanceId);
+	}
+
+	void ScriptManagedChangeTracker::internal_NotifyAllModified()
+	{
+		ManagedChangeTracker::notifyAllModified();
+	}
+}
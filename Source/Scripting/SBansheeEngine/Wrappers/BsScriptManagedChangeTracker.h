@@ -0,0 +1,31 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsScriptEnginePrerequisites.h"
+#include "BsScriptObject.h"
+
+namespace bs
+{
+	/** @addtogroup ScriptInteropEngine
+	 *  @{
+	 */
+
+	/**	Interop class between C++ & CLR for ManagedChangeTracker. */
+	class BS_SCR_BE_EXPORT ScriptManagedChangeTracker : public ScriptObject<ScriptManagedChangeTracker>
+	{
+	public:
+		SCRIPT_OBJ(ENGINE_ASSEMBLY, "BansheeEngine", "ManagedChangeTracker")
+
+	private:
+		ScriptManagedChangeTracker(MonoObject* instance);
+
+		/************************************************************************/
+		/* 								CLR HOOKS						   		*/
+		/************************************************************************/
+		static UINT64 internal_GetVersion(UINT64 instanceId);
+		static void internal_NotifyAllModified();
+	};
+
+	/** @} */
+}
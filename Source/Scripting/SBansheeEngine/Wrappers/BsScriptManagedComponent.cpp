@@ -13,6 +13,7 @@
 #include "Wrappers/BsScriptSceneObject.h"
 #include "Serialization/BsScriptAssemblyManager.h"
 #include "BsManagedComponent.h"
+#include "BsManagedUpdateBatcher.h"
 #include "Scene/BsSceneObject.h"
 #include "BsMonoUtil.h"
 
@@ -32,6 +33,20 @@ namespace bs
 	void ScriptManagedComponent::initRuntimeData()
 	{
 		metaData.scriptClass->addInternalCall("Internal_Invoke", (void*)&ScriptManagedComponent::internal_invoke);
+		metaData.scriptClass->addInternalCall("Internal_GetBatchedUpdates",
+			(void*)&ScriptManagedComponent::internal_getBatchedUpdates);
+		metaData.scriptClass->addInternalCall("Internal_SetBatchedUpdates",
+			(void*)&ScriptManagedComponent::internal_setBatchedUpdates);
+	}
+
+	bool ScriptManagedComponent::internal_getBatchedUpdates()
+	{
+		return ManagedUpdateBatcher::isEnabled();
+	}
+
+	void ScriptManagedComponent::internal_setBatchedUpdates(bool enabled)
+	{
+		ManagedUpdateBatcher::instance().setEnabled(enabled);
 	}
 
 	void ScriptManagedComponent::internal_invoke(ScriptManagedComponent* nativeInstance, MonoString* name)
@@ -60,6 +60,8 @@ namespace bs
 		/* 								CLR HOOKS						   		*/
 		/************************************************************************/
 		static void internal_invoke(ScriptManagedComponent* nativeInstance, MonoString* name);
+		static bool internal_getBatchedUpdates();
+		static void internal_setBatchedUpdates(bool enabled);
 	};
 
 	/** @} */
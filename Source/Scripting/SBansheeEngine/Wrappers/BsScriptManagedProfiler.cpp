@@ -0,0 +1,192 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "Wrappers/BsScriptManagedProfiler.h"
+#include "BsMonoManager.h"
+#include "BsMonoClass.h"
+#include "BsMonoMethod.h"
+#include "BsMonoUtil.h"
+#include "BsMonoArray.h"
+#include "BsManagedProfiler.h"
+
+namespace bs
+{
+	MonoMethod* ScriptManagedProfiler::sGetHeapSizeMethod = nullptr;
+
+	/**	C++ version of the managed ManagedTypeSample structure. */
+	struct ScriptManagedTypeSampleData
+	{
+		MonoString* typeName;
+		UINT32 numCalls;
+		float time;
+		UINT64 gcAllocated;
+	};
+
+	/**	C++ version of the managed ManagedInstanceSample structure. */
+	struct ScriptManagedInstanceSampleData
+	{
+		UINT64 instanceId;
+		MonoString* typeName;
+		UINT32 numCalls;
+		float time;
+		UINT64 gcAllocated;
+	};
+
+	ScriptManagedProfiler::ScriptManagedProfiler(MonoObject* instance)
+		:ScriptObject(instance)
+	{ }
+
+	void ScriptManagedProfiler::initRuntimeData()
+	{
+		metaData.scriptClass->addInternalCall("Internal_SetEnabled", (void*)&ScriptManagedProfiler::internal_SetEnabled);
+		metaData.scriptClass->addInternalCall("Internal_IsEnabled", (void*)&ScriptManagedProfiler::internal_IsEnabled);
+		metaData.scriptClass->addInternalCall("Internal_SetTrackAllocations", (void*)&ScriptManagedProfiler::internal_SetTrackAllocations);
+		metaData.scriptClass->addInternalCall("Internal_GetTrackAllocations", (void*)&ScriptManagedProfiler::internal_GetTrackAllocations);
+		metaData.scriptClass->addInternalCall("Internal_SetCaptureEvents", (void*)&ScriptManagedProfiler::internal_SetCaptureEvents);
+		metaData.scriptClass->addInternalCall("Internal_GetCaptureEvents", (void*)&ScriptManagedProfiler::internal_GetCaptureEvents);
+		metaData.scriptClass->addInternalCall("Internal_GetNumFrames", (void*)&ScriptManagedProfiler::internal_GetNumFrames);
+		metaData.scriptClass->addInternalCall("Internal_GetFrameInfo", (void*)&ScriptManagedProfiler::internal_GetFrameInfo);
+		metaData.scriptClass->addInternalCall("Internal_GetTypeSamples", (void*)&ScriptManagedProfiler::internal_GetTypeSamples);
+		metaData.scriptClass->addInternalCall("Internal_GetInstanceSamples", (void*)&ScriptManagedProfiler::internal_GetInstanceSamples);
+		metaData.scriptClass->addInternalCall("Internal_Clear", (void*)&ScriptManagedProfiler::internal_Clear);
+		metaData.scriptClass->addInternalCall("Internal_SaveTrace", (void*)&ScriptManagedProfiler::internal_SaveTrace);
+
+		sGetHeapSizeMethod = metaData.scriptClass->getMethod("Internal_GetManagedHeapSize", 0);
+	}
+
+	UINT64 ScriptManagedProfiler::getManagedHeapSize()
+	{
+		if (sGetHeapSizeMethod == nullptr)
+			return 0;
+
+		MonoObject* heapSizeObj = sGetHeapSizeMethod->invoke(nullptr, nullptr);
+		return *(UINT64*)MonoUtil::unbox(heapSizeObj);
+	}
+
+	void ScriptManagedProfiler::internal_SetEnabled(bool enabled)
+	{
+		ManagedProfiler::instance().setEnabled(enabled);
+	}
+
+	bool ScriptManagedProfiler::internal_IsEnabled()
+	{
+		return ManagedProfiler::isEnabled();
+	}
+
+	void ScriptManagedProfiler::internal_SetTrackAllocations(bool track)
+	{
+		ManagedProfiler::instance().setTrackAllocations(track);
+	}
+
+	bool ScriptManagedProfiler::internal_GetTrackAllocations()
+	{
+		return ManagedProfiler::instance().getTrackAllocations();
+	}
+
+	void ScriptManagedProfiler::internal_SetCaptureEvents(bool capture)
+	{
+		ManagedProfiler::instance().setCaptureEvents(capture);
+	}
+
+	bool ScriptManagedProfiler::internal_GetCaptureEvents()
+	{
+		return ManagedProfiler::instance().getCaptureEvents();
+	}
+
+	UINT32 ScriptManagedProfiler::internal_GetNumFrames()
+	{
+		return ManagedProfiler::instance().getNumFrames();
+	}
+
+	void ScriptManagedProfiler::internal_GetFrameInfo(UINT32 idx, UINT64* frameIdx, float* duration)
+	{
+		ManagedProfiler& profiler = ManagedProfiler::instance();
+		if (idx >= profiler.getNumFrames())
+		{
+			*frameIdx = 0;
+			*duration = 0.0f;
+			return;
+		}
+
+		const ManagedFrameSample& frame = profiler.getFrame(idx);
+		*frameIdx = frame.frameIdx;
+		*duration = frame.duration / 1000000.0f;
+	}
+
+	MonoArray* ScriptManagedProfiler::internal_GetTypeSamples(UINT32 idx)
+	{
+		ManagedProfiler& profiler = ManagedProfiler::instance();
+		if (idx >= profiler.getNumFrames())
+			return ScriptArray::create<ScriptManagedTypeSample>(0).getInternal();
+
+		const ManagedFrameSample& frame = profiler.getFrame(idx);
+
+		UINT32 numEntries = (UINT32)frame.types.size();
+		ScriptArray output = ScriptArray::create<ScriptManagedTypeSample>(numEntries);
+		for (UINT32 i = 0; i < numEntries; i++)
+		{
+			const ManagedTypeSample& sample = frame.types[i];
+
+			ScriptManagedTypeSampleData scriptEntry;
+			scriptEntry.typeName = MonoUtil::stringToMono(profiler.getTypeName(sample.typeId));
+			scriptEntry.numCalls = sample.numCalls;
+			scriptEntry.time = sample.time / 1000000.0f;
+			scriptEntry.gcAllocated = sample.gcAllocated;
+
+			output.set(i, scriptEntry);
+		}
+
+		return output.getInternal();
+	}
+
+	MonoArray* ScriptManagedProfiler::internal_GetInstanceSamples(UINT32 idx)
+	{
+		ManagedProfiler& profiler = ManagedProfiler::instance();
+		if (idx >= profiler.getNumFrames())
+			return ScriptArray::create<ScriptManagedInstanceSample>(0).getInternal();
+
+		const ManagedFrameSample& frame = profiler.getFrame(idx);
+
+		UINT32 numEntries = (UINT32)frame.instances.size();
+		ScriptArray output = ScriptArray::create<ScriptManagedInstanceSample>(numEntries);
+		for (UINT32 i = 0; i < numEntries; i++)
+		{
+			const ManagedInstanceSample& sample = frame.instances[i];
+
+			ScriptManagedInstanceSampleData scriptEntry;
+			scriptEntry.instanceId = sample.instanceId;
+			scriptEntry.typeName = MonoUtil::stringToMono(profiler.getTypeName(sample.typeId));
+			scriptEntry.numCalls = sample.numCalls;
+			scriptEntry.time = sample.time / 1000000.0f;
+			scriptEntry.gcAllocated = sample.gcAllocated;
+
+			output.set(i, scriptEntry);
+		}
+
+		return output.getInternal();
+	}
+
+	void ScriptManagedProfiler::internal_Clear()
+	{
+		ManagedProfiler::instance().clear();
+	}
+
+	void ScriptManagedProfiler::internal_SaveTrace(MonoString* path)
+	{
+		Path nativePath = MonoUtil::monoToString(path);
+		ManagedProfiler::instance().saveTrace(nativePath);
+	}
+
+	ScriptManagedTypeSample::ScriptManagedTypeSample(MonoObject* instance)
+		:ScriptObject(instance)
+	{ }
+
+	void ScriptManagedTypeSample::initRuntimeData()
+	{ }
+
+	ScriptManagedInstanceSample::ScriptManagedInstanceSample(MonoObject* instance)
+		:ScriptObject(instance)
+	{ }
+
+	void ScriptManagedInstanceSample::initRuntimeData()
+	{ }
+}
@@ -0,0 +1,66 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsScriptEnginePrerequisites.h"
+#include "BsScriptObject.h"
+
+namespace bs
+{
+	/** @addtogroup ScriptInteropEngine
+	 *  @{
+	 */
+
+	/**	Interop class between C++ & CLR for ManagedProfiler. */
+	class BS_SCR_BE_EXPORT ScriptManagedProfiler : public ScriptObject<ScriptManagedProfiler>
+	{
+	public:
+		SCRIPT_OBJ(ENGINE_ASSEMBLY, "BansheeEngine", "ManagedProfiler")
+
+		/** Returns the number of bytes currently in use by the managed heap. */
+		static UINT64 getManagedHeapSize();
+
+	private:
+		ScriptManagedProfiler(MonoObject* instance);
+
+		static MonoMethod* sGetHeapSizeMethod;
+
+		/************************************************************************/
+		/* 								CLR HOOKS						   		*/
+		/************************************************************************/
+		static void internal_SetEnabled(bool enabled);
+		static bool internal_IsEnabled();
+		static void internal_SetTrackAllocations(bool track);
+		static bool internal_GetTrackAllocations();
+		static void internal_SetCaptureEvents(bool capture);
+		static bool internal_GetCaptureEvents();
+		static UINT32 internal_GetNumFrames();
+		static void internal_GetFrameInfo(UINT32 idx, UINT64* frameIdx, float* duration);
+		static MonoArray* internal_GetTypeSamples(UINT32 idx);
+		static MonoArray* internal_GetInstanceSamples(UINT32 idx);
+		static void internal_Clear();
+		static void internal_SaveTrace(MonoString* path);
+	};
+
+	/**	Interop class between C++ & CLR for ManagedTypeSample. */
+	class BS_SCR_BE_EXPORT ScriptManagedTypeSample : public ScriptObject<ScriptManagedTypeSample>
+	{
+	public:
+		SCRIPT_OBJ(ENGINE_ASSEMBLY, "BansheeEngine", "ManagedTypeSample")
+
+	private:
+		ScriptManagedTypeSample(MonoObject* instance);
+	};
+
+	/**	Interop class between C++ & CLR for ManagedInstanceSample. */
+	class BS_SCR_BE_EXPORT ScriptManagedInstanceSample : public ScriptObject<ScriptManagedInstanceSample>
+	{
+	public:
+		SCRIPT_OBJ(ENGINE_ASSEMBLY, "BansheeEngine", "ManagedInstanceSample")
+
+	private:
+		ScriptManagedInstanceSample(MonoObject* instance);
+	};
+
+	/** @} */
+}
@@ -0,0 +1,111 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "Wrappers/BsScriptMeshDataStreams.h"
+#include "BsMonoManager.h"
+#include "BsMonoClass.h"
+#include "BsMonoUtil.h"
+#include "BsMonoArray.h"
+#include "Extensions/BsMeshDataEx.h"
+#include "BsScriptRendererMeshData.generated.h"
+
+namespace bs
+{
+	ScriptMeshDataStreams::ScriptMeshDataStreams(MonoObject* instance)
+		:ScriptObject(instance)
+	{ }
+
+	void ScriptMeshDataStreams::initRuntimeData()
+	{
+		metaData.scriptClass->addInternalCall("Internal_ReadElements", (void*)&ScriptMeshDataStreams::internal_ReadElements);
+		metaData.scriptClass->addInternalCall("Internal_WriteElements", (void*)&ScriptMeshDataStreams::internal_WriteElements);
+		metaData.scriptClass->addInternalCall("Internal_ReadIndices", (void*)&ScriptMeshDataStreams::internal_ReadIndices);
+		metaData.scriptClass->addInternalCall("Internal_WriteIndices", (void*)&ScriptMeshDataStreams::internal_WriteIndices);
+		metaData.scriptClass->addInternalCall("Internal_ReadVertexStream", (void*)&ScriptMeshDataStreams::internal_ReadVertexStream);
+		metaData.scriptClass->addInternalCall("Internal_WriteVertexStream", (void*)&ScriptMeshDataStreams::internal_WriteVertexStream);
+		metaData.scriptClass->addInternalCall("Internal_GetVertexStride", (void*)&ScriptMeshDataStreams::internal_GetVertexStride);
+		metaData.scriptClass->addInternalCall("Internal_GetElementOffset", (void*)&ScriptMeshDataStreams::internal_GetElementOffset);
+	}
+
+	bool ScriptMeshDataStreams::internal_ReadElements(ScriptRendererMeshData* thisPtr, VertexLayout type, MonoArray* buffer)
+	{
+		if (buffer == nullptr)
+			return false;
+
+		// Managed array is referenced from the stack for the duration of the call, so the GC won't move it
+		ScriptArray array(buffer);
+		if (array.elementSize() != MeshDataEx::getElementSize(type))
+			return false;
+
+		UINT8* data = (UINT8*)array.getRaw(0, array.elementSize());
+		UINT32 size = array.size() * array.elementSize();
+
+		return MeshDataEx::readElements(thisPtr->getInternal(), type, data, size);
+	}
+
+	bool ScriptMeshDataStreams::internal_WriteElements(ScriptRendererMeshData* thisPtr, VertexLayout type, MonoArray* buffer)
+	{
+		if (buffer == nullptr)
+			return false;
+
+		ScriptArray array(buffer);
+		if (array.elementSize() != MeshDataEx::getElementSize(type))
+			return false;
+
+		UINT8* data = (UINT8*)array.getRaw(0, array.elementSize());
+		UINT32 size = array.size() * array.elementSize();
+
+		return MeshDataEx::writeElements(thisPtr->getInternal(), type, data, size);
+	}
+
+	bool ScriptMeshDataStreams::internal_ReadIndices(ScriptRendererMeshData* thisPtr, MonoArray* buffer)
+	{
+		if (buffer == nullptr)
+			return false;
+
+		ScriptArray array(buffer);
+		return MeshDataEx::readIndices(thisPtr->getInternal(), (UINT32*)array.getRaw(0, sizeof(UINT32)), array.size());
+	}
+
+	bool ScriptMeshDataStreams::internal_WriteIndices(ScriptRendererMeshData* thisPtr, MonoArray* buffer)
+	{
+		if (buffer == nullptr)
+			return false;
+
+		ScriptArray array(buffer);
+		return MeshDataEx::writeIndices(thisPtr->getInternal(), (UINT32*)array.getRaw(0, sizeof(UINT32)), array.size());
+	}
+
+	bool ScriptMeshDataStreams::internal_ReadVertexStream(ScriptRendererMeshData* thisPtr, MonoArray* buffer)
+	{
+		if (buffer == nullptr)
+			return false;
+
+		ScriptArray array(buffer);
+		UINT8* data = (UINT8*)array.getRaw(0, array.elementSize());
+		UINT32 size = array.size() * array.elementSize();
+
+		return MeshDataEx::readVertexStream(thisPtr->getInternal(), data, size);
+	}
+
+	bool ScriptMeshDataStreams::internal_WriteVertexStream(ScriptRendererMeshData* thisPtr, MonoArray* buffer)
+	{
+		if (buffer == nullptr)
+			return false;
+
+		ScriptArray array(buffer);
+		UINT8* data = (UINT8*)array.getRaw(0, array.elementSize());
+		UINT32 size = array.size() * array.elementSize();
+
+		return MeshDataEx::writeVertexStream(thisPtr->getInternal(), data, size);
+	}
+
+	UINT32 ScriptMeshDataStreams::internal_GetVertexStride(ScriptRendererMeshData* thisPtr)
+	{
+		return MeshDataEx::getVertexStride(thisPtr->getInternal());
+	}
+
+	INT32 ScriptMeshDataStreams::internal_GetElementOffset(ScriptRendererMeshData* thisPtr, VertexLayout type)
+	{
+		return MeshDataEx::getElementOffset(thisPtr->getInternal(), type);
+	}
+}
@@ -0,0 +1,44 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsScriptEnginePrerequisites.h"
+#include "BsScriptObject.h"
+#include "Renderer/BsRendererMeshData.h"
+
+namespace bs
+{
+	class ScriptRendererMeshData;
+
+	/** @addtogroup ScriptInteropEngine
+	 *  @{
+	 */
+
+	/** 
+	 * Interop class between C++ & CLR for MeshDataStreams. Provides access to MeshData vertex and index streams by 
+	 * copying them directly from/to caller provided managed arrays, without intermediate allocations or per-element 
+	 * marshalling.
+	 */
+	class BS_SCR_BE_EXPORT ScriptMeshDataStreams : public ScriptObject <ScriptMeshDataStreams>
+	{
+	public:
+		SCRIPT_OBJ(ENGINE_ASSEMBLY, "BansheeEngine", "MeshDataStreams")
+
+	private:
+		ScriptMeshDataStreams(MonoObject* instance);
+
+		/************************************************************************/
+		/* 								CLR HOOKS						   		*/
+		/************************************************************************/
+		static bool internal_ReadElements(ScriptRendererMeshData* thisPtr, VertexLayout type, MonoArray* buffer);
+		static bool internal_WriteElements(ScriptRendererMeshData* thisPtr, VertexLayout type, MonoArray* buffer);
+		static bool internal_ReadIndices(ScriptRendererMeshData* thisPtr, MonoArray* buffer);
+		static bool internal_WriteIndices(ScriptRendererMeshData* thisPtr, MonoArray* buffer);
+		static bool internal_ReadVertexStream(ScriptRendererMeshData* thisPtr, MonoArray* buffer);
+		static bool internal_WriteVertexStream(ScriptRendererMeshData* thisPtr, MonoArray* buffer);
+		static UINT32 internal_GetVertexStride(ScriptRendererMeshData* thisPtr);
+		static INT32 internal_GetElementOffset(ScriptRendererMeshData* thisPtr, VertexLayout type);
+	};
+
+	/** @} */
+}
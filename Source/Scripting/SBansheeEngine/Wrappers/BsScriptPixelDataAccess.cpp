@@ -0,0 +1,192 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "Wrappers/BsScriptPixelDataAccess.h"
+#include "BsMonoManager.h"
+#include "BsMonoClass.h"
+#include "BsMonoUtil.h"
+#include "BsMonoArray.h"
+#include "Extensions/BsPixelDataEx.h"
+#include "Extensions/BsTextureEx.h"
+#include "BsScriptPixelData.generated.h"
+#include "BsScriptTexture.generated.h"
+
+namespace bs
+{
+	ScriptPixelDataAccess::ScriptPixelDataAccess(MonoObject* instance)
+		:ScriptObject(instance)
+	{ }
+
+	void ScriptPixelDataAccess::initRuntimeData()
+	{
+		metaData.scriptClass->addInternalCall("Internal_ReadRawPixels", (void*)&ScriptPixelDataAccess::internal_ReadRawPixels);
+		metaData.scriptClass->addInternalCall("Internal_WriteRawPixels", (void*)&ScriptPixelDataAccess::internal_WriteRawPixels);
+		metaData.scriptClass->addInternalCall("Internal_ReadColors", (void*)&ScriptPixelDataAccess::internal_ReadColors);
+		metaData.scriptClass->addInternalCall("Internal_WriteColors", (void*)&ScriptPixelDataAccess::internal_WriteColors);
+		metaData.scriptClass->addInternalCall("Internal_GetRowSize", (void*)&ScriptPixelDataAccess::internal_GetRowSize);
+		metaData.scriptClass->addInternalCall("Internal_Lock", (void*)&ScriptPixelDataAccess::internal_Lock);
+		metaData.scriptClass->addInternalCall("Internal_Unlock", (void*)&ScriptPixelDataAccess::internal_Unlock);
+		metaData.scriptClass->addInternalCall("Internal_GetLockedRowData", (void*)&ScriptPixelDataAccess::internal_GetLockedRowData);
+		metaData.scriptClass->addInternalCall("Internal_ReadRow", (void*)&ScriptPixelDataAccess::internal_ReadRow);
+		metaData.scriptClass->addInternalCall("Internal_WriteRow", (void*)&ScriptPixelDataAccess::internal_WriteRow);
+		metaData.scriptClass->addInternalCall("Internal_ReadRowColors", (void*)&ScriptPixelDataAccess::internal_ReadRowColors);
+		metaData.scriptClass->addInternalCall("Internal_WriteRowColors", (void*)&ScriptPixelDataAccess::internal_WriteRowColors);
+		metaData.scriptClass->addInternalCall("Internal_ReadTextureCachedPixels", (void*)&ScriptPixelDataAccess::internal_ReadTextureCachedPixels);
+		metaData.scriptClass->addInternalCall("Internal_WriteTextureRawPixels", (void*)&ScriptPixelDataAccess::internal_WriteTextureRawPixels);
+		metaData.scriptClass->addInternalCall("Internal_WriteTextureColors", (void*)&ScriptPixelDataAccess::internal_WriteTextureColors);
+	}
+
+	bool ScriptPixelDataAccess::internal_ReadRawPixels(ScriptPixelData* thisPtr, MonoArray* buffer)
+	{
+		if (buffer == nullptr)
+			return false;
+
+		// Managed array is referenced from the stack for the duration of the call, so the GC won't move it
+		ScriptArray array(buffer);
+		UINT8* data = (UINT8*)array.getRaw(0, sizeof(UINT8));
+
+		return PixelDataEx::readRawPixels(thisPtr->getInternal(), data, array.size());
+	}
+
+	bool ScriptPixelDataAccess::internal_WriteRawPixels(ScriptPixelData* thisPtr, MonoArray* buffer)
+	{
+		if (buffer == nullptr)
+			return false;
+
+		ScriptArray array(buffer);
+		UINT8* data = (UINT8*)array.getRaw(0, sizeof(UINT8));
+
+		return PixelDataEx::writeRawPixels(thisPtr->getInternal(), data, array.size());
+	}
+
+	bool ScriptPixelDataAccess::internal_ReadColors(ScriptPixelData* thisPtr, MonoArray* buffer)
+	{
+		if (buffer == nullptr)
+			return false;
+
+		ScriptArray array(buffer);
+		if (array.elementSize() != sizeof(Color))
+			return false;
+
+		Color* data = (Color*)array.getRaw(0, sizeof(Color));
+		return PixelDataEx::readColors(thisPtr->getInternal(), data, array.size());
+	}
+
+	bool ScriptPixelDataAccess::internal_WriteColors(ScriptPixelData* thisPtr, MonoArray* buffer)
+	{
+		if (buffer == nullptr)
+			return false;
+
+		ScriptArray array(buffer);
+		if (array.elementSize() != sizeof(Color))
+			return false;
+
+		Color* data = (Color*)array.getRaw(0, sizeof(Color));
+		return PixelDataEx::writeColors(thisPtr->getInternal(), data, array.size());
+	}
+
+	UINT32 ScriptPixelDataAccess::internal_GetRowSize(ScriptPixelData* thisPtr)
+	{
+		return PixelDataEx::getRowSize(thisPtr->getInternal());
+	}
+
+	bool ScriptPixelDataAccess::internal_Lock(ScriptPixelData* thisPtr)
+	{
+		return PixelDataEx::lock(thisPtr->getInternal());
+	}
+
+	void ScriptPixelDataAccess::internal_Unlock(ScriptPixelData* thisPtr)
+	{
+		PixelDataEx::unlock(thisPtr->getInternal());
+	}
+
+	UINT8* ScriptPixelDataAccess::internal_GetLockedRowData(ScriptPixelData* thisPtr, UINT32 y, UINT32 z)
+	{
+		return PixelDataEx::getLockedRowData(thisPtr->getInternal(), y, z);
+	}
+
+	bool ScriptPixelDataAccess::internal_ReadRow(ScriptPixelData* thisPtr, UINT32 y, UINT32 z, MonoArray* buffer)
+	{
+		if (buffer == nullptr)
+			return false;
+
+		ScriptArray array(buffer);
+		UINT8* data = (UINT8*)array.getRaw(0, sizeof(UINT8));
+
+		return PixelDataEx::readRow(thisPtr->getInternal(), y, z, data, array.size());
+	}
+
+	bool ScriptPixelDataAccess::internal_WriteRow(ScriptPixelData* thisPtr, UINT32 y, UINT32 z, MonoArray* buffer)
+	{
+		if (buffer == nullptr)
+			return false;
+
+		ScriptArray array(buffer);
+		UINT8* data = (UINT8*)array.getRaw(0, sizeof(UINT8));
+
+		return PixelDataEx::writeRow(thisPtr->getInternal(), y, z, data, array.size());
+	}
+
+	bool ScriptPixelDataAccess::internal_ReadRowColors(ScriptPixelData* thisPtr, UINT32 y, UINT32 z, MonoArray* buffer)
+	{
+		if (buffer == nullptr)
+			return false;
+
+		ScriptArray array(buffer);
+		if (array.elementSize() != sizeof(Color))
+			return false;
+
+		Color* data = (Color*)array.getRaw(0, sizeof(Color));
+		return PixelDataEx::readRowColors(thisPtr->getInternal(), y, z, data, array.size());
+	}
+
+	bool ScriptPixelDataAccess::internal_WriteRowColors(ScriptPixelData* thisPtr, UINT32 y, UINT32 z, MonoArray* buffer)
+	{
+		if (buffer == nullptr)
+			return false;
+
+		ScriptArray array(buffer);
+		if (array.elementSize() != sizeof(Color))
+			return false;
+
+		Color* data = (Color*)array.getRaw(0, sizeof(Color));
+		return PixelDataEx::writeRowColors(thisPtr->getInternal(), y, z, data, array.size());
+	}
+
+	bool ScriptPixelDataAccess::internal_ReadTextureCachedPixels(ScriptTexture* thisPtr, MonoArray* buffer, UINT32 face, 
+		UINT32 mipLevel)
+	{
+		if (buffer == nullptr)
+			return false;
+
+		ScriptArray array(buffer);
+		UINT8* data = (UINT8*)array.getRaw(0, sizeof(UINT8));
+
+		return TextureEx::readCachedPixels(thisPtr->getHandle(), data, array.size(), face, mipLevel);
+	}
+
+	bool ScriptPixelDataAccess::internal_WriteTextureRawPixels(ScriptTexture* thisPtr, MonoArray* buffer, UINT32 face, 
+		UINT32 mipLevel)
+	{
+		if (buffer == nullptr)
+			return false;
+
+		ScriptArray array(buffer);
+		UINT8* data = (UINT8*)array.getRaw(0, sizeof(UINT8));
+
+		return TextureEx::writeRawPixels(thisPtr->getHandle(), data, array.size(), face, mipLevel);
+	}
+
+	bool ScriptPixelDataAccess::internal_WriteTextureColors(ScriptTexture* thisPtr, MonoArray* buffer, UINT32 face, 
+		UINT32 mipLevel)
+	{
+		if (buffer == nullptr)
+			return false;
+
+		ScriptArray array(buffer);
+		if (array.elementSize() != sizeof(Color))
+			return false;
+
+		Color* data = (Color*)array.getRaw(0, sizeof(Color));
+		return TextureEx::writeColors(thisPtr->getHandle(), data, array.size(), face, mipLevel);
+	}
+}
@@ -0,0 +1,53 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsScriptEnginePrerequisites.h"
+#include "BsScriptObject.h"
+
+namespace bs
+{
+	class ScriptPixelData;
+	class ScriptTexture;
+
+	/** @addtogroup ScriptInteropEngine
+	 *  @{
+	 */
+
+	/** 
+	 * Interop class between C++ & CLR for PixelDataAccess. Provides access to PixelData and Texture pixels by copying them
+	 * directly from/to caller provided managed arrays, without intermediate allocations or per-element marshalling.
+	 */
+	class BS_SCR_BE_EXPORT ScriptPixelDataAccess : public ScriptObject <ScriptPixelDataAccess>
+	{
+	public:
+		SCRIPT_OBJ(ENGINE_ASSEMBLY, "BansheeEngine", "PixelDataAccess")
+
+	private:
+		ScriptPixelDataAccess(MonoObject* instance);
+
+		/************************************************************************/
+		/* 								CLR HOOKS						   		*/
+		/************************************************************************/
+		static bool internal_ReadRawPixels(ScriptPixelData* thisPtr, MonoArray* buffer);
+		static bool internal_WriteRawPixels(ScriptPixelData* thisPtr, MonoArray* buffer);
+		static bool internal_ReadColors(ScriptPixelData* thisPtr, MonoArray* buffer);
+		static bool internal_WriteColors(ScriptPixelData* thisPtr, MonoArray* buffer);
+		static UINT32 internal_GetRowSize(ScriptPixelData* thisPtr);
+		static bool internal_Lock(ScriptPixelData* thisPtr);
+		static void internal_Unlock(ScriptPixelData* thisPtr);
+		static UINT8* internal_GetLockedRowData(ScriptPixelData* thisPtr, UINT32 y, UINT32 z);
+		static bool internal_ReadRow(ScriptPixelData* thisPtr, UINT32 y, UINT32 z, MonoArray* buffer);
+		static bool internal_WriteRow(ScriptPixelData* thisPtr, UINT32 y, UINT32 z, MonoArray* buffer);
+		static bool internal_ReadRowColors(ScriptPixelData* thisPtr, UINT32 y, UINT32 z, MonoArray* buffer);
+		static bool internal_WriteRowColors(ScriptPixelData* thisPtr, UINT32 y, UINT32 z, MonoArray* buffer);
+
+		static bool internal_ReadTextureCachedPixels(ScriptTexture* thisPtr, MonoArray* buffer, UINT32 face, 
+			UINT32 mipLevel);
+		static bool internal_WriteTextureRawPixels(ScriptTexture* thisPtr, MonoArray* buffer, UINT32 face, 
+			UINT32 mipLevel);
+		static bool internal_WriteTextureColors(ScriptTexture* thisPtr, MonoArray* buffer, UINT32 face, UINT32 mipLevel);
+	};
+
+	/** @} */
+}
@@ -9,6 +9,8 @@
 
 namespace bs
 {
+	Event<void(const HSceneObject&)> ScriptPrefab::onInstantiated;
+
 	ScriptPrefab::ScriptPrefab(MonoObject* instance, const HPrefab& prefab)
 		:TScriptResource(instance, prefab)
 	{
@@ -26,6 +28,8 @@ namespace bs
 	{
 		HPrefab prefab = Prefab::create(so->getNativeSceneObject(), isScene);
 		ScriptResourceManager::instance().createBuiltinScriptResource(prefab, instance);
+
+		onInstantiated(so->getNativeSceneObject());
 	}
 
 	MonoObject* ScriptPrefab::internal_Instantiate(ScriptPrefab* thisPtr)
@@ -33,6 +37,8 @@ namespace bs
 		HPrefab prefab = thisPtr->getHandle();
 
 		HSceneObject instance = prefab->instantiate();
+		onInstantiated(instance);
+
 		ScriptSceneObject* scriptInstance = ScriptGameObjectManager::instance().getOrCreateScriptSceneObject(instance);
 
 		return scriptInstance->getManagedInstance();
@@ -21,6 +21,13 @@ namespace bs
 		/**	Creates an empty, uninitialized managed instance of the resource interop object. */
 		static MonoObject* createInstance();
 
+		/**
+		 * Triggered when a hierarchy containing prefab instances is added to the scene through the scripting system: when
+		 * a prefab is instantiated, a scene object is linked to a new prefab, a scene is loaded or the scene is restored
+		 * after play mode. Provides the root of the hierarchy.
+		 */
+		static Event<void(const HSceneObject&)> onInstantiated;
+
 	private:
 		friend class ScriptResourceManager;
 		friend class BuiltinResourceTypes;
@@ -4,6 +4,7 @@
 #include "BsScriptMeta.h"
 #include "BsMonoClass.h"
 #include "BsMonoUtil.h"
+#include "BsMonoArray.h"
 #include "Resources/BsResources.h"
 #include "Wrappers/BsScriptResource.h"
 #include "BsScriptResourceManager.h"
@@ -22,6 +23,12 @@ namespace bs
 		metaData.scriptClass->addInternalCall("Internal_IsLoaded", (void*)&ScriptResourceRef::internal_IsLoaded);
 		metaData.scriptClass->addInternalCall("Internal_GetResource", (void*)&ScriptResourceRef::internal_GetResource);
 		metaData.scriptClass->addInternalCall("Internal_GetUUID", (void*)&ScriptResourceRef::internal_GetUUID);
+		metaData.scriptClass->addInternalCall("Internal_GetMemoryUsage", (void*)&ScriptResourceRef::internal_GetMemoryUsage);
+		metaData.scriptClass->addInternalCall("Internal_IsPinned", (void*)&ScriptResourceRef::internal_IsPinned);
+		metaData.scriptClass->addInternalCall("Internal_Pin", (void*)&ScriptResourceRef::internal_Pin);
+		metaData.scriptClass->addInternalCall("Internal_Unpin", (void*)&ScriptResourceRef::internal_Unpin);
+		metaData.scriptClass->addInternalCall("Internal_GetResidency", (void*)&ScriptResourceRef::internal_GetResidency);
+		metaData.scriptClass->addInternalCall("Internal_GetResidencyReport", (void*)&ScriptResourceRef::internal_GetResidencyReport);
 	}
 
 	MonoObject* ScriptResourceRef::createInternal(const WeakResourceHandle<Resource>& handle)
@@ -54,5 +61,71 @@ namespace bs
 	{
 		*uuid = thisPtr->getHandle().getUUID();
 	}
+
+	UINT64 ScriptResourceRef::internal_GetMemoryUsage(ScriptResourceRef* thisPtr)
+	{
+		if (!thisPtr->mResource.isLoaded(false))
+			return 0;
+
+		return ScriptResourceManager::getMemoryUsage(thisPtr->mResource.get());
+	}
+
+	bool ScriptResourceRef::internal_IsPinned(ScriptResourceRef* thisPtr)
+	{
+		return ScriptResourceManager::instance().isPinned(thisPtr->mResource.getUUID());
+	}
+
+	void ScriptResourceRef::internal_Pin(ScriptResourceRef* thisPtr, MonoString* reason)
+	{
+		ScriptResourceManager::instance().pinResource(thisPtr->mResource, MonoUtil::monoToString(reason));
+	}
+
+	void ScriptResourceRef::internal_Unpin(ScriptResourceRef* thisPtr, MonoString* reason)
+	{
+		ScriptResourceManager::instance().unpinResource(thisPtr->mResource.getUUID(), MonoUtil::monoToString(reason));
+	}
+
+	void ScriptResourceRef::internal_GetResidency(MonoArray* references, UINT32* numLoaded, UINT32* numPinned,
+		UINT64* memoryUsage)
+	{
+		*numLoaded = 0;
+		*numPinned = 0;
+		*memoryUsage = 0;
+
+		if (references == nullptr)
+			return;
+
+		ScriptResourceManager& resourceManager = ScriptResourceManager::instance();
+
+		// Duplicate references are only counted once
+		UnorderedSet<UUID> visited;
+
+		ScriptArray referenceArray(references);
+		UINT32 numReferences = referenceArray.size();
+		for (UINT32 i = 0; i < numReferences; i++)
+		{
+			ScriptResourceRef* scriptRef = ScriptResourceRef::toNative(referenceArray.get<MonoObject*>(i));
+			if (scriptRef == nullptr)
+				continue;
+
+			const WeakResourceHandle<Resource>& resource = scriptRef->mResource;
+			if (!visited.insert(resource.getUUID()).second)
+				continue;
+
+			if (resourceManager.isPinned(resource.getUUID()))
+				(*numPinned)++;
+
+			if (resource.isLoaded(false))
+			{
+				(*numLoaded)++;
+				*memoryUsage += ScriptResourceManager::getMemoryUsage(resource.get());
+			}
+		}
+	}
+
+	MonoString* ScriptResourceRef::internal_GetResidencyReport()
+	{
+		return MonoUtil::stringToMono(ScriptResourceManager::instance().getResidencyReport());
+	}
 }
 
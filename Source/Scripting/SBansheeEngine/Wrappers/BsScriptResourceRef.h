@@ -55,6 +55,13 @@ namespace bs
 		static bool internal_IsLoaded(ScriptResourceRef* nativeInstance);
 		static MonoObject* internal_GetResource(ScriptResourceRef* nativeInstance);
 		static void internal_GetUUID(ScriptResourceRef* thisPtr, UUID* uuid);
+		static UINT64 internal_GetMemoryUsage(ScriptResourceRef* thisPtr);
+		static bool internal_IsPinned(ScriptResourceRef* thisPtr);
+		static void internal_Pin(ScriptResourceRef* thisPtr, MonoString* reason);
+		static void internal_Unpin(ScriptResourceRef* thisPtr, MonoString* reason);
+		static void internal_GetResidency(MonoArray* references, UINT32* numLoaded, UINT32* numPinned,
+			UINT64* memoryUsage);
+		static MonoString* internal_GetResidencyReport();
 	};
 
 	/** @} */
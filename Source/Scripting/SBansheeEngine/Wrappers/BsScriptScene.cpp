@@ -63,11 +63,15 @@ namespace bs
 			{
 				HSceneObject root = prefab->instantiate();
 				gSceneManager().setRootNode(root);
+
+				ScriptPrefab::onInstantiated(root);
 			}
 			else
 			{
 				gSceneManager().clearScene();
-				prefab->instantiate();
+
+				HSceneObject root = prefab->instantiate();
+				ScriptPrefab::onInstantiated(root);
 			}
 
 			ScriptResourceBase* scriptPrefab = ScriptResourceManager::instance().getScriptResource(prefab, true);
@@ -8,6 +8,8 @@
 #include "BsMonoUtil.h"
 #include "Serialization/BsManagedSerializableObjectInfo.h"
 #include "Wrappers/BsScriptSerializableProperty.h"
+#include "Wrappers/BsScriptManagedComponent.h"
+#include "BsManagedChangeTracker.h"
 
 namespace bs
 {
@@ -58,7 +60,18 @@ namespace bs
 		}
 		else
 			nativeInstance->mFieldInfo->setValue(instance, value);
+
+		// Nested objects don't know which component they belong to, so their modifications are reported globally
+		MonoClass* instanceClass = MonoManager::instance().findClass(MonoUtil::getClass(instance));
+		if (instanceClass != nullptr && instanceClass->isSubClassOf(ScriptManagedComponent::getMetaData()->scriptClass))
+		{
+			ScriptManagedComponent* scriptComponent = ScriptManagedComponent::toNative(instance);
+			ManagedChangeTracker::notifyModified(scriptComponent->getNativeHandle().getInstanceId());
+		}
+		else
+			ManagedChangeTracker::notifyAllModified();
 	}
+
 	void ScriptSerializableField::internal_getStyle(ScriptSerializableField* nativeInstance, SerializableMemberStyle* style)
 	{
 		SPtr<ManagedSerializableMemberInfo> fieldInfo = nativeInstance->mFieldInfo;